@@ -927,7 +927,7 @@ void Game::processQueuedMessages() {
                 // sprintf(tmp_str.data(), "%s",
                 // pKeyActionMap->pPressedKeysBuffer);
                 FrameTableTxtLine frameTableTxtLine;
-                txt_file_frametable_parser(keyboardInputHandler->GetTextInput().c_str(), &frameTableTxtLine);
+                frame_table_txt_parser(keyboardInputHandler->GetTextInput().c_str(), &frameTableTxtLine);
                 std::string status_string;
                 if (frameTableTxtLine.uPropCount == 1) {
                     MapId map_index = static_cast<MapId>(atoi(frameTableTxtLine.pProperties[0]));
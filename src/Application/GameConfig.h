@@ -133,6 +133,13 @@ class GameConfig : public Config {
         Bool OverrideBuiltInResources = {this, "override_built_in_resources", false,
             "Allow overriding built-in game resources (shaders and scripts) with files in game data folder."};
 
+        Bool TableCache = {this, "table_cache", false,
+            "Store parsed data tables in the user data folder so that they don't have to be parsed again on subsequent "
+            "runs. Cache entries are invalidated automatically when events.lod changes."};
+
+        Bool VerifyCharacterStatsCache = {this, "verify_character_stats_cache", false,
+            "Recompute cached character stats on every cache hit and log the values that don't match."};
+
      private:
         static int ValidateFrameTime(int frameTime) {
             return std::max(frameTime, 1);
@@ -434,6 +441,9 @@ class GameConfig : public Config {
 
         Int MaxVisibleSectors = {this, "maxvisiblesectors", 10, &ValidateMaxSectors, "Max number of BSP sectors to display."};
 
+        Int MaxParticles = {this, "max_particles", 2000, &ValidateMaxParticles,
+                            "Max number of active particles. Particles spawned over this limit are not shown."};
+
         Bool SeasonsChange = {this, "seasons_change", true,
                               "Allow changing trees/ground depending on current season (originally was only used in MM6)."};
 
@@ -475,6 +485,10 @@ class GameConfig : public Config {
         Bool GenerateTiles = {this, "generate_tiles", true,
             "Auto-generate missing tiles on startup and use them where appropriate. MM7 missed some tile transitions, this option fixes this issue."};
 
+        Bool DecodedImageCache = {this, "decoded_image_cache", false,
+            "Store decoded textures in the user data folder so that they don't have to be decoded again on subsequent runs. "
+            "Cache entries are invalidated automatically when game data files change."};
+
      private:
         static int ValidateGamma(int level) {
             return std::clamp(level, 0, 9);
@@ -482,6 +496,9 @@ class GameConfig : public Config {
         static int ValidateMaxSectors(int sectors) {
             return std::clamp(sectors, 1, 150);
         }
+        static int ValidateMaxParticles(int particles) {
+            return std::clamp(particles, 100, 100000);
+        }
         static int ValidateTorchlight(int distance) {
             if (distance < 0)
                 return 0;
@@ -9,6 +9,7 @@
 #include "Library/FileSystem/Lowercase/LowercaseFileSystem.h"
 #include "Library/FileSystem/Merging/MergingFileSystem.h"
 #include "Library/FileSystem/Memory/MemoryFileSystem.h"
+#include "Library/FileSystem/Mounting/MountingFileSystem.h"
 
 #include "Engine/EngineFileSystem.h"
 
@@ -21,13 +22,25 @@ FileSystemStarter::~FileSystemStarter() {
     dfs = nullptr;
 }
 
-void FileSystemStarter::initUserFs(bool ramFs, std::string_view path) {
+void FileSystemStarter::initUserFs(bool ramFs, std::string_view path, std::string_view tableCachePath) {
     assert(ufs == nullptr);
 
     if (ramFs) {
-        _userFs = std::make_unique<MemoryFileSystem>("ramfs");
+        _userBaseFs = std::make_unique<MemoryFileSystem>("ramfs");
     } else {
-        _userFs = std::make_unique<DirectoryFileSystem>(path);
+        _userBaseFs = std::make_unique<DirectoryFileSystem>(path);
+    }
+
+    if (tableCachePath.empty()) {
+        _userFs = std::move(_userBaseFs);
+    } else {
+        // Table cache is derived from the game data, so it's OK to keep it on disk even if the rest of user data is
+        // in memory.
+        _tableCacheFs = std::make_unique<DirectoryFileSystem>(tableCachePath);
+        auto userFs = std::make_unique<MountingFileSystem>("ufs");
+        userFs->mount("", _userBaseFs.get());
+        userFs->mount("cache/tables", _tableCacheFs.get());
+        _userFs = std::move(userFs);
     }
 
     ufs = _userFs.get();
@@ -10,11 +10,13 @@ class FileSystemStarter {
     FileSystemStarter();
     ~FileSystemStarter();
 
-    void initUserFs(bool ramFs, std::string_view path);
+    void initUserFs(bool ramFs, std::string_view path, std::string_view tableCachePath = {});
     void initDataFs(std::string_view path, bool pathOverridesBuiltIn);
 
  private:
-    std::unique_ptr<FileSystem> _userFs;
+    std::unique_ptr<FileSystem> _userBaseFs;
+    std::unique_ptr<FileSystem> _tableCacheFs;
+    std::unique_ptr<FileSystem> _userFs; // Mounts the above, so goes after them.
     std::unique_ptr<FileSystem> _dataEmbeddedFs;
     std::unique_ptr<FileSystem> _dataDirFs;
     std::unique_ptr<FileSystem> _dataDirLowercaseFs;
@@ -73,7 +73,7 @@ void GameStarter::initialize() {
 
     // Resolve user path & create user fs.
     resolveUserPath(_environment.get(), &_options);
-    _fsStarter.initUserFs(_options.ramFsUserData, _options.userPath);
+    _fsStarter.initUserFs(_options.ramFsUserData, _options.userPath, _options.tableCachePath);
     logger->info("Using user path '{}'.", ufs->displayPath(""));
 
     // Init config.
@@ -90,6 +90,8 @@ void GameStarter::initialize() {
     // Patch config.
     if (_options.quickStart)
         _config->graphics.GenerateTiles.setValue(false);
+    if (!_options.tableCachePath.empty())
+        _config->debug.TableCache.setValue(true);
 
     // Finish logger init now that we have user fs and know the desired log level.
     _logStarter.initialize(ufs, _options.logLevel ? *_options.logLevel : _config->debug.LogLevel.value());
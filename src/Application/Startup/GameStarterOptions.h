@@ -14,4 +14,6 @@ struct GameStarterOptions {
     bool headless = false; // Run in headless mode.
     bool tracingRng = false; // Use tracing random engine?
     bool quickStart = false; // Skip whatever slow initialization that we have, including additional asset generation.
+    std::string tableCachePath; // If not empty, enables the table cache and stores it in this folder on disk, even if
+                                // user data is in memory.
 };
@@ -1,22 +1,34 @@
 #include "LodToolOptions.h"
 
+#include <zlib.h>
+
 #include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <algorithm>
 #include <vector>
 
+#include "Library/Compression/Compression.h"
+#include "Library/Compression/ZlibInputStream.h"
 #include "Library/Image/ImageFunctions.h"
 #include "Library/Image/Pcx.h"
 #include "Library/Image/Png.h"
 #include "Library/Lod/LodReader.h"
 #include "Library/LodFormats/LodFormats.h"
+#include "Library/LodFormats/LodFormatSnapshots.h"
 #include "Library/FileSystem/Directory/DirectoryFileSystem.h"
 #include "Library/Serialization/Serialization.h"
 
 #include "Utility/String/Format.h"
 #include "Utility/String/Ascii.h"
 #include "Utility/String/Transformations.h"
+#include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Memory/FreeDeleter.h"
+#include "Utility/Exception.h"
 #include "Utility/UnicodeCrt.h"
 
 RgbaImage renderFont(const LodFont &font) {
@@ -151,6 +163,190 @@ int runExtract(const LodToolOptions &options) {
     return 0;
 }
 
+int runBench(const LodToolOptions &options) {
+    using Clock = std::chrono::steady_clock;
+    auto nsPer = [](Clock::duration duration, size_t count) {
+        return count == 0 ? 0.0 : std::chrono::duration<double, std::nano>(duration).count() / count;
+    };
+
+    Blob lod = Blob::fromFile(options.lodPath);
+
+    // Use upper-case names for lookups so that case-insensitive comparison is exercised.
+    std::vector<std::string> names;
+    for (const std::string &name : LodReader(Blob::share(lod), LOD_ALLOW_DUPLICATES).ls())
+        names.push_back(ascii::toUpper(name));
+    std::vector<std::string_view> nameViews(names.begin(), names.end());
+
+    // Cold: open the LOD & look up every entry once.
+    Clock::time_point coldStart = Clock::now();
+    LodReader reader(Blob::share(lod), LOD_ALLOW_DUPLICATES);
+    Clock::time_point coldOpened = Clock::now();
+    size_t found = 0;
+    for (std::string_view name : nameViews)
+        found += reader.exists(name);
+    Clock::time_point coldEnd = Clock::now();
+
+    // Warm: repeated lookups.
+    Clock::time_point existsStart = Clock::now();
+    for (int i = 0; i < options.bench.iterations; i++)
+        for (std::string_view name : nameViews)
+            found += reader.exists(name);
+    Clock::time_point existsEnd = Clock::now();
+
+    size_t bytes = 0;
+    Clock::time_point readStart = Clock::now();
+    for (int i = 0; i < options.bench.iterations; i++)
+        for (std::string_view name : nameViews)
+            bytes += reader.read(name).size();
+    Clock::time_point readEnd = Clock::now();
+
+    Clock::time_point readManyStart = Clock::now();
+    for (int i = 0; i < options.bench.iterations; i++)
+        for (const Blob &blob : reader.readMany(nameViews))
+            bytes += blob.size();
+    Clock::time_point readManyEnd = Clock::now();
+
+    size_t warmCount = names.size() * options.bench.iterations;
+    if (found != names.size() * (options.bench.iterations + 1))
+        throw Exception("Lookup failed for some of the entries in '{}'", options.lodPath);
+
+    fmt::println("Lod file: {}", options.lodPath);
+    fmt::println("Entries: {}", names.size());
+    fmt::println("Cold open: {:.1f}us", std::chrono::duration<double, std::micro>(coldOpened - coldStart).count());
+    fmt::println("Cold exists: {:.1f}ns/entry", nsPer(coldEnd - coldOpened, names.size()));
+    fmt::println("Warm exists: {:.1f}ns/entry", nsPer(existsEnd - existsStart, warmCount));
+    fmt::println("Warm read: {:.1f}ns/entry", nsPer(readEnd - readStart, warmCount));
+    fmt::println("Warm readMany: {:.1f}ns/entry", nsPer(readManyEnd - readManyStart, warmCount));
+    fmt::println("Total bytes read: {}", bytes);
+    return 0;
+}
+
+struct CompressedPayload {
+    Blob data;
+    size_t decompressedSize = 0;
+};
+
+std::optional<CompressedPayload> compressedPayload(const Blob &entry) {
+    BlobInputStream stream(entry);
+    LodFileFormat format = lod::magic(entry, {});
+    if (format == LOD_FILE_COMPRESSED) {
+        LodCompressionHeader_MM6 header;
+        stream.readOrFail(&header, sizeof(header));
+        if (!header.decompressedSize)
+            return std::nullopt;
+        Blob data = header.dataSize == entry.size() ? stream.tail() : stream.readBlobOrFail(header.dataSize);
+        return CompressedPayload(std::move(data), header.decompressedSize);
+    } else if (format == LOD_FILE_IMAGE || format == LOD_FILE_PSEUDO_IMAGE) {
+        LodImageHeader_MM6 header;
+        stream.readOrFail(&header, sizeof(header));
+        if (!header.decompressedSize)
+            return std::nullopt;
+        return CompressedPayload(stream.readBlobOrFail(header.dataSize), header.decompressedSize);
+    } else if (format == LOD_FILE_SPRITE) {
+        LodSpriteHeader_MM6 header;
+        stream.readOrFail(&header, sizeof(header));
+        if (!header.decompressedSize)
+            return std::nullopt;
+        stream.skipOrFail(header.height * sizeof(LodSpriteLine_MM6));
+        return CompressedPayload(stream.readBlobOrFail(header.dataSize), header.decompressedSize);
+    } else {
+        return std::nullopt;
+    }
+}
+
+/**
+ * Decompression code as it was before `zlib::uncompress` learned to use exact-size buffers. Kept here as a baseline
+ * for `bench-zlib`.
+ */
+Blob legacyUncompress(const Blob &source, size_t sizeHint) {
+    uLongf destLen = sizeHint > source.size() ? sizeHint : source.size() * 4;
+    std::unique_ptr<void, FreeDeleter> dest;
+    int res = Z_BUF_ERROR;
+    while (res == Z_BUF_ERROR) {
+        if (dest) {
+            dest.reset();
+            destLen *= 2;
+        }
+        dest.reset(malloc(destLen));
+        res = ::uncompress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
+    }
+
+    return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
+}
+
+int runBenchZlib(const LodToolOptions &options) {
+    using Clock = std::chrono::steady_clock;
+
+    LodReader reader(Blob::fromFile(options.lodPath), LOD_ALLOW_DUPLICATES);
+
+    std::vector<CompressedPayload> payloads;
+    size_t compressedBytes = 0;
+    size_t decompressedBytes = 0;
+    size_t maxDecompressedSize = 0;
+    for (const std::string &name : reader.ls()) {
+        if (std::optional<CompressedPayload> payload = compressedPayload(reader.read(name))) {
+            compressedBytes += payload->data.size();
+            decompressedBytes += payload->decompressedSize;
+            maxDecompressedSize = std::max(maxDecompressedSize, payload->decompressedSize);
+            payloads.push_back(std::move(*payload));
+        }
+    }
+
+    // Reference data for cross-checking, and also a warmup.
+    std::vector<Blob> reference;
+    for (const CompressedPayload &payload : payloads)
+        reference.push_back(legacyUncompress(payload.data, payload.decompressedSize));
+
+    auto check = [&](size_t index, const void *data, size_t size) {
+        if (size != reference[index].size() || memcmp(data, reference[index].data(), size) != 0)
+            throw Exception("Decompression results differ for entry #{} in '{}'", index, options.lodPath);
+    };
+
+    auto measure = [&](auto &&callable) {
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < options.benchZlib.iterations; i++)
+            for (size_t j = 0; j < payloads.size(); j++)
+                callable(j);
+        Clock::duration duration = Clock::now() - start;
+        double seconds = std::chrono::duration<double>(duration).count();
+        double megabytes = static_cast<double>(decompressedBytes) * options.benchZlib.iterations / (1024.0 * 1024.0);
+        return fmt::format("{:.1f}ms, {:.1f}MB/s", seconds * 1000.0 / options.benchZlib.iterations, seconds > 0 ? megabytes / seconds : 0.0);
+    };
+
+    std::string legacyTime = measure([&](size_t i) {
+        Blob result = legacyUncompress(payloads[i].data, payloads[i].decompressedSize);
+        check(i, result.data(), result.size());
+    });
+
+    std::string exactTime = measure([&](size_t i) {
+        Blob result = zlib::uncompress(payloads[i].data, payloads[i].decompressedSize);
+        check(i, result.data(), result.size());
+    });
+
+    std::unique_ptr<char[]> buffer = std::make_unique<char[]>(maxDecompressedSize);
+    std::string intoTime = measure([&](size_t i) {
+        size_t size = zlib::uncompressInto(payloads[i].data, buffer.get(), payloads[i].decompressedSize);
+        check(i, buffer.get(), size);
+    });
+
+    std::string streamTime = measure([&](size_t i) {
+        BlobInputStream input(payloads[i].data);
+        ZlibInputStream stream(&input);
+        size_t size = stream.read(buffer.get(), payloads[i].decompressedSize);
+        check(i, buffer.get(), size);
+    });
+
+    fmt::println("Lod file: {}", options.lodPath);
+    fmt::println("Compressed entries: {}", payloads.size());
+    fmt::println("Compressed bytes: {}", compressedBytes);
+    fmt::println("Decompressed bytes: {}", decompressedBytes);
+    fmt::println("Legacy uncompress: {}", legacyTime);
+    fmt::println("Exact-size uncompress: {}", exactTime);
+    fmt::println("Uncompress into reused buffer: {}", intoTime);
+    fmt::println("Streaming uncompress: {}", streamTime);
+    return 0;
+}
+
 int main(int argc, char **argv) {
     try {
         UnicodeCrt _(argc, argv);
@@ -164,6 +360,8 @@ int main(int argc, char **argv) {
         case LodToolOptions::SUBCOMMAND_DUMP: return runDump(options);
         case LodToolOptions::SUBCOMMAND_CAT: return runCat(options);
         case LodToolOptions::SUBCOMMAND_EXTRACT: return runExtract(options);
+        case LodToolOptions::SUBCOMMAND_BENCH: return runBench(options);
+        case LodToolOptions::SUBCOMMAND_BENCH_ZLIB: return runBenchZlib(options);
         }
     } catch (const std::exception &e) {
         fmt::print(stderr, "{}\n", e.what());
@@ -27,6 +27,14 @@ LodToolOptions LodToolOptions::parse(int argc, char **argv) {
     extract->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
     extract->add_option("OUTPUT", result.extract.output, "Directory to extract the entries to.")->required()->option_text(" ");
 
+    CLI::App *bench = app->add_subcommand("bench", "Benchmark entry lookups in a lod file.", result.subcommand, SUBCOMMAND_BENCH)->fallthrough();
+    bench->add_option("--iterations", result.bench.iterations, "Number of warm lookup passes over all entries.")->check(CLI::PositiveNumber);
+    bench->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
+
+    CLI::App *benchZlib = app->add_subcommand("bench-zlib", "Benchmark decompression of all compressed entries in a lod file.", result.subcommand, SUBCOMMAND_BENCH_ZLIB)->fallthrough();
+    benchZlib->add_option("--iterations", result.benchZlib.iterations, "Number of passes over all compressed entries.")->check(CLI::PositiveNumber);
+    benchZlib->add_option("LOD", result.lodPath, "Path to lod file.")->check(CLI::ExistingFile)->required()->option_text(" ");
+
     app->parse(argc, argv, result.helpPrinted);
     return result;
 }
@@ -8,6 +8,8 @@ struct LodToolOptions {
         SUBCOMMAND_DUMP,
         SUBCOMMAND_CAT,
         SUBCOMMAND_EXTRACT,
+        SUBCOMMAND_BENCH,
+        SUBCOMMAND_BENCH_ZLIB,
     };
     using enum Subcommand;
 
@@ -19,11 +21,21 @@ struct LodToolOptions {
         std::string output;
     };
 
+    struct BenchOptions {
+        int iterations = 100;
+    };
+
+    struct BenchZlibOptions {
+        int iterations = 3;
+    };
+
     Subcommand subcommand = SUBCOMMAND_DUMP;
     std::string lodPath;
     bool helpPrinted = false; // True means that help message was already printed.
     CatOptions cat;
     ExtractOptions extract;
+    BenchOptions bench;
+    BenchZlibOptions benchZlib;
     bool raw = false; // Raw flag, shared by cat & extract.
 
     static LodToolOptions parse(int argc, char **argv);
@@ -6,6 +6,21 @@
 #include <string>
 #include <algorithm>
 #include <chrono>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <thread>
+
+#ifndef _WINDOWS
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 #include "Application/Startup/GameStarter.h"
 
@@ -21,6 +36,7 @@
 #include "Library/Trace/EventTrace.h"
 
 #include "Utility/Streams/FileOutputStream.h"
+#include "Utility/Exception.h"
 #include "Utility/String/Format.h"
 #include "Utility/UnicodeCrt.h"
 #include "Utility/String/Transformations.h"
@@ -40,12 +56,12 @@ static std::string normalizeText(std::string_view text) {
     return result;
 }
 
-static void printLines(const std::vector<std::string_view> &lines, ssize_t line, ssize_t delta) {
+static void formatLines(const std::vector<std::string_view> &lines, ssize_t line, ssize_t delta, std::string *out) {
     for (size_t i = std::max(static_cast<ssize_t>(0), line - delta); i < std::min(std::ssize(lines), line + delta + 1); i++)
-        fmt::println(stderr, "{:>5}: {}", i + 1, lines[i]);
+        fmt::format_to(std::back_inserter(*out), "{:>5}: {}\n", i + 1, lines[i]);
 }
 
-static void printTraceDiff(std::string_view current, std::string_view canonical) {
+static void formatTraceDiff(std::string_view current, std::string_view canonical, std::string *out) {
     assert(canonical != current);
 
     std::vector<std::string_view> canonicalLines = split(canonical, '\n');
@@ -53,30 +69,42 @@ static void printTraceDiff(std::string_view current, std::string_view canonical)
 
     size_t line = std::ranges::mismatch(canonicalLines, currentLines).in1 - canonicalLines.begin() + 1; // Lines are 1-indexed.
 
-    fmt::println(stderr, "Canonical:");
-    printLines(canonicalLines, line, 2);
-    fmt::println(stderr, "Current:");
-    printLines(currentLines, line, 2);
+    *out += "Canonical:\n";
+    formatLines(canonicalLines, line, 2, out);
+    *out += "Current:\n";
+    formatLines(currentLines, line, 2, out);
 }
 
-int runRetrace(const OpenEnrothOptions &options) {
+/**
+ * Retraces traces in the current process, starting up the engine once.
+ *
+ * @param options                       Retrace options.
+ * @param nextTrace                     Callback returning the index of the next trace to retrace, or `std::nullopt`
+ *                                      if there are no traces left.
+ * @param reportTrace                   Callback that gets the output for each retraced trace, all lines at once.
+ * @return                              Zero on success, non-zero if some of the traces are not canonical.
+ */
+static int retraceTraces(const OpenEnrothOptions &options, const std::function<std::optional<size_t>()> &nextTrace,
+                         const std::function<void(std::string_view)> &reportTrace) {
     GameStarter starter(options);
 
     int status = 0;
 
-    starter.runInstrumented([&status, options, application = starter.application()] (EngineController *game) {
+    starter.runInstrumented([&status, &nextTrace, &reportTrace, options, application = starter.application()] (EngineController *game) {
         EngineTraceSimplePlayer *player = application->component<EngineTraceSimplePlayer>();
         EngineTraceRecorder *recorder = application->component<EngineTraceRecorder>();
 
-        for (const std::string &tracePath : options.retrace.traces) {
-            fmt::println(stderr, "Retracing '{}'...", tracePath);
+        while (std::optional<size_t> index = nextTrace()) {
+            const std::string &tracePath = options.retrace.traces[*index];
+            std::string output = fmt::format("Retracing '{}'...\n", tracePath);
             auto startTime = std::chrono::steady_clock::now();
 
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
+            std::string savePath = std::filesystem::path(tracePath).replace_extension(".mm7").generic_string();
             Blob oldTraceBlob = Blob::fromFile(tracePath);
             Blob oldSaveBlob = Blob::fromFile(savePath);
+            bool isBinary = EventTrace::isBinaryBlob(oldTraceBlob);
 
-            EventTrace oldTrace = EventTrace::fromJsonBlob(oldTraceBlob, application->window());
+            EventTrace oldTrace = EventTrace::fromBlob(oldTraceBlob, application->window());
 
             EngineTraceStateAccessor::prepareForPlayback(engine->config.get(), oldTrace.header.config);
             recorder->startRecording(game, oldSaveBlob);
@@ -84,24 +112,240 @@ int runRetrace(const OpenEnrothOptions &options) {
             player->playTrace(game, std::move(oldTrace.events), tracePath, TRACE_PLAYBACK_SKIP_RANDOM_CHECKS | TRACE_PLAYBACK_SKIP_STATE_CHECKS);
             EngineTraceRecording recording = recorder->finishRecording(game);
 
+            // Recorder always produces JSON, re-encode so that the trace is written back in the format it was read in.
+            Blob newTraceBlob = isBinary ?
+                EventTrace::toBinaryBlob(EventTrace::fromJsonBlob(recording.trace, application->window())) :
+                Blob::share(recording.trace);
+
             auto endTime = std::chrono::steady_clock::now();
-            fmt::println(stderr, "Retraced in {}ms.", std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count());
+            fmt::format_to(std::back_inserter(output), "Retraced in {}ms.\n",
+                           std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime).count());
 
             if (!options.retrace.checkCanonical) {
                 oldTraceBlob = Blob(); // Close old trace file
-                FileOutputStream(tracePath).write(recording.trace);
+                FileOutputStream(tracePath).write(newTraceBlob);
             } else {
-                std::string oldTraceJson = normalizeText(oldTraceBlob.string_view());
+                // Binary traces are diffed through their JSON representation, there's no point in diffing raw bytes.
+                Blob oldTraceJsonBlob = isBinary ?
+                    EventTrace::toJsonBlob(EventTrace::fromBinaryBlob(oldTraceBlob, application->window())) :
+                    Blob::share(oldTraceBlob);
+                std::string oldTraceJson = normalizeText(oldTraceJsonBlob.string_view());
                 std::string newTraceJson = normalizeText(recording.trace.string_view());
-                if (oldTraceJson != newTraceJson) {
-                    fmt::println(stderr, "Trace '{}' is not in canonical representation.", tracePath);
-                    printTraceDiff(oldTraceJson, newTraceJson);
+                bool sameBytes = !isBinary || oldTraceBlob.string_view() == newTraceBlob.string_view();
+                if (oldTraceJson != newTraceJson || !sameBytes) {
+                    fmt::format_to(std::back_inserter(output), "Trace '{}' is not in canonical representation.\n", tracePath);
+                    if (oldTraceJson != newTraceJson)
+                        formatTraceDiff(oldTraceJson, newTraceJson, &output);
                     status = 1;
                 }
             }
+
+            reportTrace(output);
         }
     });
 
+    return status;
+}
+
+#ifndef _WINDOWS
+/**
+ * Writes the whole buffer into a file descriptor, retrying on partial writes.
+ *
+ * @return                              Whether all of the data was written.
+ */
+static bool writeAll(int fd, const void *data, size_t size) {
+    const char *pos = static_cast<const char *>(data);
+    while (size > 0) {
+        ssize_t written = write(fd, pos, size);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return false;
+        pos += written;
+        size -= written;
+    }
+    return true;
+}
+
+/**
+ * Retraces traces in several worker processes.
+ *
+ * Workers are forked before the engine is started up - `GameStarter` spins up the control thread & the audio threads,
+ * and these don't survive a `fork`. Each worker still starts up the engine only once, and then keeps picking up trace
+ * indices from a shared pipe until there are none left, so that the workers that got short traces take on more work.
+ *
+ * Each worker sends the output for every retraced trace back to the parent through its own pipe, prefixed with the
+ * output size. Parent prints it out one trace at a time, so that the diffs from different workers don't get mixed up.
+ *
+ * @param options                       Retrace options.
+ * @param jobs                          Number of worker processes to fork.
+ * @return                              Zero on success, non-zero if any of the workers has failed.
+ */
+static int retraceTracesInParallel(const OpenEnrothOptions &options, size_t jobs) {
+    int indexFds[2];
+    if (pipe(indexFds) != 0)
+        throw Exception("Could not create a pipe for parallel retracing: {}", std::strerror(errno));
+
+    std::fflush(nullptr); // Don't let the workers inherit unflushed output.
+
+    struct Worker {
+        pid_t pid = 0;
+        int outputFd = -1;
+        std::string buffer; // Output that's not yet printed.
+    };
+
+    std::vector<Worker> workers;
+    for (size_t i = 0; i < jobs; i++) {
+        int outputFds[2];
+        if (pipe(outputFds) != 0)
+            throw Exception("Could not create a pipe for parallel retracing: {}", std::strerror(errno));
+
+        pid_t pid = fork();
+        if (pid < 0)
+            throw Exception("Could not fork a retrace worker: {}", std::strerror(errno));
+
+        if (pid == 0) {
+            close(indexFds[1]);
+            close(outputFds[0]);
+            for (const Worker &worker : workers)
+                close(worker.outputFd);
+
+            int status = 1;
+            try {
+                auto nextTrace = [fd = indexFds[0]] () -> std::optional<size_t> {
+                    // Indices are written in 4-byte chunks, and these are atomic for pipes.
+                    uint32_t index;
+                    if (read(fd, &index, sizeof(index)) != sizeof(index))
+                        return std::nullopt;
+                    return index;
+                };
+                auto reportTrace = [fd = outputFds[1]] (std::string_view output) {
+                    uint32_t size = output.size();
+                    if (!writeAll(fd, &size, sizeof(size)) || !writeAll(fd, output.data(), output.size()))
+                        throw Exception("Could not send retrace output to the parent process: {}", std::strerror(errno));
+                };
+                status = retraceTraces(options, nextTrace, reportTrace);
+            } catch (const std::exception &e) {
+                fmt::println(stderr, "{}", e.what());
+            }
+
+            std::fflush(nullptr);
+            _exit(status);
+        }
+
+        close(outputFds[1]);
+        workers.push_back({pid, outputFds[0], {}});
+    }
+    close(indexFds[0]);
+
+    // If all the workers die early, writing the indices will fail with EPIPE. Default SIGPIPE handler would kill us
+    // instead, so it's disabled while we're talking to the workers.
+    struct sigaction ignoreAction = {}, oldAction = {};
+    ignoreAction.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &ignoreAction, &oldAction);
+
+    // Indices are written as the workers read them, while printing the output, so that we don't block on a full pipe
+    // while the workers are blocked on their full output pipes. Closing the index pipe signals the workers that there
+    // are no traces left.
+    uint32_t nextIndex = 0;
+    size_t traceCount = options.retrace.traces.size();
+    int indexFd = indexFds[1];
+    size_t liveWorkers = workers.size();
+    while (liveWorkers > 0) {
+        std::vector<pollfd> pollFds;
+        if (indexFd != -1)
+            pollFds.push_back({indexFd, POLLOUT, 0});
+        for (const Worker &worker : workers)
+            if (worker.outputFd != -1)
+                pollFds.push_back({worker.outputFd, POLLIN, 0});
+
+        if (poll(pollFds.data(), pollFds.size(), -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            throw Exception("Could not poll the retrace workers: {}", std::strerror(errno));
+        }
+
+        if (indexFd != -1 && pollFds.front().revents != 0) {
+            // POLLOUT means there's at least PIPE_BUF bytes free, so this won't block.
+            if (nextIndex == traceCount || !writeAll(indexFd, &nextIndex, sizeof(nextIndex))) {
+                close(indexFd); // EPIPE means all workers are gone, their exit codes will tell what happened.
+                indexFd = -1;
+            } else {
+                nextIndex++;
+            }
+        }
+
+        for (Worker &worker : workers) {
+            if (worker.outputFd == -1)
+                continue;
+
+            auto pos = std::ranges::find(pollFds, worker.outputFd, &pollfd::fd);
+            if (pos->revents == 0)
+                continue;
+
+            char buffer[65536];
+            ssize_t bytesRead = read(worker.outputFd, buffer, sizeof(buffer));
+            if (bytesRead < 0 && errno == EINTR)
+                continue;
+            if (bytesRead <= 0) {
+                close(worker.outputFd);
+                worker.outputFd = -1;
+                liveWorkers--;
+                continue;
+            }
+            worker.buffer.append(buffer, bytesRead);
+
+            // Print out all the complete messages.
+            uint32_t size;
+            while (worker.buffer.size() >= sizeof(size)) {
+                std::memcpy(&size, worker.buffer.data(), sizeof(size));
+                if (worker.buffer.size() < sizeof(size) + size)
+                    break;
+                fmt::print(stderr, "{}", std::string_view(worker.buffer).substr(sizeof(size), size));
+                std::fflush(stderr);
+                worker.buffer.erase(0, sizeof(size) + size);
+            }
+        }
+    }
+    if (indexFd != -1)
+        close(indexFd);
+    sigaction(SIGPIPE, &oldAction, nullptr);
+
+    int status = nextIndex == traceCount ? 0 : 1; // Non-zero if the workers died before picking up all the traces.
+    for (const Worker &worker : workers) {
+        int workerStatus = 0;
+        if (waitpid(worker.pid, &workerStatus, 0) != worker.pid || !WIFEXITED(workerStatus) || WEXITSTATUS(workerStatus) != 0)
+            status = 1;
+        if (WIFSIGNALED(workerStatus))
+            fmt::println(stderr, "Retrace worker {} was killed by signal {}.", worker.pid, WTERMSIG(workerStatus));
+    }
+    return status;
+}
+#endif
+
+int runRetrace(const OpenEnrothOptions &options) {
+    size_t traceCount = options.retrace.traces.size();
+    size_t jobs = options.retrace.jobs == 0 ? std::max(1u, std::thread::hardware_concurrency()) : options.retrace.jobs;
+    jobs = std::min(jobs, traceCount);
+
+#ifdef _WINDOWS
+    if (jobs > 1) {
+        fmt::println(stderr, "Parallel retracing is not supported on Windows, retracing sequentially.");
+        jobs = 1;
+    }
+#endif
+
+    int status = 0;
+    if (jobs <= 1) {
+        size_t next = 0;
+        status = retraceTraces(options, [&] { return next < traceCount ? std::optional(next++) : std::nullopt; },
+                               [] (std::string_view output) { fmt::print(stderr, "{}", output); });
+    } else {
+#ifndef _WINDOWS
+        status = retraceTracesInParallel(options, jobs);
+#endif
+    }
+
     if (options.retrace.checkCanonical && status == 0)
         fmt::println(stderr, "All traces are in canonical representation.");
 
@@ -117,7 +361,7 @@ int runPlay(const OpenEnrothOptions &options) {
         for (const std::string &tracePath : options.play.traces) {
             fmt::println(stderr, "Playing back '{}'...", tracePath);
 
-            std::string savePath = tracePath.substr(0, tracePath.length() - 5) + ".mm7";
+            std::string savePath = std::filesystem::path(tracePath).replace_extension(".mm7").generic_string();
 
             EngineTraceRecording recording;
             recording.save = Blob::fromFile(savePath);
@@ -133,6 +377,21 @@ int runPlay(const OpenEnrothOptions &options) {
     return 0;
 }
 
+int runConvert(const OpenEnrothOptions &options) {
+    Blob input = Blob::fromFile(options.convert.input);
+    bool toBinary = !EventTrace::isBinaryBlob(input);
+
+    EventTrace trace = EventTrace::fromBlob(input, nullptr);
+    Blob output = toBinary ? EventTrace::toBinaryBlob(trace) : EventTrace::toJsonBlob(trace);
+    size_t inputSize = input.size();
+    input = Blob(); // Close the input file, it might be the same as the output one.
+    FileOutputStream(options.convert.output).write(output);
+
+    fmt::println(stderr, "Converted '{}' ({} bytes) into {} trace '{}' ({} bytes).", options.convert.input, inputSize,
+                 toBinary ? "binary" : "JSON", options.convert.output, output.size());
+    return 0;
+}
+
 int runOpenEnroth(const OpenEnrothOptions &options) {
     GameStarter(options).run();
     return 0;
@@ -151,6 +410,7 @@ int openEnrothMain(int argc, char **argv) {
         case OpenEnrothOptions::SUBCOMMAND_GAME: return runOpenEnroth(options);
         case OpenEnrothOptions::SUBCOMMAND_PLAY: return runPlay(options);
         case OpenEnrothOptions::SUBCOMMAND_RETRACE: return runRetrace(options);
+        case OpenEnrothOptions::SUBCOMMAND_CONVERT: return runConvert(options);
         }
     } catch (const std::exception &e) {
         fmt::print(stderr, "{}\n", e.what());
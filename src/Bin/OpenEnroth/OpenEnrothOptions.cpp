@@ -65,14 +65,28 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
     retrace->add_flag(
         "--check-canonical", result.retrace.checkCanonical,
         "Check whether all passed traces are stored in canonical representation and return an error if not. Don't overwrite the actual trace files.");
+    retrace->add_option(
+        "-j,--jobs", result.retrace.jobs,
+        "Number of worker processes to retrace in, each one starts up the engine once and then picks up traces until "
+        "there are none left. Zero means the number of hardware threads. Default is '1'. Not supported on Windows, "
+        "where traces are always retraced sequentially.")->check(CLI::NonNegativeNumber)->option_text("JOBS");
     retrace->add_option(
         "--ls", traceDir,
-        "Directory to look for traces to retrace."); // This is here so that we don't have to jump through hoops in cmake.
+        "Directory to look for traces to retrace, both JSON and binary ones are picked up."); // This is here so that we don't have to jump through hoops in cmake.
     retrace->add_option(
         "TRACE", result.retrace.traces,
         "Path to trace file(s) to retrace.")->option_text("...");
     retrace->set_help_flag("-h,--help", "Print help and exit."); // This places --help last in the command list.
 
+    CLI::App *convert = app->add_subcommand("convert", "Convert a trace between JSON and binary formats and exit.", result.subcommand, SUBCOMMAND_CONVERT)->fallthrough();
+    convert->add_option(
+        "INPUT", result.convert.input,
+        "Path to trace file to convert. JSON traces are converted into binary ones, and vice versa.")->required()->option_text("INPUT");
+    convert->add_option(
+        "OUTPUT", result.convert.output,
+        "Path to write the converted trace to.")->required()->option_text("OUTPUT");
+    convert->set_help_flag("-h,--help", "Print help and exit."); // This places --help last in the command list.
+
     app->parse(argc, argv, result.helpPrinted);
 
     if (!portable && std::filesystem::exists(".portable"))
@@ -89,9 +103,13 @@ OpenEnrothOptions OpenEnrothOptions::parse(int argc, char **argv) {
         result.quickStart = true;
 
         if (!traceDir.empty()) {
-            for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(traceDir))
-                if (entry.path().extension() == ".json")
-                    result.retrace.traces.push_back(entry.path().generic_string());
+            // Traces can be either JSON or binary, so we just pick up everything that has a save file next to it.
+            for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(traceDir)) {
+                std::filesystem::path path = entry.path();
+                if (entry.is_regular_file() && path.extension() != ".mm7" &&
+                    std::filesystem::exists(std::filesystem::path(path).replace_extension(".mm7")))
+                    result.retrace.traces.push_back(path.generic_string());
+            }
             std::ranges::sort(result.retrace.traces); // NOLINT: This is ranges::sort. We want a fixed order.
         }
 
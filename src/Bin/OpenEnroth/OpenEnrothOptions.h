@@ -12,13 +12,15 @@ struct OpenEnrothOptions : public GameStarterOptions {
     enum class Subcommand {
         SUBCOMMAND_GAME,
         SUBCOMMAND_PLAY,
-        SUBCOMMAND_RETRACE
+        SUBCOMMAND_RETRACE,
+        SUBCOMMAND_CONVERT
     };
     using enum Subcommand;
 
     struct RetraceOptions {
         std::vector<std::string> traces;
         bool checkCanonical = false;
+        int jobs = 1; // Number of worker processes, zero means the number of hardware threads.
     };
 
     struct PlayOptions {
@@ -26,10 +28,16 @@ struct OpenEnrothOptions : public GameStarterOptions {
         float speed = 1.0f;
     };
 
+    struct ConvertOptions {
+        std::string input;
+        std::string output;
+    };
+
     Subcommand subcommand = SUBCOMMAND_GAME;
     bool helpPrinted = false; // True means that help message was already printed.
     RetraceOptions retrace;
     PlayOptions play;
+    ConvertOptions convert;
 
     /**
      * Parses OpenEnroth command line options.
@@ -37,7 +37,7 @@ void EngineTracePlayer::playTrace(EngineController *game, const EngineTraceRecor
     assert(!isPlaying());
 
     _flags = flags;
-    _trace = std::make_unique<EventTrace>(EventTrace::fromJsonBlob(recording.trace, application()->window()));
+    _trace = std::make_unique<EventTraceReader>(recording.trace, application()->window());
 
     MM_AT_SCOPE_EXIT({
         _flags = 0;
@@ -45,19 +45,19 @@ void EngineTracePlayer::playTrace(EngineController *game, const EngineTraceRecor
         component<EngineDeterministicComponent>()->finish();
     });
 
-    checkSaveFileSize(recording, _trace->header.saveFileSize);
+    checkSaveFileSize(recording, _trace->header().saveFileSize);
 
     game->resizeWindow(640, 480);
     game->tick();
 
-    EngineTraceStateAccessor::prepareForPlayback(engine->config.get(), _trace->header.config);
+    EngineTraceStateAccessor::prepareForPlayback(engine->config.get(), _trace->header().config);
     int frameTimeMs = engine->config->debug.TraceFrameTimeMs.value();
     RandomEngineType rngType = engine->config->debug.TraceRandomEngine.value();
 
     game->goToMainMenu(); // This might call into a random engine.
     component<EngineDeterministicComponent>()->restart(frameTimeMs, rngType);
     game->loadGame(recording.save);
-    checkAfterLoadRng(recording, _trace->header.afterLoadRandomState);
+    checkAfterLoadRng(recording, _trace->header().afterLoadRandomState);
     component<EngineDeterministicComponent>()->restart(frameTimeMs, rngType);
     component<GameKeyboardController>()->reset(); // Reset all pressed buttons.
 
@@ -70,9 +70,9 @@ void EngineTracePlayer::playTrace(EngineController *game, const EngineTraceRecor
     ramFs.write("saves/!!!save.mm7", recording.save);
     ScopedRollback<FileSystem *> rollback(&ufs, &ramFs);
 
-    checkState(recording, _trace->header.startState, true);
-    component<EngineTraceSimplePlayer>()->playTrace(game, std::move(_trace->events), recording.trace.displayPath(), _flags);
-    checkState(recording, _trace->header.endState, false);
+    checkState(recording, _trace->header().startState, true);
+    component<EngineTraceSimplePlayer>()->playTrace(game, _trace.get(), recording.trace.displayPath(), _flags);
+    checkState(recording, _trace->header().endState, false);
 }
 
 void EngineTracePlayer::checkSaveFileSize(const EngineTraceRecording &recording, int expectedSaveFileSize) {
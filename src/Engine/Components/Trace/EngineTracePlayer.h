@@ -10,7 +10,7 @@
 #include "EngineTraceRecording.h"
 
 class EngineController;
-struct EventTrace;
+class EventTraceReader;
 struct EventTraceGameState;
 
 /**
@@ -50,5 +50,5 @@ class EngineTracePlayer : private PlatformApplicationAware {
 
  private:
     EngineTracePlaybackFlags _flags;
-    std::unique_ptr<EventTrace> _trace;
+    std::unique_ptr<EventTraceReader> _trace;
 };
@@ -9,6 +9,7 @@
 #include "Engine/Random/Random.h"
 
 #include "Library/Platform/Application/PlatformApplication.h"
+#include "Library/Trace/EventTrace.h"
 #include "Library/Trace/PaintEvent.h"
 
 #include "Utility/ScopeGuard.h"
@@ -19,6 +20,20 @@ EngineTraceSimplePlayer::~EngineTraceSimplePlayer() = default;
 
 void EngineTraceSimplePlayer::playTrace(EngineController *game, std::vector<std::unique_ptr<PlatformEvent>> events,
                                         std::string_view traceDisplayPath, EngineTracePlaybackFlags flags) {
+    size_t index = 0;
+    playTraceInternal(game, [&] {
+        return index < events.size() ? std::move(events[index++]) : nullptr;
+    }, traceDisplayPath, flags);
+}
+
+void EngineTraceSimplePlayer::playTrace(EngineController *game, EventTraceReader *reader,
+                                        std::string_view traceDisplayPath, EngineTracePlaybackFlags flags) {
+    playTraceInternal(game, [reader] { return reader->readEvent(); }, traceDisplayPath, flags);
+}
+
+void EngineTraceSimplePlayer::playTraceInternal(EngineController *game,
+                                                const std::function<std::unique_ptr<PlatformEvent>()> &nextEvent,
+                                                std::string_view traceDisplayPath, EngineTracePlaybackFlags flags) {
     assert(!isPlaying());
 
     _playing = true;
@@ -27,7 +42,7 @@ void EngineTraceSimplePlayer::playTrace(EngineController *game, std::vector<std:
     _traceDisplayPath = traceDisplayPath;
     _flags = flags;
 
-    for (std::unique_ptr<PlatformEvent> &event : events) {
+    while (std::unique_ptr<PlatformEvent> event = nextEvent()) {
         if (event->type == EVENT_PAINT) {
             game->tick(1);
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <memory>
@@ -9,6 +10,7 @@
 #include "EngineTraceEnums.h"
 
 class EngineController;
+class EventTraceReader;
 class PaintEvent;
 class PlatformEvent;
 
@@ -35,6 +37,18 @@ class EngineTraceSimplePlayer : private PlatformApplicationAware {
     void playTrace(EngineController *game, std::vector<std::unique_ptr<PlatformEvent>> events,
                    std::string_view traceDisplayPath, EngineTracePlaybackFlags flags);
 
+    /**
+     * Same as above, but pulls the events out of the provided reader as the playback goes, so that the events
+     * don't have to be parsed in advance.
+     *
+     * @param game                      Engine controller.
+     * @param reader                    Trace reader to pull events from.
+     * @param traceDisplayPath          Path to trace file. Used only for error reporting.
+     * @param flags                     Playback flags.
+     */
+    void playTrace(EngineController *game, EventTraceReader *reader, std::string_view traceDisplayPath,
+                   EngineTracePlaybackFlags flags);
+
     bool isPlaying() const {
         return _playing;
     }
@@ -42,6 +56,8 @@ class EngineTraceSimplePlayer : private PlatformApplicationAware {
  private:
     friend class PlatformIntrospection; // Give access to private bases.
 
+    void playTraceInternal(EngineController *game, const std::function<std::unique_ptr<PlatformEvent>()> &nextEvent,
+                           std::string_view traceDisplayPath, EngineTracePlaybackFlags flags);
     void checkTime(const PaintEvent *paintEvent);
     void checkRng(const PaintEvent *paintEvent);
 
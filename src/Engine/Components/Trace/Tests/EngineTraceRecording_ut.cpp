@@ -0,0 +1,35 @@
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Library/FileSystem/Interface/FileSystem.h"
+#include "Library/Trace/EventTrace.h"
+
+GAME_TEST(EngineTraceRecording, BinaryTestDataTraces) {
+    FileSystem *tfs = test.testData();
+
+    int traces = 0;
+    for (const DirectoryEntry &entry : tfs->ls("")) {
+        if (entry.type != FILE_REGULAR || !entry.name.ends_with(".json"))
+            continue;
+        if (!tfs->exists(entry.name.substr(0, entry.name.size() - 5) + ".mm7"))
+            continue;
+
+        // Binary traces must round-trip into exactly the same traces, and be readable event by event.
+        Blob json = tfs->read(entry.name);
+        EventTrace trace = EventTrace::fromJsonBlob(json, nullptr);
+        Blob binary = EventTrace::toBinaryBlob(trace);
+        EXPECT_TRUE(EventTrace::isBinaryBlob(binary));
+        EXPECT_FALSE(EventTrace::isBinaryBlob(json));
+        EXPECT_EQ(EventTrace::toJsonBlob(EventTrace::fromBinaryBlob(binary, nullptr)).string_view(),
+                  EventTrace::toJsonBlob(trace).string_view()) << entry.name;
+
+        EventTraceReader reader(binary, nullptr);
+        size_t events = 0;
+        while (reader.readEvent())
+            events++;
+        EXPECT_EQ(events, trace.events.size()) << entry.name;
+        traces++;
+    }
+    EXPECT_GT(traces, 0);
+}
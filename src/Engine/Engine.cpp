@@ -1,7 +1,9 @@
 #include <cstring>
 #include <string>
 #include <algorithm>
+#include <chrono>
 #include <memory>
+#include <string_view>
 
 #include "Engine/Engine.h"
 
@@ -10,12 +12,14 @@
 
 #include "Engine/Evt/Processor.h"
 #include "Engine/Graphics/Camera.h"
+#include "Engine/Graphics/DecodedImageCache.h"
 #include "Engine/Graphics/DecalBuilder.h"
 #include "Engine/Objects/DecorationList.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/LineOfSightCache.h"
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/BspRenderer.h"
@@ -35,6 +39,7 @@
 #include "Engine/Localization.h"
 #include "Engine/Objects/Actor.h"
 #include "Engine/Objects/Chest.h"
+#include "Engine/Objects/CharacterStatsCache.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/NPC.h"
@@ -43,6 +48,7 @@
 #include "Engine/Party.h"
 #include "Engine/Random/Random.h"
 #include "Engine/SaveLoad.h"
+#include "Engine/Snapshots/TableCache.h"
 #include "Engine/Snapshots/TableSerialization.h"
 #include "Engine/SpellFxRenderer.h"
 #include "Engine/Spells/CastSpellInfo.h"
@@ -60,6 +66,7 @@
 #include "Engine/Tables/TransitionTable.h"
 #include "Engine/Tables/MerchantTable.h"
 #include "Engine/Tables/MessageScrollTable.h"
+#include "Engine/Tables/NPCTable.h"
 #include "Engine/Time/Timer.h"
 #include "Engine/AttackList.h"
 #include "Engine/GameResourceManager.h"
@@ -86,6 +93,7 @@
 #include "Tables/ChestTable.h"
 
 #include "Utility/String/Transformations.h"
+#include "Utility/TaskGraph.h"
 #include "TurnEngine/TurnEngine.h"
 
 /*
@@ -193,7 +201,11 @@ void Engine::drawHUD() {
     // 2d from now on
     render->BeginScene2D();
 
-    DrawGUI();
+    {
+        // Right panel, portraits & status bar only read character stats.
+        CharacterStatsCache::Scope statsScope;
+        DrawGUI();
+    }
     GUI_UpdateWindows();
     pParty->updateCharactersAndHirelingsEmotions();
 
@@ -282,8 +294,25 @@ void Engine::DrawGUI() {
             pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
                                      fmt::format("Party Sector ID:       {}/{} ({})\n", sector_id, pIndoor->pSectors.size(), pBLVRenderParams->uPartyEyeSectorID));
             debug_info_offset += 16;
+
+            size_t losQueries = lineOfSightCache.hits() + lineOfSightCache.misses();
+            pPrimaryWindow->DrawText(assets->pFontArrus.get(), { 16, debug_info_offset }, colorTable.White,
+                                     fmt::format("LOS cache: {}/{} hits ({:.1f}%), saved {:.2f}ms\n", lineOfSightCache.hits(), losQueries,
+                                                 losQueries ? 100.0 * lineOfSightCache.hits() / losQueries : 0.0,
+                                                 std::chrono::duration<double, std::milli>(lineOfSightCache.savedTime()).count()));
+            debug_info_offset += 16;
         }
 
+        size_t statQueries = characterStatsCache.hits() + characterStatsCache.misses();
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), {16, debug_info_offset}, colorTable.White,
+                                 fmt::format("Character stats cache: {}/{} hits ({:.1f}%)", characterStatsCache.hits(),
+                                             statQueries, statQueries ? 100.0 * characterStatsCache.hits() / statQueries : 0.0));
+        debug_info_offset += 16;
+
+        pPrimaryWindow->DrawText(assets->pFontArrus.get(), {16, debug_info_offset}, colorTable.White,
+                                 fmt::format("Decoration trigger checks: {}", decorationTriggerChecks()));
+        debug_info_offset += 16;
+
         std::string floor_level_str;
 
         if (uGameState == GAME_STATE_CHANGE_LOCATION) {
@@ -426,6 +455,7 @@ Engine::Engine(std::shared_ptr<GameConfig> config, OverlaySystem &overlaySystem)
     this->spell_fx_renedrer = EngineIocContainer::ResolveSpellFxRenderer();
     this->mouse = EngineIocContainer::ResolveMouse();
     this->particle_engine = EngineIocContainer::ResolveParticleEngine();
+    this->particle_engine->setCapacity(config->graphics.MaxParticles.value());
     this->vis = EngineIocContainer::ResolveVis();
 
     uNumStationaryLights_in_pStationaryLightsStack = 0;
@@ -604,7 +634,7 @@ void DoPrepareWorld(bool bLoading, int _1_fullscreen_loading_2_box) {
     engine->_transitionMapId = MAP_INVALID;
     onMapLoad();
     pGameLoadingUI_ProgressBar->Progress();
-    memset(&render->pBillboardRenderListD3D, 0, sizeof(render->pBillboardRenderListD3D));
+    render->pBillboardRenderListD3D.clear();
     pGameLoadingUI_ProgressBar->Release();
 }
 
@@ -638,6 +668,22 @@ void MM7_LoadLods() {
     pPaletteManager->load(pBitmaps_LOD);
 }
 
+static void logStartupTimings(std::string_view stage, const TaskGraph &graph) {
+    auto toMs = [](TaskGraph::Clock::duration duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    };
+
+    TaskGraph::Clock::duration serialTime = {};
+    for (const TaskGraph::TaskTiming &timing : graph.timings())
+        serialTime += timing.duration;
+
+    logger->info("{}: startup tasks done in {:.1f}ms, {:.1f}ms if run serially.", stage, toMs(graph.totalTime()),
+                 toMs(serialTime));
+    for (const TaskGraph::TaskTiming &timing : graph.timings())
+        logger->info("    {:<24} {:>7.1f}ms -> {:>7.1f}ms ({:.1f}ms){}", timing.name, toMs(timing.start),
+                     toMs(timing.start + timing.duration), toMs(timing.duration), timing.mainThread ? ", main thread" : "");
+}
+
 //----- (004651F4) --------------------------------------------------------
 void Engine::MM7_Initialize() {
     grng->seed(platform->tickCount());
@@ -671,77 +717,153 @@ void Engine::MM7_Initialize() {
     };
 
     pSpriteFrameTable = new SpriteFrameTable;
-    deserialize(triLoad("dsft.bin"), pSpriteFrameTable);
-
     pTextureFrameTable = new TextureFrameTable;
-    deserialize(triLoad("dtft.bin"), pTextureFrameTable);
-
     pTileTable = new TileTable;
-    deserialize(triLoad("dtile.bin"), pTileTable);
-
     pPortraitFrameTable = new PortraitFrameTable;
-    deserialize(triLoad("dpft.bin"), pPortraitFrameTable);
-
     pIconsFrameTable = new IconFrameTable;
-    deserialize(triLoad("dift.bin"), pIconsFrameTable);
-
     pDecorationList = new DecorationList;
-    deserialize(triLoad("ddeclist.bin"), pDecorationList);
-
     pObjectList = new ObjectList;
-    deserialize(triLoad("dobjlist.bin"), pObjectList);
-
     pMonsterList = new MonsterList;
-    deserialize(triLoad("dmonlist.bin"), pMonsterList);
-
     pOverlayList = new OverlayList;
-    deserialize(triLoad("doverlay.bin"), pOverlayList);
-
     pSoundList = new SoundList;
-    deserialize(triLoad("dsounds.bin"), pSoundList);
 
-    if (!config->debug.NoSound.value())
-        pAudioPlayer->Initialize();
+    // Binary tables are only read from the already opened LODs, so these can be loaded in parallel. Everything that
+    // touches the file systems, audio or video has to stay on the main thread.
+    TaskGraph graph;
+    graph.add("dsft.bin", [&] { deserialize(triLoad("dsft.bin"), pSpriteFrameTable); });
+    graph.add("dtft.bin", [&] { deserialize(triLoad("dtft.bin"), pTextureFrameTable); });
+    TaskGraph::TaskId tiles = graph.add("dtile.bin", [&] { deserialize(triLoad("dtile.bin"), pTileTable); });
+    graph.add("dpft.bin", [&] { deserialize(triLoad("dpft.bin"), pPortraitFrameTable); });
+    graph.add("dift.bin", [&] { deserialize(triLoad("dift.bin"), pIconsFrameTable); });
+    graph.add("ddeclist.bin", [&] { deserialize(triLoad("ddeclist.bin"), pDecorationList); });
+    graph.add("dobjlist.bin", [&] { deserialize(triLoad("dobjlist.bin"), pObjectList); });
+    graph.add("dmonlist.bin", [&] { deserialize(triLoad("dmonlist.bin"), pMonsterList); });
+    graph.add("doverlay.bin", [&] { deserialize(triLoad("doverlay.bin"), pOverlayList); });
+    TaskGraph::TaskId sounds = graph.add("dsounds.bin", [&] { deserialize(triLoad("dsounds.bin"), pSoundList); });
+
+    graph.addMainThread("audio", [&] {
+        if (!config->debug.NoSound.value())
+            pAudioPlayer->Initialize();
+    }, {sounds});
+
+    graph.addMainThread("video", [] {
+        pMediaPlayer = new MPlayer();
+        pMediaPlayer->Initialize();
+    });
+
+    graph.add("generated tiles", [] {
+        pTileGenerator = new TileGenerator();
+        if (engine->config->graphics.GenerateTiles.value())
+            pTileGenerator->fillTable();
+    }, {tiles});
+
+    graph.addMainThread("decoded image cache", [] {
+        if (engine->config->graphics.DecodedImageCache.value())
+            pDecodedImageCache = new DecodedImageCache(ufs);
+    });
+
+    graph.run();
+    logStartupTimings("MM7_Initialize", graph);
 
-    pMediaPlayer = new MPlayer();
-    pMediaPlayer->Initialize();
+    dword_6BE364_game_settings_1 |= GAME_SETTINGS_4000;
+}
 
-    pTileGenerator = new TileGenerator();
-    if (engine->config->graphics.GenerateTiles.value())
-        pTileGenerator->fillTable();
+/**
+ * Loads the provided table from the table cache, or initializes it & stores it in the cache on a cache miss.
+ *
+ * @param cache                         Table cache, can be null.
+ * @param name                          Name of the cache entry.
+ * @param table                         Table to load.
+ * @param initialize                    Function that initializes the table from game data.
+ */
+template<class T, class Initializer>
+static void loadCachedTable(TableCache *cache, std::string_view name, T *table, Initializer &&initialize) {
+    if (cache && cache->load(name, table))
+        return;
 
-    dword_6BE364_game_settings_1 |= GAME_SETTINGS_4000;
+    initialize();
+    if (cache)
+        cache->store(name, *table);
 }
 
 //----- (00465D0B) --------------------------------------------------------
 void Engine::SecondaryInitialization() {
     mouse->Initialize();
 
-    pMapStats = new MapStats();
-    pMapStats->Initialize(engine->_gameResourceManager->getEventsFile("MapStats.txt"));
+    GameResourceManager *resources = engine->_gameResourceManager.get();
 
+    pMapStats = new MapStats();
     pMonsterStats = new MonsterStats();
-    pMonsterStats->Initialize(engine->_gameResourceManager->getEventsFile("monsters.txt"));
-    pMonsterStats->InitializePlacements(engine->_gameResourceManager->getEventsFile("placemon.txt"));
-
     pSpellStats = new SpellStats();
-    pSpellStats->Initialize(engine->_gameResourceManager->getEventsFile("spells.txt"));
-
     pFactionTable = new FactionTable();
-    pFactionTable->Initialize(engine->_gameResourceManager->getEventsFile("hostile.txt"));
-
     pHistoryTable = new HistoryTable();
-    pHistoryTable->Initialize(engine->_gameResourceManager->getEventsFile("history.txt"));
-
     pItemTable = new ItemTable();
-    pItemTable->Initialize(engine->_gameResourceManager.get());
-
-    initializeHouses(engine->_gameResourceManager->getEventsFile("2dEvents.txt"));
+    pNPCStats = new NPCStats();
 
-    //pPaletteManager->SetMistColor(128, 128, 128);
-    //pPaletteManager->RecalculateAll();
-    pObjectList->InitializeSprites();
-    pOverlayList->InitializeSprites();
+    std::unique_ptr<TableCache> tableCache;
+    if (engine->config->debug.TableCache.value()) {
+        // Cache entries are read & written here on the main thread, worker tasks only (de)serialize them.
+        tableCache = std::make_unique<TableCache>(ufs, resources->eventsLodHash());
+        tableCache->readEntries();
+    }
+    TableCache *cache = tableCache.get();
+
+    // Text tables are parsed on worker threads while the main thread is loading UI textures. Text parsers are reentrant
+    // and each one writes into its own table, so the tables are parsed in parallel. The biggest tables can also be
+    // loaded from the table cache, which is faster than parsing.
+    TaskGraph graph;
+    graph.add("MapStats.txt", [=] {
+        loadCachedTable(cache, "mapstats", pMapStats, [=] {
+            pMapStats->Initialize(resources->getEventsFile("MapStats.txt"));
+        });
+    });
+    graph.add("global.evt", [=] { engine->_globalEventMap = EvtProgram::load(resources->getEventsFile("global.evt")); });
+    graph.add("chests", [] { initializeChests(); });
+    graph.add("monsters.txt", [=] {
+        loadCachedTable(cache, "monsters", pMonsterStats, [=] {
+            pMonsterStats->Initialize(resources->getEventsFile("monsters.txt"));
+            pMonsterStats->InitializePlacements(resources->getEventsFile("placemon.txt"));
+        });
+    });
+    graph.add("spells.txt", [=] {
+        loadCachedTable(cache, "spells", pSpellStats, [=] {
+            pSpellStats->Initialize(resources->getEventsFile("spells.txt"));
+        });
+        pSpellStats->applySpellDataFlags();
+    });
+    graph.add("hostile.txt", [=] { pFactionTable->Initialize(resources->getEventsFile("hostile.txt")); });
+    graph.add("history.txt", [=] { pHistoryTable->Initialize(resources->getEventsFile("history.txt")); });
+    TaskGraph::TaskId items = graph.add("items", [=] {
+        loadCachedTable(cache, "items", pItemTable, [=] { pItemTable->Initialize(resources); });
+        Item::PopulateSpecialBonusMap();
+        Item::PopulateArtifactBonusMap();
+    });
+    graph.addMainThread("item sizes", [] { pItemTable->LoadItemSizes(); }, {items});
+    graph.add("2dEvents.txt", [=] { initializeHouses(resources->getEventsFile("2dEvents.txt")); });
+    graph.add("npcs", [=] {
+        // NPC topics are a separate global, but are initialized together with the rest of the NPC tables.
+        if (cache && cache->load("npcs", pNPCStats) && cache->load("npctopics", &pNPCTopics))
+            return;
+
+        pNPCStats->Initialize(resources);
+        if (cache) {
+            cache->store("npcs", *pNPCStats);
+            cache->store("npctopics", pNPCTopics);
+        }
+    });
+    graph.add("quests.txt", [=] { initializeQuests(resources->getEventsFile("quests.txt")); });
+    graph.add("autonote.txt", [=] { initializeAutonotes(resources->getEventsFile("autonote.txt")); });
+    graph.add("awards.txt", [=] { initializeAwards(resources->getEventsFile("awards.txt")); });
+    graph.add("trans.txt", [=] { initializeTransitions(resources->getEventsFile("trans.txt")); });
+    graph.add("merchant.txt", [=] { initializeMerchants(resources->getEventsFile("merchant.txt")); });
+    graph.add("scroll.txt", [=] { initializeMessageScrolls(resources->getEventsFile("scroll.txt")); });
+
+    graph.addMainThread("sprites", [] {
+        //pPaletteManager->SetMistColor(128, 128, 128);
+        //pPaletteManager->RecalculateAll();
+        pObjectList->InitializeSprites();
+        pOverlayList->InitializeSprites();
+    });
 
     // TODO(captainurist): try resurrecting the food / gold animations using resource files from MM6?
     //for (unsigned i = 0; i < 4; ++i) {
@@ -758,28 +880,25 @@ void Engine::SecondaryInitialization() {
     //}
 
     // TODO(pskelton): dropping this causes std::bad_alloc in headless mode
-    UI_Create();
+    graph.addMainThread("UI", [] { UI_Create(); });
 
-    spell_fx_renedrer->LoadAnimations();
+    graph.addMainThread("spell animations", [this] {
+        spell_fx_renedrer->LoadAnimations();
 
-    for (unsigned i = 0; i < 7; ++i) {
-        std::string container_name = fmt::format("HDWTR{:03}", i);
-        render->hd_water_tile_anim[i] = assets->getBitmap(container_name);
+        for (unsigned i = 0; i < 7; ++i) {
+            std::string container_name = fmt::format("HDWTR{:03}", i);
+            render->hd_water_tile_anim[i] = assets->getBitmap(container_name);
+        }
+    });
+
+    graph.run();
+    logStartupTimings("SecondaryInitialization", graph);
+    if (tableCache) {
+        tableCache->flush();
+        logger->info("Table cache: {} hits, {} misses.", tableCache->hits(), tableCache->misses());
+        _tableCacheStats = {tableCache->size(), tableCache->hits(), tableCache->misses()};
     }
 
-    pNPCStats = new NPCStats();
-    pNPCStats->Initialize(engine->_gameResourceManager.get());
-
-    initializeQuests(engine->_gameResourceManager->getEventsFile("quests.txt"));
-    initializeAutonotes(engine->_gameResourceManager->getEventsFile("autonote.txt"));
-    initializeAwards(engine->_gameResourceManager->getEventsFile("awards.txt"));
-    initializeTransitions(engine->_gameResourceManager->getEventsFile("trans.txt"));
-    initializeMerchants(engine->_gameResourceManager->getEventsFile("merchant.txt"));
-    initializeMessageScrolls(engine->_gameResourceManager->getEventsFile("scroll.txt"));
-    initializeChests();
-
-    engine->_globalEventMap = EvtProgram::load(engine->_gameResourceManager->getEventsFile("global.evt"));
-
     pBitmaps_LOD->reserveLoadedTextures();
     pSprites_LOD->reserveLoadedSprites();
 
@@ -844,7 +963,7 @@ void Engine::ResetCursor_Palettes_LODs_Level_Audio_SFT_Windows() {
     }
 
     // Render billboards are used in hit tests, but we're releasing textures, so can't use them anymore.
-    render->uNumBillboardsToDraw = 0;
+    render->pBillboardRenderListD3D.clear();
 
     pBitmaps_LOD->releaseUnreserved();
     pSprites_LOD->releaseUnreserved();
@@ -990,6 +1109,7 @@ void setFacesBit(int sCogNumber, FaceAttribute bit, int on) {
                         } else {
                             face.uAttributes &= ~bit;
                         }
+                        pOutdoor->collisionMesh.setAttributes(model.index, face.index, face.uAttributes);
                     }
                 }
             }
@@ -57,6 +57,15 @@ using enum GameState;
 
 extern GameState uGameState;
 
+/**
+ * Table cache stats for the last startup, see `TableCache`. All zeros if the table cache is disabled.
+ */
+struct TableCacheStats {
+    size_t entries = 0; // Number of cache entries that were found on startup.
+    size_t hits = 0;
+    size_t misses = 0;
+};
+
 struct PersistentVariables {
     std::array<unsigned char, 75> mapVars;
     std::array<unsigned char, 125> decorVars;
@@ -129,6 +138,7 @@ class Engine {
     MapId _currentLoadedMapId = MAP_INVALID;
     MapId _transitionMapId = MAP_INVALID;
     TeleportPoint _teleportPoint;
+    TableCacheStats _tableCacheStats;
     OverlaySystem &_overlaySystem;
 
     std::unique_ptr<GUIMessageQueue> _messageQueue;
@@ -1,4 +1,5 @@
 #include <string>
+#include <string_view>
 #include <utility>
 #include <functional>
 
@@ -111,20 +112,11 @@ static tl::generator<Character &> iterateCharacters(EvtTargetCharacter who, Rand
 }
 
 int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
-    EvtInstruction ir;
-    bool stepFound = false;
-
-    for (const EvtInstruction &irTmp : _events) {
-        if (irTmp.step == step) {
-            ir = irTmp;
-            stepFound = true;
-            break;
-        }
-    }
-
-    if (!stepFound) {
+    const EvtInstruction *irPtr = _function ? _function->instruction(step) : nullptr;
+    if (!irPtr) {
         return -1;
     }
+    const EvtInstruction &ir = *irPtr;
 
     // In NPC mode must process only NPC dialogue related events plus Exit
     if (isNpc) {
@@ -185,13 +177,17 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
             break;
         case EVENT_MoveToMap:
         {
+            // Program is shared between invocations, so hacks below shouldn't modify the instruction.
+            std::string_view mapName = ir.str;
+            int moveZ = ir.data.move_map_descr.z;
+
             if (ir.data.move_map_descr.house_id != HOUSE_INVALID || ir.data.move_map_descr.exit_pic_id) {
                 // TODO(pskelton): Fix #1890 this should be a data mod
                 if (engine->_indoor->filename == "d20.blv" && _eventId == 501)
-                    ir.data.move_map_descr.z = 3088;
+                    moveZ = 3088;
 
                 pDialogueWindow = new GUIWindow_IndoorEntryExit(ir.data.move_map_descr.house_id, ir.data.move_map_descr.exit_pic_id,
-                                                                Vec3f(ir.data.move_map_descr.x, ir.data.move_map_descr.y, ir.data.move_map_descr.z),
+                                                                Vec3f(ir.data.move_map_descr.x, ir.data.move_map_descr.y, moveZ),
                                                                 ir.data.move_map_descr.yaw, ir.data.move_map_descr.pitch, ir.data.move_map_descr.zspeed, ir.str);
                 savedEventID = _eventId;
                 savedEventStep = step + 1;
@@ -206,9 +202,9 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
 
             // TODO(pskelton): Fix #2117 this should be a data mod
             if (engine->_indoor->filename == "d25.blv" && _eventId == 451 && ir.step == 1)
-                ir.str = "out06.odm";
+                mapName = "out06.odm";
 
-            if (ir.str[0] == '0') { // teleport within map
+            if (mapName.starts_with('0')) { // teleport within map
                 if (engine->_teleportPoint.isValid()) {
                     engine->_teleportPoint.doTeleport(false);
                     engine->_teleportPoint.invalidate();
@@ -216,7 +212,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
                 }
             } else {
                 pGameLoadingUI_ProgressBar->Initialize((GUIProgressBar::Type)((activeLevelDecoration == NULL) + 1));
-                Transition_StopSound_Autosave(ir.str, MAP_START_POINT_PARTY);
+                Transition_StopSound_Autosave(mapName, MAP_START_POINT_PARTY);
                 _mapExitTriggered = true;
                 if (current_screen_type == SCREEN_HOUSE) {
                     if (uGameState == GAME_STATE_CHANGE_LOCATION) {
@@ -595,7 +591,7 @@ int EvtInterpreter::executeOneEvent(int step, bool isNpc) {
 bool EvtInterpreter::executeRegular(int startStep) {
     assert(startStep >= 0);
 
-    if (!_eventId || !_events.size()) {
+    if (!_eventId || !isValid()) {
         return false;
     }
 
@@ -617,7 +613,7 @@ bool EvtInterpreter::executeNpcDialogue(int startStep) {
         return false;
     }
 
-    if (!_events.size()) {
+    if (!isValid()) {
         // No event commands found for current eventId
         // In this case dialogue elements can be showed
         return true;
@@ -640,12 +636,12 @@ void EvtInterpreter::prepare(const EvtProgram &eventMap, int eventId, Pid object
     _canShowMessages = canShowMessages;
     _objectPid = objectPid;
 
-    _events.clear();
+    _function = nullptr;
     if (eventMap.hasEvent(eventId)) {
-        _events = eventMap.function(eventId);
+        _function = &eventMap.function(eventId);
     }
 }
 
 bool EvtInterpreter::isValid() {
-    return _events.size() > 0;
+    return _function && !_function->empty();
 }
@@ -14,6 +14,15 @@ class EvtInterpreter {
      bool executeRegular(int startStep);
      bool executeNpcDialogue(int startStep);
 
+     /**
+      * Prepares the interpreter for executing an event. Nothing is copied, interpreter executes the event directly
+      * from the provided program, so it must outlive the calls to `executeRegular` / `executeNpcDialogue`.
+      *
+      * @param eventMap                 Program to execute the event from.
+      * @param eventId                  Event id.
+      * @param objectPid                Object that triggered the event.
+      * @param canShowMessages          Whether the event can show status bar messages.
+      */
      void prepare(const EvtProgram &eventMap, int eventId, Pid objectPid, bool canShowMessages);
      bool isValid();
 
@@ -22,7 +31,7 @@ class EvtInterpreter {
 
  private:
      int _eventId = 0;
-     std::vector<EvtInstruction> _events;
+     const EvtFunction *_function = nullptr;
      Pid _objectPid = Pid();
      bool _canShowMessages = false;
      bool _canShowOption = true;
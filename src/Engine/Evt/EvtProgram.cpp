@@ -37,8 +37,21 @@ EvtProgram EvtProgram::load(const Blob &rawData) {
     return result;
 }
 
+void EvtFunction::add(EvtInstruction ir) {
+    // Instructions with negative steps are never executed, see EvtInstruction::parse. For duplicate steps the first
+    // instruction wins, same as with a linear search.
+    if (ir.step >= 0) {
+        if (static_cast<size_t>(ir.step) >= _indexByStep.size())
+            _indexByStep.resize(ir.step + 1, -1);
+        if (_indexByStep[ir.step] == -1)
+            _indexByStep[ir.step] = _instructions.size();
+    }
+
+    _instructions.push_back(std::move(ir));
+}
+
 void EvtProgram::add(int eventId, EvtInstruction ir) {
-    _eventsById[eventId].push_back(std::move(ir));
+    _eventsById[eventId].add(std::move(ir));
 }
 
 void EvtProgram::clear() {
@@ -46,13 +59,13 @@ void EvtProgram::clear() {
 }
 
 const EvtInstruction &EvtProgram::instruction(int eventId, int step) const {
-    for (const EvtInstruction &ir : function(eventId))
-        if (ir.step == step)
-            return ir;
-    throw Exception("Event {}:{} not found", eventId, step);
+    const EvtInstruction *result = function(eventId).instruction(step);
+    if (!result)
+        throw Exception("Event {}:{} not found", eventId, step);
+    return *result;
 }
 
-const std::vector<EvtInstruction>& EvtProgram::function(int eventId) const {
+const EvtFunction &EvtProgram::function(int eventId) const {
     const auto *result = valuePtr(_eventsById, eventId);
     if (!result)
         throw Exception("Event {} not found", eventId);
@@ -85,7 +98,7 @@ bool EvtProgram::hasHint(int eventId) const {
     if (!events || events->size() < 2)
         return false;
 
-    return (*events)[0].opcode == EVENT_MouseOver && (*events)[1].opcode == EVENT_Exit;
+    return events->instructions()[0].opcode == EVENT_MouseOver && events->instructions()[1].opcode == EVENT_Exit;
 }
 
 std::string EvtProgram::hint(int eventId) const {
@@ -13,6 +13,52 @@ struct EventTrigger {
     int eventStep;
 };
 
+/**
+ * Instructions of a single event script.
+ *
+ * Scripts address instructions by step numbers, and steps aren't necessarily contiguous, so step -> instruction index
+ * table is maintained as instructions are added. This way both sequential execution and jumps are O(1).
+ */
+class EvtFunction {
+ public:
+    void add(EvtInstruction ir);
+
+    /**
+     * @param step                      Step in the script.
+     * @return                          Pointer to the first instruction with the given `step`, or `nullptr` if there
+     *                                  is no such instruction.
+     */
+    [[nodiscard]] const EvtInstruction *instruction(int step) const {
+        if (step < 0 || static_cast<size_t>(step) >= _indexByStep.size() || _indexByStep[step] == -1)
+            return nullptr;
+        return &_instructions[_indexByStep[step]];
+    }
+
+    [[nodiscard]] const std::vector<EvtInstruction> &instructions() const {
+        return _instructions;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _instructions.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _instructions.empty();
+    }
+
+    [[nodiscard]] auto begin() const {
+        return _instructions.begin();
+    }
+
+    [[nodiscard]] auto end() const {
+        return _instructions.end();
+    }
+
+ private:
+    std::vector<EvtInstruction> _instructions;
+    std::vector<int> _indexByStep; // Step -> index into `_instructions`, -1 for missing steps.
+};
+
 class EvtProgram {
  public:
     static EvtProgram load(const Blob &rawData);
@@ -34,10 +80,11 @@ class EvtProgram {
 
     /**
      * @param eventId                   Event id.
-     * @return                          Reference to a list of events for the provided `eventId`.
+     * @return                          Reference to a list of events for the provided `eventId`. Reference stays
+     *                                  valid until this program is modified or destroyed.
      * @throws Exception                If there are no events for the provided `eventId`.
      */
-    const std::vector<EvtInstruction>& function(int eventId) const;
+    const EvtFunction &function(int eventId) const;
 
     /**
      * @param triggerType               Event type to look for.
@@ -63,5 +110,5 @@ class EvtProgram {
     void dump(int eventId) const;
 
  private:
-    std::unordered_map<int, std::vector<EvtInstruction>> _eventsById;
+    std::unordered_map<int, EvtFunction> _eventsById;
 };
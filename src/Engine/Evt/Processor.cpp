@@ -1,5 +1,7 @@
 #include "Processor.h"
 
+#include <cmath>
+#include <limits>
 #include <vector>
 #include <string>
 
@@ -11,6 +13,7 @@
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/Actor.h"
+#include "Engine/Objects/ObjectGrid.h"
 #include "Engine/Evt/EvtProgram.h"
 #include "Engine/Evt/EvtInstruction.h"
 #include "Engine/Evt/EvtInterpreter.h"
@@ -35,7 +38,13 @@ static std::vector<EventTrigger> onMapLeaveTriggers;
 static std::vector<MapTimer> onLongTimerTriggers;
 static std::vector<MapTimer> onTimerTriggers;
 
-static std::vector<int> decorationsWithEvents;
+struct DecorationTrigger {
+    int decorationId = 0;
+    float triggerRangeSqr = 0; // `lengthSqr() < triggerRangeSqr` is equivalent to `length() < uTriggerRange`.
+};
+
+static std::vector<DecorationTrigger> decorationsWithEvents;
+static int decorationTriggerChecksLastFrame = 0;
 
 // Was in original code and ensures that timers are checked not more often than 30 game seconds.
 // Do not needed in practice but can be considered optimization to avoid checking timers too often.
@@ -45,43 +54,106 @@ int savedEventID;
 int savedEventStep;
 LevelDecoration *savedDecoration;
 
+/**
+ * @param range                         Trigger range.
+ * @return                              Smallest squared distance `d` such that `std::sqrt(d) >= range`. Comparing
+ *                                      squared distances against it matches the original `sqrt`-based checks exactly,
+ *                                      including the rounding at the boundary.
+ */
+static float triggerRangeSqr(float range) {
+    float result = range * range;
+    while (std::sqrt(result) < range)
+        result = std::nextafter(result, std::numeric_limits<float>::infinity());
+    while (result > 0 && std::sqrt(std::nextafter(result, 0.0f)) >= range)
+        result = std::nextafter(result, 0.0f);
+    return result;
+}
+
 void initDecorationEvents() {
     DecorationId id = pDecorationList->GetDecorIdByName("Event Trigger");
 
     decorationsWithEvents.clear();
     for (int i = 0; i < pLevelDecorations.size(); ++i) {
         if (pLevelDecorations[i].uDecorationDescID == id) {
-            decorationsWithEvents.push_back(i);
+            decorationsWithEvents.push_back({i, triggerRangeSqr(pLevelDecorations[i].uTriggerRange)});
         }
     }
 }
 
 void checkDecorationEvents() {
-    for (int decorationId : decorationsWithEvents) {
-        const LevelDecoration &decoration = pLevelDecorations[decorationId];
+    // Monster & object triggered decorations only look at the entities inside their trigger boxes. Grids are built
+    // lazily. Events can spawn new entities, and with sprite objects these usually go into freed slots that are still
+    // in the grid under the positions of the dead objects. So once an event fires, the grids are considered stale and
+    // are rebuilt for the next trigger, and the rest of the current trigger's entities are checked w/o the grid, in
+    // the same order as the original loop.
+    static std::vector<Vec3f> positions;
+    static ObjectGrid actorGrid;
+    static ObjectGrid spriteObjectGrid;
+    bool actorGridValid = false;
+    bool spriteObjectGridValid = false;
+    int checks = 0;
+
+    auto isInRange = [&](const DecorationTrigger &trigger, const Vec3f &pos) {
+        checks++;
+        return (pLevelDecorations[trigger.decorationId].vPosition - pos).lengthSqr() < trigger.triggerRangeSqr;
+    };
+
+    auto fireEvent = [&](int eventId, Pid targetObj) {
+        eventProcessor(eventId, targetObj, 1);
+        actorGridValid = false;
+        spriteObjectGridValid = false;
+    };
+
+    auto checkEntities = [&](const DecorationTrigger &trigger, const auto &entities, auto &&positionOf, ObjectGrid *grid,
+                             bool *gridValid) {
+        const LevelDecoration &decoration = pLevelDecorations[trigger.decorationId];
+
+        if (!*gridValid) {
+            positions.clear();
+            for (const auto &entity : entities)
+                positions.push_back(positionOf(entity));
+            grid->build(positions);
+            *gridValid = true;
+        }
+
+        // Entities past the end of the grid were spawned after it was built, these are always checked.
+        int next = grid->size();
+        for (int i : grid->query(BBoxf::cubic(decoration.vPosition, decoration.uTriggerRange + 1.0f))) {
+            if (isInRange(trigger, positionOf(entities[i]))) {
+                fireEvent(decoration.uEventID, Pid());
+                next = i + 1;
+                break;
+            }
+        }
+        for (int i = next; i < entities.size(); i++)
+            if (isInRange(trigger, positionOf(entities[i])))
+                fireEvent(decoration.uEventID, Pid());
+    };
+
+    for (const DecorationTrigger &trigger : decorationsWithEvents) {
+        const LevelDecoration &decoration = pLevelDecorations[trigger.decorationId];
 
         if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_TOUCH) {
-            if ((decoration.vPosition - pParty->pos).length() < decoration.uTriggerRange) {
-                eventProcessor(decoration.uEventID, Pid(OBJECT_Decoration, decorationId), 1);
+            if (isInRange(trigger, pParty->pos)) {
+                fireEvent(decoration.uEventID, Pid(OBJECT_Decoration, trigger.decorationId));
             }
         }
 
         if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_MONSTER) {
-            for (int i = 0; i < pActors.size(); i++) {
-                if ((decoration.vPosition - pActors[i].pos).length() < decoration.uTriggerRange) {
-                    eventProcessor(decoration.uEventID, Pid(), 1);
-                }
-            }
+            checkEntities(trigger, pActors, [](const Actor &actor) { return actor.pos; }, &actorGrid, &actorGridValid);
         }
 
         if (decoration.uFlags & LEVEL_DECORATION_TRIGGERED_BY_OBJECT) {
-            for (int i = 0; i < pSpriteObjects.size(); i++) {
-                if ((decoration.vPosition - pSpriteObjects[i].vPosition).length() < decoration.uTriggerRange) {
-                    eventProcessor(decoration.uEventID, Pid(), 1);
-                }
-            }
+            checkEntities(trigger, pSpriteObjects, [](const SpriteObject &spriteObject) { return spriteObject.vPosition; },
+                          &spriteObjectGrid, &spriteObjectGridValid);
         }
     }
+
+    decorationTriggerChecksLastFrame = checks;
+}
+
+int decorationTriggerChecks() {
+    return decorationTriggerChecksLastFrame;
 }
 
 static void registerTimerTriggers(EvtOpcode triggerType, std::vector<MapTimer> *triggers) {
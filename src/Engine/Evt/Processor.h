@@ -16,6 +16,12 @@ void initDecorationEvents();
  */
 void checkDecorationEvents();
 
+/**
+ * @return                              Number of trigger range checks done in the last call to
+ *                                      `checkDecorationEvents`.
+ */
+int decorationTriggerChecks();
+
 void eventProcessor(int eventId, Pid targetObj, bool canShowMessages, int startStep = 0);
 bool npcDialogueEventProcessor(int eventId, int startStep = 0);
 bool hasEventHint(int eventId);
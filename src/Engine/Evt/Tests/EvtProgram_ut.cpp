@@ -0,0 +1,36 @@
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Evt/EvtProgram.h"
+#include "Engine/Engine.h"
+#include "Engine/GameResourceManager.h"
+#include "Engine/MapInfo.h"
+
+GAME_TEST(EvtProgram, StepLookup) {
+    std::vector<std::string> names = {"global.evt"};
+    for (const MapInfo &info : pMapStats->pInfos)
+        if (!info.fileName.empty())
+            names.push_back(fmt::format("{}.evt", info.fileName.substr(0, info.fileName.rfind('.'))));
+
+    // Step lookups must return the first instruction with the given step, same as a linear search.
+    int events = 0;
+    for (const std::string &name : names) {
+        EvtProgram program = EvtProgram::load(engine->_gameResourceManager->getEventsFile(name));
+        for (int eventId = 0; eventId <= UINT16_MAX; eventId++) {
+            if (!program.hasEvent(eventId))
+                continue;
+
+            events++;
+            const EvtFunction &function = program.function(eventId);
+            for (const EvtInstruction &ir : function) {
+                auto pos = std::ranges::find(function.instructions(), ir.step, &EvtInstruction::step);
+                EXPECT_EQ(function.instruction(ir.step), ir.step >= 0 ? &*pos : nullptr) << name << ":" << eventId;
+            }
+        }
+    }
+    EXPECT_GT(events, 0);
+}
@@ -0,0 +1,100 @@
+#include <utility>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Evt/EvtInstruction.h"
+#include "Engine/Evt/EvtProgram.h"
+#include "Engine/Evt/Processor.h"
+#include "Engine/Objects/Decoration.h"
+#include "Engine/Objects/DecorationList.h"
+#include "Engine/Objects/ObjectList.h"
+#include "Engine/Objects/SpriteObject.h"
+#include "Engine/Objects/SpriteObjectSlots.h"
+#include "Engine/Engine.h"
+
+#include "Utility/ScopeGuard.h"
+
+static void addSummonEvent(int eventId, SpriteId sprite, Vec3f pos) {
+    EvtInstruction summon;
+    summon.opcode = EVENT_SummonItem;
+    summon.step = 0;
+    summon.data.summon_item_descr.sprite = sprite;
+    summon.data.summon_item_descr.x = pos.x;
+    summon.data.summon_item_descr.y = pos.y;
+    summon.data.summon_item_descr.z = pos.z;
+    summon.data.summon_item_descr.speed = 0;
+    summon.data.summon_item_descr.count = 1;
+    summon.data.summon_item_descr.random_rotate = false;
+    engine->_localEventMap.add(eventId, summon);
+
+    EvtInstruction exit;
+    exit.opcode = EVENT_Exit;
+    exit.step = 1;
+    engine->_localEventMap.add(eventId, exit);
+}
+
+static LevelDecoration makeObjectTrigger(int eventId, Vec3f pos) {
+    LevelDecoration result;
+    result.uDecorationDescID = pDecorationList->GetDecorIdByName("Event Trigger");
+    result.uFlags = LEVEL_DECORATION_TRIGGERED_BY_OBJECT;
+    result.vPosition = pos;
+    result.uEventID = eventId;
+    result.uTriggerRange = 100;
+    return result;
+}
+
+GAME_TEST(Processor, DecorationEventSpawnsIntoReusedSlot) {
+    game.startNewGame();
+
+    EvtProgram oldEventMap = engine->_localEventMap;
+    std::vector<LevelDecoration> oldDecorations = pLevelDecorations;
+    std::vector<SpriteObject> oldSpriteObjects = std::move(pSpriteObjects);
+    auto guard = ScopeGuard([&] {
+        engine->_localEventMap = std::move(oldEventMap);
+        pLevelDecorations = std::move(oldDecorations);
+        pSpriteObjects = std::move(oldSpriteObjects);
+        spriteObjectSlots.rebuild(pSpriteObjects);
+        initDecorationEvents();
+    });
+
+    constexpr SpriteId sprite = SPRITE_REAGENT_WIDOWSWEEP;
+    ASSERT_NE(pObjectList->ObjectIDByItemID(sprite), 0);
+
+    // Far away from everything else on the map, so that other trigger decorations don't get in the way.
+    Vec3f deadPos(-30000, -30000, 0);
+    Vec3f firstPos(-30000, -29000, 0);
+    Vec3f secondPos(-30000, -28000, 0);
+    Vec3f resultPos(-30000, -27000, 0);
+
+    // Object in the first trigger fires an event that spawns an object in the second trigger, which then spawns an
+    // object at resultPos. Slot 0 is free, so the object spawned by the first event goes there, into a slot that's
+    // already in the grid under the position of the dead object.
+    int firstEventId = 60000;
+    int secondEventId = 60001;
+    ASSERT_FALSE(engine->_localEventMap.hasEvent(firstEventId));
+    ASSERT_FALSE(engine->_localEventMap.hasEvent(secondEventId));
+    addSummonEvent(firstEventId, sprite, secondPos);
+    addSummonEvent(secondEventId, sprite, resultPos);
+
+    pLevelDecorations.push_back(makeObjectTrigger(firstEventId, firstPos));
+    pLevelDecorations.push_back(makeObjectTrigger(secondEventId, secondPos));
+    initDecorationEvents();
+
+    pSpriteObjects.clear();
+    pSpriteObjects.resize(2);
+    pSpriteObjects[0].vPosition = deadPos;
+    pSpriteObjects[1].uType = sprite;
+    pSpriteObjects[1].uObjectDescID = pObjectList->ObjectIDByItemID(sprite);
+    pSpriteObjects[1].vPosition = firstPos;
+    spriteObjectSlots.rebuild(pSpriteObjects);
+
+    checkDecorationEvents();
+
+    // Second trigger must see the object in the reused slot, same as the brute force loop would.
+    ASSERT_EQ(pSpriteObjects.size(), 3);
+    EXPECT_NE(pSpriteObjects[0].uObjectDescID, 0);
+    EXPECT_EQ(pSpriteObjects[0].vPosition, secondPos);
+    EXPECT_NE(pSpriteObjects[2].uObjectDescID, 0);
+    EXPECT_EQ(pSpriteObjects[2].vPosition, resultPos);
+}
@@ -1,15 +1,20 @@
 #include "GameResourceManager.h"
 
+#include <utility>
+
 #include "Engine.h"
 #include "EngineFileSystem.h"
 
+#include "Library/Compression/Compression.h"
 #include "Library/LodFormats/LodFormats.h"
 
 GameResourceManager::GameResourceManager() = default;
 GameResourceManager::~GameResourceManager() = default;
 
 void GameResourceManager::openGameResources() {
-    _eventsLodReader.open(dfs->read("data/events.lod"));
+    Blob eventsLod = dfs->read("data/events.lod");
+    _eventsLodHash = zlib::crc32(eventsLod);
+    _eventsLodReader.open(std::move(eventsLod));
     // TODO(captainurist):
     //  on exception:
     //      Error(localization->GetString(LSTR_MIGHT_AND_MAGIC_VII_IS_HAVING_TROUBLE), localization->GetString(LSTR_REINSTALL_NECESSARY));
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 #include "Utility/Memory/Blob.h"
@@ -15,6 +16,15 @@ class GameResourceManager {
 
     Blob getEventsFile(std::string_view filename);
 
+    /**
+     * @return                          CRC-32 of `events.lod`. Can be used to check whether data derived from the
+     *                                  events files is still up to date.
+     */
+    [[nodiscard]] uint32_t eventsLodHash() const {
+        return _eventsLodHash;
+    }
+
  private:
     LodReader _eventsLodReader;
+    uint32_t _eventsLodHash = 0;
 };
@@ -0,0 +1,32 @@
+#include "BillboardRenderList.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+RenderBillboardD3D &BillboardRenderList::add(float z) {
+    // NaNs would break the ordering, so these go to the far end.
+    if (std::isnan(z))
+        z = std::numeric_limits<float>::infinity();
+
+    _keys.push_back({z, static_cast<int>(_billboards.size())});
+    return _billboards.emplace_back();
+}
+
+void BillboardRenderList::clear() {
+    _billboards.clear();
+    _keys.clear();
+    _sortedSize = 0;
+}
+
+void BillboardRenderList::sort() {
+    // Keys are unique, so there's no need for a stable sort. Later billboards go first for equal z.
+    auto less = [](const SortKey &l, const SortKey &r) {
+        return l.z < r.z || (l.z == r.z && l.index > r.index);
+    };
+
+    auto middle = _keys.begin() + _sortedSize;
+    std::sort(middle, _keys.end(), less);
+    std::inplace_merge(_keys.begin(), middle, _keys.end(), less);
+    _sortedSize = _keys.size();
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+
+#include "Engine/Graphics/RenderEntities.h"
+
+/**
+ * List of hardware billboards to draw in the current frame.
+ *
+ * Billboards are appended to a flat list in the order they are produced, and a compact array of `(z, index)` keys
+ * is sorted only when the list is accessed by index. Billboards added after the list was sorted are sorted separately
+ * and merged in. This way adding a billboard is O(1) and doesn't move any of the (large) billboard structs around.
+ *
+ * Indexed access returns billboards ordered by ascending z. Billboards with equal z are ordered from the most recently
+ * added to the least recently added one, which is what the original insertion-based code did.
+ */
+class BillboardRenderList {
+ public:
+    /**
+     * @param z                         Z order of the new billboard. Callers are expected to also store it in
+     *                                  `RenderBillboardD3D::z_order`.
+     * @return                          Newly added default-constructed billboard. Returned reference is valid until
+     *                                  the next call to `add` or `clear`.
+     */
+    RenderBillboardD3D &add(float z);
+
+    void clear();
+
+    [[nodiscard]] int size() const {
+        return _billboards.size();
+    }
+
+    /**
+     * @param index                     Index in the sorted list, in `[0, size())`.
+     * @return                          Billboard at the provided position in z order.
+     */
+    [[nodiscard]] RenderBillboardD3D &operator[](int index) {
+        if (_sortedSize != _keys.size())
+            sort();
+        return _billboards[_keys[index].index];
+    }
+
+ private:
+    struct SortKey {
+        float z;
+        int index; // Index into `_billboards`.
+    };
+
+    void sort();
+
+ private:
+    std::vector<RenderBillboardD3D> _billboards;
+    std::vector<SortKey> _keys;
+    size_t _sortedSize = 0; // Size of the sorted prefix of `_keys`.
+};
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <span>
 #include <utility>
 
 #include "Engine/Evt/Processor.h"
@@ -79,6 +80,44 @@ static bool CollideWithLine(const Vec3f p1, const Vec3f p2, const float radius,
     return false;
 }
 
+/**
+ * Indoor face adapter for the templated collision functions below.
+ */
+class IndoorCollisionFace {
+ public:
+    explicit IndoorCollisionFace(const BLVFace *face) : _face(face) {}
+
+    [[nodiscard]] const Planef &plane() const { return _face->facePlane; }
+    [[nodiscard]] const BBoxf &bbox() const { return _face->pBounding; }
+    [[nodiscard]] FaceAttributes attributes() const { return _face->uAttributes; }
+    [[nodiscard]] int numVertices() const { return _face->uNumVertices; }
+    [[nodiscard]] const Vec3f &vertex(int index) const { return pIndoor->pVertices[_face->pVertexIDs[index]]; }
+    [[nodiscard]] bool contains(const Vec3f &pos) const { return _face->Contains(pos, MODEL_INDOOR); }
+
+ private:
+    const BLVFace *_face = nullptr;
+};
+
+/**
+ * Outdoor face adapter for the templated collision functions below, reads directly from `OutdoorCollisionMesh`.
+ */
+class OutdoorCollisionFace {
+ public:
+    OutdoorCollisionFace(const OutdoorCollisionMesh *mesh, int index) : _mesh(mesh), _index(index), _vertices(mesh->vertices(index)) {}
+
+    [[nodiscard]] const Planef &plane() const { return _mesh->plane(_index); }
+    [[nodiscard]] const BBoxf &bbox() const { return _mesh->bbox(_index); }
+    [[nodiscard]] FaceAttributes attributes() const { return _mesh->attributes(_index); }
+    [[nodiscard]] int numVertices() const { return _vertices.size(); }
+    [[nodiscard]] const Vec3f &vertex(int index) const { return _vertices[index]; }
+    [[nodiscard]] bool contains(const Vec3f &pos) const { return _mesh->contains(_index, pos); }
+
+ private:
+    const OutdoorCollisionMesh *_mesh = nullptr;
+    int _index = 0;
+    std::span<const Vec3f> _vertices;
+};
+
 /**
  * @offset 0x0047531C, 0x004754BF.
  *
@@ -92,19 +131,19 @@ static bool CollideWithLine(const Vec3f p1, const Vec3f p2, const float radius,
  *                                      center to the polygon equals actor's radius.
  * @param[out] out_collision_point      Point at which collision between sphere and face occurs.
  * @param ignore_ethereal               Whether ethereal faces should be ignored by this function.
- * @param model_idx                     Model index, or `MODEL_INDOOR`.
  * @return                              Whether the actor, basically modeled as a sphere, can actually collide with the
  *                                      polygon if moving along the `dir` axis.
  */
-static bool CollideSphereWithFace(BLVFace* face, const Vec3f& pos, float radius, const Vec3f& dir,
-    float* out_move_distance, Vec3f* out_collision_point, bool ignore_ethereal, int model_idx) {
-    if (ignore_ethereal && face->Ethereal())
+template<class CollisionFace>
+static bool CollideSphereWithFace(const CollisionFace &face, const Vec3f& pos, float radius, const Vec3f& dir,
+    float* out_move_distance, Vec3f* out_collision_point, bool ignore_ethereal) {
+    if (ignore_ethereal && (face.attributes() & FACE_ETHEREAL))
         return false;
 
-    if (face->uNumVertices < 3)
+    if (face.numVertices() < 3)
         return false; // Apparently this happens.
 
-    float dir_normal_projection = dot(dir, face->facePlane.normal);
+    float dir_normal_projection = dot(dir, face.plane().normal);
     // This is checked by the caller, we should be moving into the face or sideways, so projection of dir onto the
     // face normal should either be negative or close to zero. IE never collide with rear of face
     assert(dir_normal_projection < COLLISIONS_EPS);
@@ -114,7 +153,7 @@ static bool CollideSphereWithFace(BLVFace* face, const Vec3f& pos, float radius,
         return false;
     }
 
-    float center_face_distance = face->facePlane.signedDistanceTo(pos);
+    float center_face_distance = face.plane().signedDistanceTo(pos);
     float move_distance = 0.0f;
     Vec3f projected_pos = pos;
     bool sphereInPlane = false;
@@ -132,15 +171,15 @@ static bool CollideSphereWithFace(BLVFace* face, const Vec3f& pos, float radius,
             return false;
         }
         if (move_distance > 65536.0f) return false; // moving almost parallal - TODO(pskelton): should probably tweak EPS when finished moving to floats
-        projected_pos += move_distance * dir - radius * face->facePlane.normal;
+        projected_pos += move_distance * dir - radius * face.plane().normal;
     }
 
     if (!sphereInPlane) {
         // projected pos of collsion should now be on the faceplace
-        assert(fuzzyIsNull(face->facePlane.signedDistanceTo(projected_pos), COLLISIONS_EPS)); // TODO(captainurist): move into face->Contains.
+        assert(fuzzyIsNull(face.plane().signedDistanceTo(projected_pos), COLLISIONS_EPS)); // TODO(captainurist): move into face->Contains.
 
         // collision point is in face so can return
-        if (face->Contains(projected_pos, model_idx)) {
+        if (face.contains(projected_pos)) {
             *out_move_distance = move_distance;
             *out_collision_point = projected_pos;
             //logger->warning("Error: collide with face md: {}", move_distance);
@@ -156,13 +195,8 @@ static bool CollideSphereWithFace(BLVFace* face, const Vec3f& pos, float radius,
 
     // now collide with vertices - point sphere collision
     a = dir.lengthSqr();
-    for (int i = 0; i < face->uNumVertices; ++i) {
-        Vec3f vertPos;
-        if (model_idx == MODEL_INDOOR) {
-            vertPos = pIndoor->pVertices[face->pVertexIDs[i]];
-        } else {
-            vertPos = pOutdoor->pBModels[model_idx].pVertices[face->pVertexIDs[i]];
-        }
+    for (int i = 0; i < face.numVertices(); ++i) {
+        const Vec3f &vertPos = face.vertex(i);
 
         b = 2.0f * (dot(dir, pos - vertPos));
         c = (vertPos - pos).lengthSqr() - radius * radius;
@@ -175,16 +209,10 @@ static bool CollideSphereWithFace(BLVFace* face, const Vec3f& pos, float radius,
     }
 
     // now collide with edges
-    for (int i = 0; i < face->uNumVertices; ++i) {
-        Vec3f vert1, vert2;
-        int i2 = (i + 1) % face->uNumVertices;
-        if (model_idx == MODEL_INDOOR) {
-            vert1 = pIndoor->pVertices[face->pVertexIDs[i]];
-            vert2 = pIndoor->pVertices[face->pVertexIDs[i2]];
-        } else {
-            vert1 = pOutdoor->pBModels[model_idx].pVertices[face->pVertexIDs[i]];
-            vert2 = pOutdoor->pBModels[model_idx].pVertices[face->pVertexIDs[i2]];
-        }
+    for (int i = 0; i < face.numVertices(); ++i) {
+        int i2 = (i + 1) % face.numVertices();
+        const Vec3f &vert1 = face.vertex(i);
+        const Vec3f &vert2 = face.vertex(i2);
 
         // collide with line between the two verts
         float intersectionDist;
@@ -215,25 +243,24 @@ static bool CollideSphereWithFace(BLVFace* face, const Vec3f& pos, float radius,
  *                                      distance required to hit the polygon is stored here. Note that this effectively
  *                                      means that this function can only decrease `move_distance`, but never increase
  *                                      it.
- * @param model_idx                     Model index, or `MODEL_INDOOR`.
  * @return                              Whether the actor, modeled as a point, hits the provided polygon if moving from
  *                                      `pos` along the `dir` axis by at most `move_distance`.
  */
-static bool CollidePointWithFace(BLVFace *face, const Vec3f &pos, const Vec3f &dir, float *out_move_distance,
-                                 int model_idx) {
+template<class CollisionFace>
+static bool CollidePointWithFace(const CollisionFace &face, const Vec3f &pos, const Vec3f &dir, float *out_move_distance) {
     // dot_product(dir, normal) is a cosine of an angle between them.
-    float cos_dir_normal = dot(dir, face->facePlane.normal);
+    float cos_dir_normal = dot(dir, face.plane().normal);
 
     if (fuzzyIsNull(cos_dir_normal, COLLISIONS_EPS))
         return false; // dir is perpendicular to face normal.
 
-    if (face->uAttributes & FACE_ETHEREAL)
+    if (face.attributes() & FACE_ETHEREAL)
         return false;
 
-    if (cos_dir_normal > 0 && !face->isPortal())
+    if (cos_dir_normal > 0 && !(face.attributes() & FACE_IsPortal))
         return false; // We're facing away && face is not a portal.
 
-    float pos_face_distance = face->facePlane.signedDistanceTo(pos);
+    float pos_face_distance = face.plane().signedDistanceTo(pos);
 
     if (cos_dir_normal < 0 && pos_face_distance < 0)
         return false; // Facing towards the face but already inside the model.
@@ -249,7 +276,7 @@ static bool CollidePointWithFace(BLVFace *face, const Vec3f &pos, const Vec3f &d
     if (move_distance > *out_move_distance)
         return false; // No correction needed.
 
-    if (!face->Contains(new_pos, model_idx))
+    if (!face.contains(new_pos))
         return false;
 
     *out_move_distance = move_distance;
@@ -263,21 +290,21 @@ static bool CollidePointWithFace(BLVFace *face, const Vec3f &pos, const Vec3f &d
  * @param face                          Face to check.
  * @param face_pid                      Pid of the provided face.
  * @param ignore_ethereal               Whether ethereal faces should be ignored by this function.
- * @param model_idx                     Model index, or `MODEL_INDOOR`.
 */
-static void CollideBodyWithFace(BLVFace *face, Pid face_pid, bool ignore_ethereal, int model_idx) {
+template<class CollisionFace>
+static void CollideBodyWithFace(const CollisionFace &face, Pid face_pid, bool ignore_ethereal) {
     auto collide_once = [&](const Vec3f &old_pos, const Vec3f &new_pos, const Vec3f &dir, int radius, float height) {
-        float distance_old = face->facePlane.signedDistanceTo(old_pos);
-        float distance_new = face->facePlane.signedDistanceTo(new_pos);
+        float distance_old = face.plane().signedDistanceTo(old_pos);
+        float distance_new = face.plane().signedDistanceTo(new_pos);
         if (distance_old > 0 && (distance_old <= radius || distance_new <= radius) && distance_new <= distance_old) {
             bool have_collision = false;
             float move_distance = collision_state.move_distance;
             Vec3f col_pos;
-            if (CollideSphereWithFace(face, old_pos, radius, dir, &move_distance, &col_pos, ignore_ethereal, model_idx)) {
+            if (CollideSphereWithFace(face, old_pos, radius, dir, &move_distance, &col_pos, ignore_ethereal)) {
                 have_collision = true;
             } else {
                 move_distance = collision_state.move_distance + radius;
-                if (CollidePointWithFace(face, old_pos, dir, &move_distance, model_idx)) {
+                if (CollidePointWithFace(face, old_pos, dir, &move_distance)) {
                     have_collision = true;
                     col_pos = move_distance * dir + old_pos;
                     move_distance -= radius;
@@ -310,7 +337,7 @@ static void CollideBodyWithFace(BLVFace *face, Pid face_pid, bool ignore_etherea
     collide_once(midPos, newMidPos, collision_state.direction, collision_state.radius_hi, midPos.z - collision_state.position_lo.z);
 
     // Try and test the center of the face if its within our cylinder and not too close to the midpoint
-    float zCent = face->pBounding.center().z;
+    float zCent = face.bbox().center().z;
     if (zCent > collision_state.position_lo.z && zCent < collision_state.position_hi.z && std::abs(midPos.z - zCent) > 10) {
         float diff = zCent - collision_state.position_lo.z;
         midPos.z = zCent;
@@ -451,37 +478,25 @@ void CollideIndoorWithGeometry(bool ignore_ethereal) {
                 if (face_id == 1181)
                     continue;
 
-            CollideBodyWithFace(face, Pid(OBJECT_Face, face_id), ignore_ethereal, MODEL_INDOOR);
+            CollideBodyWithFace(IndoorCollisionFace(face), Pid(OBJECT_Face, face_id), ignore_ethereal);
         }
     }
 }
 
 void CollideOutdoorWithModels(bool ignore_ethereal) {
-    for (BSPModel &model : pOutdoor->pBModels) {
+    for (OutdoorFaceGrid::FaceRef ref : pOutdoor->faceGrid.facesIn(collision_state.bbox)) {
+        BSPModel &model = pOutdoor->pBModels[ref.modelId];
         if (!collision_state.bbox.intersects(model.pBoundingBox))
             continue;
 
-        for (ODMFace &mface : model.pFaces) {
-            if (!collision_state.bbox.intersects(mface.pBoundingBox))
-                continue;
+        OutdoorCollisionFace face(&pOutdoor->collisionMesh, pOutdoor->collisionMesh.faceIndex(ref.modelId, ref.faceId));
+        if (!collision_state.bbox.intersects(face.bbox()))
+            continue;
 
-            // TODO: we should really either merge two face classes, or template the functions down the chain call here.
-            BLVFace face;
-            face.facePlane = mface.facePlane;
-            face.uAttributes = mface.uAttributes;
-            face.pBounding = mface.pBoundingBox;
-            face.zCalc = mface.zCalc;
-            face.uPolygonType = mface.uPolygonType;
-            face.uNumVertices = mface.uNumVertices;
-            face.resource = mface.resource;
-            face.pVertexIDs = mface.pVertexIDs.data();
-
-            if (face.Ethereal() || face.isPortal()) // TODO: this doesn't respect ignore_ethereal parameter
-                continue;
+        if (face.attributes() & (FACE_ETHEREAL | FACE_IsPortal)) // TODO: this doesn't respect ignore_ethereal parameter
+            continue;
 
-            Pid pid = Pid::odmFace(model.index, mface.index);
-            CollideBodyWithFace(&face, pid, ignore_ethereal, model.index);
-        }
+        CollideBodyWithFace(face, Pid::odmFace(ref.modelId, ref.faceId), ignore_ethereal);
     }
 }
 
@@ -527,7 +542,7 @@ bool CollideIndoorWithPortals() {
         float move_distance = collision_state.move_distance;
         if ((distance_lo_old < collision_state.radius_lo || distance_lo_new < collision_state.radius_lo) &&
             (distance_lo_old > -collision_state.radius_lo || distance_lo_new > -collision_state.radius_lo) &&
-            CollidePointWithFace(face, collision_state.position_lo, collision_state.direction, &move_distance, MODEL_INDOOR) &&
+            CollidePointWithFace(IndoorCollisionFace(face), collision_state.position_lo, collision_state.direction, &move_distance) &&
             move_distance < min_move_distance) {
             min_move_distance = move_distance;
             portal_id = pIndoor->pSectors[collision_state.uSectorID].pPortals[i];
@@ -561,7 +576,7 @@ bool CollideWithActor(int actor_idx, int override_radius) {
 }
 
 void _46ED8A_collide_against_sprite_objects(Pid pid) {
-    for (unsigned i = 0; i < pSpriteObjects.size(); ++i) {
+    for (int i = spriteObjectSlots.nextLive(0); i < spriteObjectSlots.size(); i = spriteObjectSlots.nextLive(i + 1)) {
         if (pSpriteObjects[i].uObjectDescID == 0)
             continue;
 
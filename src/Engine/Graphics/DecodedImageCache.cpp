@@ -0,0 +1,140 @@
+#include "DecodedImageCache.h"
+
+#include <cassert>
+#include <cstdint>
+#include <array>
+#include <exception>
+#include <string>
+#include <utility>
+
+#include "Library/FileSystem/Interface/FileSystem.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Streams/StringOutputStream.h"
+#include "Utility/String/Ascii.h"
+#include "Utility/String/Format.h"
+
+DecodedImageCache *pDecodedImageCache = nullptr;
+
+namespace {
+
+#pragma pack(push, 1)
+struct DecodedImageHeader {
+    std::array<char, 8> signature;
+    uint64_t sourceSize;
+    uint64_t sourceStamp;
+    uint32_t keySize; // Key string follows the header, then RGBA pixels, then indexed pixels, then palette.
+    uint16_t width;
+    uint16_t height;
+    uint16_t indexedWidth;
+    uint16_t indexedHeight;
+};
+static_assert(sizeof(DecodedImageHeader) == 36);
+#pragma pack(pop)
+
+// Bump the version when changing the format or the way images are decoded.
+constexpr std::array<char, 8> SIGNATURE = {{'O', 'E', 'I', 'M', 'G', 'C', '0', '2'}};
+
+template<class Image>
+bool readImage(BlobInputStream *stream, ssize_t width, ssize_t height, Image *image) {
+    Image result = Image::uninitialized(width, height);
+    size_t size = result.pixels().size_bytes();
+    if (stream->read(result.pixels().data(), size) != size)
+        return false;
+    *image = std::move(result);
+    return true;
+}
+
+} // namespace
+
+DecodedImageCache::DecodedImageCache(FileSystem *fs, std::string_view root) : _fs(fs), _root(root) {
+    assert(fs);
+}
+
+DecodedImageCache::~DecodedImageCache() = default;
+
+bool DecodedImageCache::load(const DecodedImageSource &source, std::string_view variant, RgbaImage *rgbaImage,
+                             GrayscaleImage *indexedImage, Palette *palette) {
+    std::string key = makeKey(source, variant);
+    std::string path = makePath(key);
+
+    try {
+        if (!_fs->exists(path)) {
+            _misses++;
+            return false;
+        }
+
+        BlobInputStream stream(_fs->read(path));
+        DecodedImageHeader header;
+        if (stream.read(&header, sizeof(header)) != sizeof(header) || header.signature != SIGNATURE ||
+            header.sourceSize != source.size || header.sourceStamp != source.stamp ||
+            stream.readBlob(header.keySize).string_view() != key) {
+            _misses++;
+            return false;
+        }
+
+        RgbaImage rgba;
+        GrayscaleImage indexed;
+        Palette pal;
+        if (!readImage(&stream, header.width, header.height, &rgba) ||
+            !readImage(&stream, header.indexedWidth, header.indexedHeight, &indexed) ||
+            stream.read(&pal, sizeof(pal)) != sizeof(pal)) {
+            _misses++;
+            return false;
+        }
+
+        *rgbaImage = std::move(rgba);
+        *indexedImage = std::move(indexed);
+        *palette = pal;
+        _hits++;
+        return true;
+    } catch (const std::exception &e) {
+        logger->warning("Could not read decoded image cache entry '{}': {}", path, e.what());
+        _misses++;
+        return false;
+    }
+}
+
+void DecodedImageCache::store(const DecodedImageSource &source, std::string_view variant, const RgbaImage &rgbaImage, const GrayscaleImage &indexedImage,
+                              const Palette &palette) {
+    std::string key = makeKey(source, variant);
+    std::string path = makePath(key);
+
+    assert(rgbaImage.width() <= UINT16_MAX && rgbaImage.height() <= UINT16_MAX);
+    assert(indexedImage.width() <= UINT16_MAX && indexedImage.height() <= UINT16_MAX);
+
+    DecodedImageHeader header;
+    header.signature = SIGNATURE;
+    header.sourceSize = source.size;
+    header.sourceStamp = source.stamp;
+    header.keySize = key.size();
+    header.width = rgbaImage.width();
+    header.height = rgbaImage.height();
+    header.indexedWidth = indexedImage.width();
+    header.indexedHeight = indexedImage.height();
+
+    std::string data;
+    StringOutputStream stream(&data);
+    stream.write(&header, sizeof(header));
+    stream.write(key);
+    stream.write(rgbaImage.pixels().data(), rgbaImage.pixels().size_bytes());
+    stream.write(indexedImage.pixels().data(), indexedImage.pixels().size_bytes());
+    stream.write(&palette, sizeof(palette));
+    stream.close();
+
+    try {
+        _fs->write(path, Blob::fromString(std::move(data)));
+    } catch (const std::exception &e) {
+        logger->warning("Could not write decoded image cache entry '{}': {}", path, e.what());
+    }
+}
+
+std::string DecodedImageCache::makeKey(const DecodedImageSource &source, std::string_view variant) const {
+    return fmt::format("{}|{}", ascii::toLower(source.path), variant);
+}
+
+std::string DecodedImageCache::makePath(std::string_view key) const {
+    // Key is stored inside the file, so hash collisions are handled by treating them as cache misses.
+    return fmt::format("{}/{:016x}.bin", _root, static_cast<uint64_t>(ascii::noCaseHash(key)));
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "Library/Image/Image.h"
+#include "Library/Image/Palette.h"
+
+class FileSystem;
+
+/**
+ * Identifies the source data of a cached image without decoding it.
+ */
+struct DecodedImageSource {
+    std::string path; // Source path, e.g. LOD path + entry name. Empty means that the image shouldn't be cached.
+    uint64_t size = 0; // Size of the source data.
+    uint64_t stamp = 0; // Anything else that changes when the source changes, e.g. CRC-32 of the raw LOD entry.
+
+    explicit operator bool() const {
+        return !path.empty();
+    }
+};
+
+/**
+ * Persistent cache of decoded images, stored in a file system (normally `ufs`).
+ *
+ * Each entry is keyed by the source path (e.g. LOD path + entry name) and a loader-specific variant string that should
+ * describe everything else the decoded result depends on (color key, saturation, etc). The entry also stores the size
+ * & stamp of the source, so entries are invalidated automatically when the source changes. For LOD entries the stamp
+ * is the CRC-32 of the raw entry data, so a cache hit doesn't have to decompress the source.
+ *
+ * Cache files are read through `FileSystem::read`, which memory-maps them for directory-backed file systems.
+ */
+class DecodedImageCache {
+ public:
+    /**
+     * @param fs                        File system to store the cache in.
+     * @param root                      Root folder for the cache files inside `fs`.
+     */
+    explicit DecodedImageCache(FileSystem *fs, std::string_view root = "cache/images");
+    ~DecodedImageCache();
+
+    /**
+     * @param source                    Source of the image.
+     * @param variant                   Loader-specific variant string.
+     * @param[out] rgbaImage            Cached RGBA image.
+     * @param[out] indexedImage         Cached indexed image, if any.
+     * @param[out] palette              Cached palette.
+     * @return                          Whether the cache entry was found & is up to date. Output parameters are left
+     *                                  untouched if `false` is returned.
+     */
+    bool load(const DecodedImageSource &source, std::string_view variant, RgbaImage *rgbaImage, GrayscaleImage *indexedImage,
+              Palette *palette);
+
+    /**
+     * Stores decoded image in the cache. Errors are logged and otherwise ignored.
+     *
+     * @param source                    Source of the image.
+     * @param variant                   Loader-specific variant string.
+     * @param rgbaImage                 Decoded RGBA image.
+     * @param indexedImage              Decoded indexed image, can be empty.
+     * @param palette                   Palette.
+     */
+    void store(const DecodedImageSource &source, std::string_view variant, const RgbaImage &rgbaImage, const GrayscaleImage &indexedImage,
+               const Palette &palette);
+
+    [[nodiscard]] size_t hits() const {
+        return _hits;
+    }
+
+    [[nodiscard]] size_t misses() const {
+        return _misses;
+    }
+
+ private:
+    [[nodiscard]] std::string makeKey(const DecodedImageSource &source, std::string_view variant) const;
+    [[nodiscard]] std::string makePath(std::string_view key) const;
+
+ private:
+    FileSystem *_fs = nullptr;
+    std::string _root;
+    size_t _hits = 0;
+    size_t _misses = 0;
+};
+
+extern DecodedImageCache *pDecodedImageCache; // Null if the cache is disabled.
@@ -102,7 +102,7 @@ bool GraphicsImage::LoadImageData() {
     if (_initialized)
         return true;
 
-    _initialized = _loader->Load(&_rgbaImage, &_indexedImage, &_palette);
+    _initialized = _loader->LoadCached(&_rgbaImage, &_indexedImage, &_palette);
     // TODO(captainurist): _initialized == false happens, investigate
 
     if (_initialized)
@@ -6,6 +6,7 @@
 
 #include "Engine/Engine.h"
 #include "Engine/EngineFileSystem.h"
+#include "Engine/Graphics/DecodedImageCache.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Graphics/Sprites.h"
 #include "Engine/Graphics/TileGenerator.h"
@@ -13,13 +14,17 @@
 #include "Engine/LodSpriteCache.h"
 #include "Engine/Graphics/PaletteManager.h"
 
+#include "Library/Compression/Compression.h"
 #include "Library/Image/ImageFunctions.h"
+#include "Library/Lod/LodReader.h"
 #include "Library/Image/Pcx.h"
 #include "Library/Image/Png.h"
 #include "Library/LodFormats/LodImage.h"
 #include "Library/LodFormats/LodSprite.h"
 #include "Library/Logger/Logger.h"
 
+#include "Utility/String/Format.h"
+
 // List of textures that require additional processing for transparent pixels.
 // TODO(captainurist): #jsonify & move to compiled-in game data
 static const std::unordered_set<std::string_view> transparentTextures = {
@@ -53,6 +58,40 @@ static Palette MakePaletteColorKey(const Palette &palette, Color key) {
     return result;
 }
 
+bool ImageLoader::LoadCached(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
+    if (!pDecodedImageCache)
+        return Load(rgbaImage, indexedImage, palette);
+
+    DecodedImageSource source = CacheSource();
+    if (!source)
+        return Load(rgbaImage, indexedImage, palette);
+
+    std::string variant = CacheVariant();
+    if (pDecodedImageCache->load(source, variant, rgbaImage, indexedImage, palette))
+        return true;
+
+    if (!Load(rgbaImage, indexedImage, palette))
+        return false;
+
+    pDecodedImageCache->store(source, variant, *rgbaImage, *indexedImage, *palette);
+    return true;
+}
+
+static DecodedImageSource MakeLodCacheSource(const LodReader &lod, std::string_view name) {
+    if (!lod.exists(name))
+        return {};
+
+    // Entry offset & size don't change if an entry is replaced in place with one of the same size, so we need to look
+    // at the data. Note that this is the raw entry data, compressed images are not inflated here.
+    Blob data = lod.read(name);
+
+    DecodedImageSource result;
+    result.path = fmt::format("{}/{}", lod.displayPath(), name);
+    result.size = data.size();
+    result.stamp = zlib::crc32(data);
+    return result;
+}
+
 bool Paletted_Img_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
     LodImage *tex = lod->loadTexture(resource_name);
     if (tex == nullptr)
@@ -66,6 +105,14 @@ bool Paletted_Img_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImag
     return true;
 }
 
+DecodedImageSource Paletted_Img_Loader::CacheSource() {
+    return MakeLodCacheSource(lod->reader(), resource_name);
+}
+
+std::string Paletted_Img_Loader::CacheVariant() const {
+    return "paletted";
+}
+
 bool ColorKey_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
     LodImage *tex = lod->loadTexture(resource_name);
     if (tex == nullptr)
@@ -85,6 +132,14 @@ bool ColorKey_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImag
     return true;
 }
 
+DecodedImageSource ColorKey_LOD_Loader::CacheSource() {
+    return MakeLodCacheSource(lod->reader(), resource_name);
+}
+
+std::string ColorKey_LOD_Loader::CacheVariant() const {
+    return fmt::format("colorkey:{:08x}", colorkey.c32());
+}
+
 bool Image16bit_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
     LodImage *tex = lod->loadTexture(resource_name);
     if (tex == nullptr)
@@ -104,6 +159,14 @@ bool Image16bit_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedIm
     return true;
 }
 
+DecodedImageSource Image16bit_LOD_Loader::CacheSource() {
+    return MakeLodCacheSource(lod->reader(), resource_name);
+}
+
+std::string Image16bit_LOD_Loader::CacheVariant() const {
+    return "16bit";
+}
+
 bool Alpha_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
     LodImage *tex = lod->loadTexture(resource_name);
     if (tex == nullptr)
@@ -117,6 +180,14 @@ bool Alpha_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage,
     return true;
 }
 
+DecodedImageSource Alpha_LOD_Loader::CacheSource() {
+    return MakeLodCacheSource(lod->reader(), resource_name);
+}
+
+std::string Alpha_LOD_Loader::CacheVariant() const {
+    return "alpha";
+}
+
 bool PCX_Loader::InternalLoad(const Blob &data, RgbaImage *rgbaImage) {
     *rgbaImage = pcx::decode(data);
     return true;
@@ -133,13 +204,21 @@ bool PCX_LOD_Raw_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage
 }
 
 bool PCX_LOD_Compressed_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
-    Blob pcx_data = blob_func();
-    if (!pcx_data) {
+    Blob data = lod->LoadCompressedTexture(resource_name);
+    if (!data) {
         logger->warning("Unable to load {}", resource_name);
         return false;
     }
 
-    return InternalLoad(pcx_data, rgbaImage);
+    return InternalLoad(data, rgbaImage);
+}
+
+DecodedImageSource PCX_LOD_Compressed_Loader::CacheSource() {
+    return MakeLodCacheSource(lod->reader(), resource_name);
+}
+
+std::string PCX_LOD_Compressed_Loader::CacheVariant() const {
+    return "pcx";
 }
 
 static Color ProcessTransparentPixel(const GrayscaleImage &image, const Palette &palette, size_t x, size_t y) {
@@ -196,14 +275,15 @@ bool Bitmaps_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage
     // TODO(captainurist): no need to copy here.
     *indexedImage = GrayscaleImage::copy(tex->image.width(), tex->image.height(), tex->image.pixels().data()); // NOLINT: this is not std::copy.
 
-    // Desaturate bitmaps
-    tex->palette = PaletteManager::createLoadedPalette(tex->palette);
+    // Desaturate bitmaps. Cached texture is left as is, so this doesn't depend on whether the image was loaded from
+    // `pDecodedImageCache`, and doesn't desaturate twice if the image is reloaded.
+    Palette desaturatedPalette = PaletteManager::createLoadedPalette(tex->palette);
 
     if (!transparentTextures.contains(this->resource_name)) {
-        *palette = tex->palette;
+        *palette = desaturatedPalette;
         *rgbaImage = makeRgbaImage(*indexedImage, *palette);
     } else {
-        *palette = MakePaletteAlpha(tex->palette);
+        *palette = MakePaletteAlpha(desaturatedPalette);
 
         *rgbaImage = RgbaImage::uninitialized(w, h);
         for (size_t y = 0; y < h; y++) {
@@ -221,6 +301,14 @@ bool Bitmaps_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage
     return true;
 }
 
+DecodedImageSource Bitmaps_LOD_Loader::CacheSource() {
+    return MakeLodCacheSource(lod->reader(), resource_name);
+}
+
+std::string Bitmaps_LOD_Loader::CacheVariant() const {
+    return fmt::format("bitmap:{}:{}", engine->config->graphics.Saturation.value(), engine->config->graphics.Lightness.value());
+}
+
 bool Bitmaps_GEN_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
     pTileGenerator->ensureTile(this->resource_name);
     *rgbaImage = png::decode(ufs->read(this->resource_name));
@@ -234,6 +322,19 @@ bool Bitmaps_GEN_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage
     return true;
 }
 
+DecodedImageSource Bitmaps_GEN_Loader::CacheSource() {
+    pTileGenerator->ensureTile(this->resource_name);
+
+    DecodedImageSource result;
+    result.path = ufs->displayPath(this->resource_name);
+    result.size = ufs->stat(this->resource_name).size;
+    return result;
+}
+
+std::string Bitmaps_GEN_Loader::CacheVariant() const {
+    return fmt::format("generated:{}:{}", engine->config->graphics.Saturation.value(), engine->config->graphics.Lightness.value());
+}
+
 bool Sprites_LOD_Loader::Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) {
     Sprite *pSprite = lod->loadSprite(this->resource_name);
 
@@ -1,12 +1,15 @@
 #pragma once
 
 #include <string>
-#include <functional>
+
+#include "Engine/Graphics/DecodedImageCache.h"
 
 #include "Library/Color/Color.h"
 #include "Library/Image/Image.h"
 #include "Library/Image/Palette.h"
 
+#include "Utility/Memory/Blob.h"
+
 class LodSpriteCache;
 class LodTextureCache;
 class LodReader;
@@ -18,6 +21,24 @@ class ImageLoader {
 
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) = 0;
 
+    /**
+     * Same as `Load`, but goes through `pDecodedImageCache` if it's enabled and this loader supports caching.
+     */
+    bool LoadCached(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette);
+
+ protected:
+    /**
+     * @return                          Source of the image, to be used for `DecodedImageCache` lookups. Should be
+     *                                  cheap to get, i.e. shouldn't decode the source data. Empty source means that
+     *                                  the image shouldn't be cached.
+     */
+    virtual DecodedImageSource CacheSource() { return {}; }
+
+    /**
+     * @return                          Everything else that the decoded image depends on, see `DecodedImageCache`.
+     */
+    virtual std::string CacheVariant() const { return {}; }
+
  protected:
     std::string resource_name;
 };
@@ -32,6 +53,9 @@ class Paletted_Img_Loader : public ImageLoader {
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) override;
 
  protected:
+    virtual DecodedImageSource CacheSource() override;
+    virtual std::string CacheVariant() const override;
+
     LodTextureCache *lod;
 };
 
@@ -46,6 +70,9 @@ class ColorKey_LOD_Loader : public ImageLoader {
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) override;
 
  protected:
+    virtual DecodedImageSource CacheSource() override;
+    virtual std::string CacheVariant() const override;
+
     Color colorkey;
     LodTextureCache *lod;
 };
@@ -60,6 +87,9 @@ class Image16bit_LOD_Loader : public ImageLoader {
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) override;
 
  protected:
+    virtual DecodedImageSource CacheSource() override;
+    virtual std::string CacheVariant() const override;
+
     LodTextureCache *lod;
 };
 
@@ -73,6 +103,9 @@ class Alpha_LOD_Loader : public ImageLoader {
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) override;
 
  protected:
+    virtual DecodedImageSource CacheSource() override;
+    virtual std::string CacheVariant() const override;
+
     LodTextureCache *lod;
 };
 
@@ -81,6 +114,8 @@ class PCX_Loader : public ImageLoader {
     bool InternalLoad(const Blob &data, RgbaImage *rgbaImage);
 };
 
+// Doesn't go through `DecodedImageCache`, this loader is used for savegame thumbnails, and savegames are rewritten in
+// place.
 class PCX_LOD_Raw_Loader : public PCX_Loader {
  public:
     inline PCX_LOD_Raw_Loader(LodReader *lod, std::string_view filename) {
@@ -96,19 +131,18 @@ class PCX_LOD_Raw_Loader : public PCX_Loader {
 
 class PCX_LOD_Compressed_Loader : public PCX_Loader {
  public:
-    // TODO(captainurist): this is the next level of ugly, redo.
-    template<class Lod>
-    inline PCX_LOD_Compressed_Loader(Lod *lod, std::string_view filename) {
-        resource_name = filename;
-        blob_func = [this, lod] {
-            return lod->LoadCompressedTexture(resource_name);
-        };
+    inline PCX_LOD_Compressed_Loader(LodTextureCache *lod, std::string_view filename) {
+        this->resource_name = filename;
+        this->lod = lod;
     }
 
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) override;
 
  protected:
-    std::function<Blob()> blob_func;
+    virtual DecodedImageSource CacheSource() override;
+    virtual std::string CacheVariant() const override;
+
+    LodTextureCache *lod;
 };
 
 class Bitmaps_LOD_Loader : public ImageLoader {
@@ -121,6 +155,9 @@ class Bitmaps_LOD_Loader : public ImageLoader {
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) override;
 
  protected:
+    virtual DecodedImageSource CacheSource() override;
+    virtual std::string CacheVariant() const override;
+
     LodTextureCache *lod;
 };
 
@@ -131,6 +168,10 @@ class Bitmaps_GEN_Loader : public ImageLoader {
     }
 
     virtual bool Load(RgbaImage *rgbaImage, GrayscaleImage *indexedImage, Palette *palette) override;
+
+ protected:
+    virtual DecodedImageSource CacheSource() override;
+    virtual std::string CacheVariant() const override;
 };
 
 class Sprites_LOD_Loader : public ImageLoader {
@@ -4,6 +4,7 @@
 #include <limits>
 #include <ranges>
 #include <string>
+#include <vector>
 
 #include "Engine/Engine.h"
 #include "Engine/EngineGlobals.h"
@@ -16,6 +17,8 @@
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/LineOfSightCache.h"
+#include "Engine/Graphics/LocationFunctions.h"
 #include "Engine/Graphics/Outdoor.h"
 #include "Engine/Graphics/ParticleEngine.h"
 #include "Engine/Graphics/TextureFrameTable.h"
@@ -265,6 +268,9 @@ void IndoorLocation::Release() {
     this->pDoors.clear();
     this->pLights.clear();
     this->pMapOutlines.clear();
+    this->sectorGrid.clear();
+    this->drawList.clear();
+    lineOfSightCache.invalidate();
 
     render->ReleaseBSP();
 
@@ -300,6 +306,18 @@ void IndoorLocation::Load(std::string_view filename, int num_days_played, int re
     deserialize(lod::decodeCompressed(pGames_LOD->read(blv_filename)), &location); // read throws if file doesn't exist.
     reconstruct(location, this);
 
+    // GetSector checks sector bounds against a cuboid with 5-unit horizontal extents, pad a bit more to be safe.
+    std::vector<BBoxf> sectorBounds;
+    for (const BLVSector &sector : pSectors) {
+        BBoxf bounds = sector.pBounding;
+        bounds.x1 -= 6;
+        bounds.y1 -= 6;
+        bounds.x2 += 6;
+        bounds.y2 += 6;
+        sectorBounds.push_back(bounds);
+    }
+    sectorGrid.build(sectorBounds);
+
     std::string dlv_filename = fmt::format("{}.dlv", filename.substr(0, filename.size() - 4));
 
     bool respawnInitial = false; // Perform initial location respawn?
@@ -363,16 +381,19 @@ int IndoorLocation::GetSector(float sX, float sY, float sZ) {
         return 0;
     }
 
+    assert(sectorGrid.size() == pSectors.size()); // Grid should be built in Load().
+
      // holds faces the coords are above
-    int FoundFaceStore[5] = { 0 };
-    int NumFoundFaceStore = 0;
+    static std::vector<int> FoundFaceStore;
+    FoundFaceStore.clear();
     int backupboundingsector{ 0 };
     std::optional<int> foundSector;
     bool singleSectorFound = false;
 
-    // loop through sectors
-    for (unsigned i = 1; i < pSectors.size(); ++i) {
-        if (NumFoundFaceStore >= 5) break;
+    // loop through sectors that might contain the point, in ascending order
+    for (int i : sectorGrid.query(sX, sY)) {
+        if (i == 0)
+            continue; // Sector #0 is a dummy.
 
         BLVSector *pSector = &pSectors[i];
 
@@ -408,11 +429,10 @@ int IndoorLocation::GetSector(float sX, float sY, float sZ) {
 
             // add found faces into store
             if (pFace->Contains(Vec3f(sX, sY, 0), MODEL_INDOOR, engine->config->gameplay.FloorChecksEps.value(), FACE_XY_PLANE))
-                FoundFaceStore[NumFoundFaceStore++] = uFaceID;
-            if (NumFoundFaceStore >= 5)
-                break; // TODO(captainurist): we do get here sometimes (e.g. in dragon cave), increase limit?
+                FoundFaceStore.push_back(uFaceID);
         }
     }
+    int NumFoundFaceStore = FoundFaceStore.size();
 
     // only one face found
     if (NumFoundFaceStore == 1)
@@ -729,6 +749,9 @@ void BLV_UpdateDoors() {
 }
 
 void BLV_UpdateDoorGeometry(BLVDoor* door, int distance) {
+    // Moving door geometry might change what's visible through the portals.
+    lineOfSightCache.invalidate();
+
     // adjust verts to how open the door is
     for (int j = 0; j < door->uNumVertices; ++j) {
         pIndoor->pVertices[door->pVertexIDs[j]].x = door->vDirection.x * distance + door->pXOffsets[j];
@@ -990,6 +1013,7 @@ void loadAndPrepareBLV(MapId mapid, bool bLoading) {
 
     pStationaryLightsStack->uNumLightsActive = 0;
     pIndoor->Load(mapFilename, pParty->GetPlayingTime().toDays() + 1, respawn_interval, &indoor_was_respawned);
+    pIndoor->drawList.build(pIndoor->pFaces, pIndoor->pDoors);
     if (!(dword_6BE364_game_settings_1 & GAME_SETTINGS_LOADING_SAVEGAME_SKIP_RESPAWN)) {
         Actor::InitializeActors();
         SpriteObject::InitializeSpriteObjects();
@@ -1008,6 +1032,7 @@ void loadAndPrepareBLV(MapId mapid, bool bLoading) {
         }
         RespawnGlobalDecorations();
     }
+    prefetchLocationAssets();
 
     BLV_InitialiseDoors();
 
@@ -8,12 +8,14 @@
 #include "Engine/mm7_data.h"
 #include "Engine/EngineIocContainer.h"
 #include "Engine/SpawnPoint.h"
+#include "Engine/Objects/ObjectGrid.h"
 
 #include "BSPModel.h"
 #include "LocationInfo.h"
 #include "LocationTime.h"
 #include "LocationFunctions.h"
 #include "FaceEnums.h"
+#include "IndoorDrawList.h"
 
 struct BspRenderer;
 struct IndoorLocation;
@@ -234,6 +236,8 @@ struct IndoorLocation {
     std::vector<BLVDoor> pDoors;
     std::vector<BSPNode> pNodes;
     std::vector<BLVMapOutline> pMapOutlines;
+    ObjectGrid sectorGrid = ObjectGrid(512); // Sector bounding boxes, used by GetSector. Built in Load.
+    IndoorDrawList drawList; // Static vertex layout for the renderer. Built in loadAndPrepareBLV.
     std::vector<int16_t> pLFaces;
     std::vector<uint16_t> ptr_0002B0_sector_rdata;
     std::vector<int16_t> ptr_0002B4_doors_ddata;
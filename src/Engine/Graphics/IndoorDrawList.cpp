@@ -0,0 +1,67 @@
+#include "IndoorDrawList.h"
+
+#include <cassert>
+#include <unordered_set>
+
+#include "Indoor.h"
+
+void IndoorDrawList::build(std::span<const BLVFace> faces, std::span<const BLVDoor> doors) {
+    clear();
+
+    _firstVertex.reserve(faces.size() + 1);
+    _firstVertex.push_back(0);
+    for (const BLVFace &face : faces) {
+        int triangles = face.uNumVertices >= 3 ? face.uNumVertices - 2 : 0;
+        _firstVertex.push_back(_firstVertex.back() + 3 * triangles);
+    }
+
+    std::unordered_set<int> doorVertices;
+    _dynamic.assign(faces.size(), false);
+    for (const BLVDoor &door : doors) {
+        for (int i = 0; i < door.uNumFaces; i++)
+            _dynamic[door.pFaceIDs[i]] = true;
+        for (int i = 0; i < door.uNumVertices; i++)
+            doorVertices.insert(door.pVertexIDs[i]);
+    }
+
+    for (size_t i = 0; i < faces.size(); i++) {
+        const BLVFace &face = faces[i];
+        if (face.Indoor_sky()) {
+            _dynamic[i] = true; // Sky floors scroll their texture coordinates.
+            continue;
+        }
+
+        if (doorVertices.empty())
+            continue;
+
+        for (int j = 0; j < face.uNumVertices && !_dynamic[i]; j++)
+            if (doorVertices.contains(face.pVertexIDs[j]))
+                _dynamic[i] = true;
+    }
+}
+
+void IndoorDrawList::clear() {
+    _firstVertex.clear();
+    _dynamic.clear();
+    beginFrame();
+}
+
+void IndoorDrawList::beginFrame() {
+    for (std::vector<uint32_t> &indices : _indices)
+        indices.clear();
+}
+
+void IndoorDrawList::addFace(int faceId, int unit) {
+    assert(unit >= 0 && unit < MAX_TEXTURE_UNITS);
+
+    std::vector<uint32_t> &indices = _indices[unit];
+    for (uint32_t i = _firstVertex[faceId], end = _firstVertex[faceId + 1]; i < end; i++)
+        indices.push_back(i);
+}
+
+int IndoorDrawList::indexCount() const {
+    int result = 0;
+    for (const std::vector<uint32_t> &indices : _indices)
+        result += indices.size();
+    return result;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct BLVFace;
+struct BLVDoor;
+
+/**
+ * Renderer-agnostic layout of the indoor geometry in a single static vertex buffer, plus per-frame index lists for the
+ * faces that are actually visible.
+ *
+ * Every face gets a fixed range of `3 * (uNumVertices - 2)` vertices in the static buffer, in face order, holding the
+ * face's triangle fan. The layout is computed once on location load, so renderers can upload all of the geometry up
+ * front and only touch the ranges of faces that have changed since (e.g. door faces).
+ *
+ * Each frame the renderer calls `beginFrame`, then `addFace` for every BSP-visible face in visit order, and then draws
+ * `indices(unit)` for every texture unit. Within a unit, faces are drawn in the order they were added.
+ */
+class IndoorDrawList {
+ public:
+    static constexpr int MAX_TEXTURE_UNITS = 16;
+
+    /**
+     * Rebuilds the vertex layout.
+     *
+     * @param faces                     Location faces.
+     * @param doors                     Location doors. Faces that belong to a door or share a vertex with a door are
+     *                                  marked as dynamic, as their vertices move at runtime.
+     */
+    void build(std::span<const BLVFace> faces, std::span<const BLVDoor> doors);
+
+    void clear();
+
+    [[nodiscard]] int faceCount() const {
+        return _firstVertex.empty() ? 0 : _firstVertex.size() - 1;
+    }
+
+    /**
+     * @return                          Total number of vertices in the static buffer.
+     */
+    [[nodiscard]] int vertexCount() const {
+        return _firstVertex.empty() ? 0 : _firstVertex.back();
+    }
+
+    [[nodiscard]] int firstVertex(int faceId) const {
+        return _firstVertex[faceId];
+    }
+
+    [[nodiscard]] int numVertices(int faceId) const {
+        return _firstVertex[faceId + 1] - _firstVertex[faceId];
+    }
+
+    /**
+     * @param faceId                    Face id.
+     * @return                          Whether the face's vertex positions or texture coordinates can change after
+     *                                  load, and thus should be re-uploaded whenever the face is drawn.
+     */
+    [[nodiscard]] bool isDynamic(int faceId) const {
+        return _dynamic[faceId];
+    }
+
+    /**
+     * Clears the index lists for all texture units.
+     */
+    void beginFrame();
+
+    /**
+     * Appends the triangles of the provided face to the index list of the provided texture unit.
+     *
+     * @param faceId                    Face id.
+     * @param unit                      Texture unit, in `[0, MAX_TEXTURE_UNITS)`.
+     */
+    void addFace(int faceId, int unit);
+
+    [[nodiscard]] std::span<const uint32_t> indices(int unit) const {
+        return _indices[unit];
+    }
+
+    /**
+     * @return                          Total number of indices added since the last call to `beginFrame`.
+     */
+    [[nodiscard]] int indexCount() const;
+
+ private:
+    std::vector<uint32_t> _firstVertex; // Face count + 1 offsets into the static vertex buffer, CSR-style.
+    std::vector<bool> _dynamic;
+    std::array<std::vector<uint32_t>, MAX_TEXTURE_UNITS> _indices;
+};
@@ -0,0 +1,61 @@
+#include "LineOfSightCache.h"
+
+#include <bit>
+
+#include "Utility/Hash.h"
+
+// Upper bound on the number of cached entries, cache is just dropped when it's reached.
+static constexpr size_t MAX_ENTRIES = 65536;
+
+LineOfSightCache lineOfSightCache;
+
+std::optional<bool> LineOfSightCache::find(int sector1, int sector2, const Vec3f &pos1, const Vec3f &pos2) {
+    auto pos = _entries.find(makeKey(sector1, sector2, pos1, pos2));
+    if (pos == _entries.end()) {
+        _misses++;
+        return std::nullopt;
+    }
+
+    _hits++;
+    return pos->second;
+}
+
+void LineOfSightCache::insert(int sector1, int sector2, const Vec3f &pos1, const Vec3f &pos2, bool visible, std::chrono::nanoseconds cost) {
+    if (_entries.size() >= MAX_ENTRIES)
+        _entries.clear();
+
+    _entries.insert_or_assign(makeKey(sector1, sector2, pos1, pos2), visible);
+    _missTime += cost;
+}
+
+void LineOfSightCache::invalidate() {
+    _entries.clear();
+}
+
+void LineOfSightCache::resetStats() {
+    _hits = 0;
+    _misses = 0;
+    _missTime = {};
+}
+
+std::chrono::nanoseconds LineOfSightCache::savedTime() const {
+    if (_misses == 0)
+        return {};
+    return _missTime * _hits / _misses;
+}
+
+size_t LineOfSightCache::KeyHash::operator()(const Key &key) const {
+    size_t seed = 0;
+    detail::hashCombine(seed, key.sector1);
+    detail::hashCombine(seed, key.sector2);
+    for (uint32_t coord : key.coords)
+        detail::hashCombine(seed, coord);
+    return seed;
+}
+
+LineOfSightCache::Key LineOfSightCache::makeKey(int sector1, int sector2, const Vec3f &pos1, const Vec3f &pos2) {
+    return {sector1, sector2, {{
+        std::bit_cast<uint32_t>(pos1.x), std::bit_cast<uint32_t>(pos1.y), std::bit_cast<uint32_t>(pos1.z),
+        std::bit_cast<uint32_t>(pos2.x), std::bit_cast<uint32_t>(pos2.y), std::bit_cast<uint32_t>(pos2.z)
+    }}};
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+
+#include "Library/Geometry/Vec.h"
+
+/**
+ * Cache for the results of indoor line of sight checks, see `Detect_Between_Objects`.
+ *
+ * Keys are exact (sector pair & bitwise positions), so a cache hit returns exactly what the check would have returned,
+ * and game logic stays deterministic. Most of the hits come from standing actors, which query the same pairs of
+ * positions frame after frame.
+ *
+ * Cache has to be invalidated whenever the indoor geometry changes, i.e. when doors move or when a new level is
+ * loaded.
+ */
+class LineOfSightCache {
+ public:
+    /**
+     * @return                          Cached visibility for the provided ray, or `std::nullopt` if there is no cache
+     *                                  entry. Updates the hit / miss counters.
+     */
+    [[nodiscard]] std::optional<bool> find(int sector1, int sector2, const Vec3f &pos1, const Vec3f &pos2);
+
+    /**
+     * @param visible                   Result of the line of sight check.
+     * @param cost                      Time spent on the check, used to estimate time saved by the cache.
+     */
+    void insert(int sector1, int sector2, const Vec3f &pos1, const Vec3f &pos2, bool visible, std::chrono::nanoseconds cost);
+
+    /**
+     * Drops all cached entries. Counters are left intact.
+     */
+    void invalidate();
+
+    void resetStats();
+
+    [[nodiscard]] size_t hits() const {
+        return _hits;
+    }
+
+    [[nodiscard]] size_t misses() const {
+        return _misses;
+    }
+
+    /**
+     * @return                          Estimated time saved by the cache, computed as the number of hits times the
+     *                                  average cost of a miss.
+     */
+    [[nodiscard]] std::chrono::nanoseconds savedTime() const;
+
+ private:
+    struct Key {
+        int sector1;
+        int sector2;
+        std::array<uint32_t, 6> coords; // Bit patterns of both positions.
+
+        friend bool operator==(const Key &l, const Key &r) = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    [[nodiscard]] static Key makeKey(int sector1, int sector2, const Vec3f &pos1, const Vec3f &pos2);
+
+ private:
+    std::unordered_map<Key, bool, KeyHash> _entries;
+    size_t _hits = 0;
+    size_t _misses = 0;
+    std::chrono::nanoseconds _missTime = {};
+};
+
+extern LineOfSightCache lineOfSightCache;
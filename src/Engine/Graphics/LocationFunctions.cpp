@@ -1,9 +1,20 @@
 #include "LocationFunctions.h"
 
 #include <cassert>
+#include <string>
+#include <vector>
 
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/Decoration.h"
+#include "Engine/Objects/DecorationList.h"
+#include "Engine/Objects/Monsters.h"
+#include "Engine/LodSpriteCache.h"
+#include "Engine/LodTextureCache.h"
+
+#include "Image.h"
 #include "Indoor.h"
 #include "Outdoor.h"
+#include "Sprites.h"
 
 LevelType uCurrentlyLoadedLevelType = LEVEL_NULL;
 
@@ -37,3 +48,33 @@ LocationTime &currentLocationTime() {
         return pOutdoor->loc_time;
     }
 }
+
+template<class Face>
+static void collectFaceTextureNames(Face &face, std::vector<std::string> *names) {
+    if (face.IsTextureFrameTable() || !face.resource)
+        return;
+
+    names->push_back(static_cast<GraphicsImage *>(face.resource)->GetName());
+}
+
+void prefetchLocationAssets() {
+    std::vector<std::string> textureNames;
+    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+        for (BLVFace &face : pIndoor->pFaces)
+            collectFaceTextureNames(face, &textureNames);
+    } else if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) {
+        for (BSPModel &model : pOutdoor->pBModels)
+            for (ODMFace &face : model.pFaces)
+                collectFaceTextureNames(face, &textureNames);
+    }
+
+    std::vector<std::string> spriteNames;
+    for (const LevelDecoration &decoration : pLevelDecorations)
+        pSpriteFrameTable->collectSpriteNames(pDecorationList->GetDecoration(decoration.uDecorationDescID)->uSpriteID, &spriteNames);
+    for (const Actor &actor : pActors)
+        for (const std::string &name : pMonsterList->monsters[actor.monsterInfo.id].spriteNames)
+            pSpriteFrameTable->collectSpriteNames(pSpriteFrameTable->FastFindSprite(name), &spriteNames);
+
+    pBitmaps_LOD->prefetchTextures(textureNames);
+    pSprites_LOD->prefetchSprites(spriteNames);
+}
@@ -13,3 +13,10 @@ bool GetAlertStatus();
 
 LocationInfo &currentLocationInfo();
 LocationTime &currentLocationTime();
+
+/**
+ * Scans the currently loaded location for face textures, decoration sprites and monster sprites, and decodes them on
+ * a set of worker threads into the LOD caches. Called during location load, after the actors were spawned, so that
+ * subsequent texture & sprite loads don't have to decode anything on the main thread.
+ */
+void prefetchLocationAssets();
@@ -15,6 +15,7 @@
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/LightmapBuilder.h"
 #include "Engine/Graphics/LightsStack.h"
+#include "Engine/Graphics/LocationFunctions.h"
 #include "Engine/Graphics/ParticleEngine.h"
 #include "Engine/Graphics/Sprites.h"
 #include "Engine/Graphics/Viewport.h"
@@ -420,6 +421,8 @@ void OutdoorLocation::CreateDebugLocation() {
 
     this->pOMAP.fill(0);
     this->pFaceIDLIST.clear();
+    this->faceGrid.clear();
+    this->collisionMesh.clear();
     this->sky_texture_filename = "plansky1";
     this->sky_texture = assets->getBitmap(this->sky_texture_filename);
 }
@@ -434,6 +437,8 @@ void OutdoorLocation::Release() {
     pBModels.clear();
     pSpawnPoints.clear();
     pFaceIDLIST.clear();
+    faceGrid.clear();
+    collisionMesh.clear();
 
     // free shader data for outdoor location
     render->ReleaseTerrain();
@@ -472,6 +477,7 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     OutdoorLocation_MM7 location;
     deserialize(lod::decodeCompressed(pGames_LOD->read(odm_filename)), &location); // read throws.
     reconstruct(location, this);
+    faceGrid.build(pBModels);
 
     // ****************.ddm file*********************//
 
@@ -527,6 +533,7 @@ void OutdoorLocation::Load(std::string_view filename, int days_played, int respa
     }
 
     reconstruct(delta, this);
+    collisionMesh.build(pBModels); // Face attributes come from the delta, so build after loading it.
 
     if (respawnTimed || respawnInitial)
         ddm.lastRespawnDay = days_played;
@@ -870,45 +877,42 @@ float ODM_GetFloorLevel(const Vec3f &pos, bool *pIsOnWater, int *faceId) {
     *pIsOnWater = pOutdoor->pTerrain.isWaterByPos(pos);
 
     int surface_count = 1;
+    int slack = engine->config->gameplay.FloorChecksEps.value();
 
-    for (BSPModel &model : pOutdoor->pBModels) {
+    for (OutdoorFaceGrid::FaceRef ref : pOutdoor->faceGrid.facesAt(pos.x, pos.y)) {
+        BSPModel &model = pOutdoor->pBModels[ref.modelId];
         if (!model.pBoundingBox.containsXY(pos.x, pos.y))
             continue;
 
-        if (model.pFaces.empty())
+        ODMFace &face = model.pFaces[ref.faceId];
+        if (face.Ethereal())
             continue;
 
-        for (ODMFace &face : model.pFaces) {
-            if (face.Ethereal())
-                continue;
-
-            if (face.uNumVertices == 0)
-                continue;
-
-            if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
-                continue;
+        if (face.uNumVertices == 0)
+            continue;
 
-            if (!face.pBoundingBox.containsXY(pos.x, pos.y))
-                continue;
+        if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
+            continue;
 
-            int slack = engine->config->gameplay.FloorChecksEps.value();
-            if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
-                continue;
+        if (!face.pBoundingBox.containsXY(pos.x, pos.y))
+            continue;
 
-            int floor_level;
-            if (face.uPolygonType == POLYGON_Floor) {
-                floor_level = model.pVertices[face.pVertexIDs[0]].z;
-            } else {
-                floor_level = face.zCalc.calculate(pos.x, pos.y);
-            }
-            odm_floor_level[surface_count] = floor_level;
-            current_BModel_id[surface_count] = model.index;
-            current_Face_id[surface_count] = face.index;
-            surface_count++;
+        if (!face.Contains(pos, model.index, slack, FACE_XY_PLANE))
+            continue;
 
-            if (surface_count >= 20)
-                break;
+        int floor_level;
+        if (face.uPolygonType == POLYGON_Floor) {
+            floor_level = model.pVertices[face.pVertexIDs[0]].z;
+        } else {
+            floor_level = face.zCalc.calculate(pos.x, pos.y);
         }
+        odm_floor_level[surface_count] = floor_level;
+        current_BModel_id[surface_count] = model.index;
+        current_Face_id[surface_count] = face.index;
+        surface_count++;
+
+        if (surface_count >= 20)
+            break;
     }
 
     if (surface_count == 1) {
@@ -1870,6 +1874,7 @@ static void loadAndPrepareODMInternal(MapId mapid) {
         }
         RespawnGlobalDecorations();
     }
+    prefetchLocationAssets();
     pOutdoor->PrepareDecorations();
     pOutdoor->ArrangeSpriteObjects();
     pOutdoor->InitalizeActors(mapid);
@@ -14,6 +14,8 @@
 #include "LocationInfo.h"
 #include "LocationTime.h"
 #include "LocationFunctions.h"
+#include "OutdoorCollisionMesh.h"
+#include "OutdoorFaceGrid.h"
 #include "OutdoorTerrain.h"
 
 struct DecalBuilder;
@@ -83,6 +85,8 @@ struct OutdoorLocation {
     std::vector<BSPModel> pBModels;
     std::vector<Pid> pFaceIDLIST;
     std::array<uint32_t, 128 * 128> pOMAP;
+    OutdoorFaceGrid faceGrid; // Spatial index over pBModels faces, rebuilt on load.
+    OutdoorCollisionMesh collisionMesh; // Flattened pBModels faces for collisions, rebuilt on load.
     GraphicsImage *sky_texture = nullptr;        // signed int sSky_TextureID;
     std::vector<SpawnPoint> pSpawnPoints;
     LocationInfo ddm;
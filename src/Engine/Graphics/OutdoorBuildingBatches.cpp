@@ -0,0 +1,225 @@
+#include "OutdoorBuildingBatches.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <utility>
+
+#include "BSPModel.h"
+
+void OutdoorBuildingBatches::build(std::vector<BSPModel> &models, TextureResolver resolver, bool saturateSecretFaces) {
+    clear();
+    _resolver = std::move(resolver);
+    buildLayout(models, saturateSecretFaces);
+}
+
+void OutdoorBuildingBatches::clear() {
+    _resolver = nullptr;
+    _textureLayers.clear();
+    _modelOffsets.clear();
+    _faceSlots.clear();
+    _faceStates.clear();
+    _modelRanges.clear();
+    _vertices.clear();
+    _dirtyRanges.clear();
+    for (std::vector<DrawRange> &ranges : _drawRanges)
+        ranges.clear();
+    _faceUpdates = 0;
+}
+
+void OutdoorBuildingBatches::prepareFrame(std::vector<BSPModel> &models, std::span<const int> visibleModelIds,
+                                          bool saturateSecretFaces) {
+    assert(_modelOffsets.size() == models.size());
+
+    _dirtyRanges.clear();
+
+    bool relayout = false;
+    for (int modelId : visibleModelIds) {
+        BSPModel &model = models[modelId];
+        for (ODMFace &face : model.pFaces) {
+            int faceIndex = _modelOffsets[modelId] + face.index;
+            const FaceSlot &slot = _faceSlots[faceIndex];
+            if (slot.first == -1 && face.uNumVertices < 3)
+                continue;
+
+            FaceState state = faceState(face, saturateSecretFaces);
+            const FaceState &oldState = _faceStates[faceIndex];
+            if (state.texture == oldState.texture && state.attribflags == oldState.attribflags &&
+                state.visible == oldState.visible)
+                continue;
+
+            _faceStates[faceIndex] = state;
+            if (state.texture && (slot.first == -1 || slot.unit != state.layer.unit)) {
+                relayout = true; // Face has moved to another batch.
+                continue;
+            }
+
+            if (slot.first == -1)
+                continue;
+
+            writeFace(model, face, faceIndex);
+            _dirtyRanges.push_back({slot.first, slot.count});
+            _faceUpdates++;
+        }
+    }
+
+    if (relayout) {
+        buildLayout(models, saturateSecretFaces);
+        _dirtyRanges.clear();
+    } else if (!_dirtyRanges.empty()) {
+        std::ranges::sort(_dirtyRanges, std::less(), &DrawRange::first);
+
+        size_t size = 1;
+        for (size_t i = 1; i < _dirtyRanges.size(); i++) {
+            DrawRange &last = _dirtyRanges[size - 1];
+            if (_dirtyRanges[i].first <= last.first + last.count) {
+                last.count = std::max(last.count, _dirtyRanges[i].first + _dirtyRanges[i].count - last.first);
+            } else {
+                _dirtyRanges[size++] = _dirtyRanges[i];
+            }
+        }
+        _dirtyRanges.resize(size);
+    }
+
+    int modelCount = models.size();
+    for (int unit = 0; unit < MAX_TEXTURE_UNITS; unit++) {
+        std::vector<DrawRange> &ranges = _drawRanges[unit];
+        ranges.clear();
+
+        for (int modelId : visibleModelIds) {
+            const DrawRange &range = _modelRanges[unit * modelCount + modelId];
+            if (range.count == 0)
+                continue;
+
+            if (!ranges.empty() && ranges.back().first + ranges.back().count == range.first) {
+                ranges.back().count += range.count;
+            } else {
+                ranges.push_back(range);
+            }
+        }
+    }
+}
+
+int OutdoorBuildingBatches::attribFlags(const ODMFace &face, bool saturateSecretFaces) {
+    int attribflags = 0;
+
+    if (face.uAttributes & FACE_IsFluid)
+        attribflags |= 2;
+    if (face.uAttributes & FACE_INDOOR_SKY)
+        attribflags |= 0x400;
+
+    if (face.uAttributes & FACE_FlowDown)
+        attribflags |= 0x400;
+    else if (face.uAttributes & FACE_FlowUp)
+        attribflags |= 0x800;
+
+    if (face.uAttributes & FACE_FlowRight)
+        attribflags |= 0x2000;
+    else if (face.uAttributes & FACE_FlowLeft)
+        attribflags |= 0x1000;
+
+    if (face.uAttributes & FACE_IsLava)
+        attribflags |= 0x4000;
+
+    if (face.uAttributes & FACE_OUTLINED || (face.uAttributes & FACE_IsSecret) && saturateSecretFaces)
+        attribflags |= 0x00010000;
+
+    return attribflags;
+}
+
+void OutdoorBuildingBatches::buildLayout(std::vector<BSPModel> &models, bool saturateSecretFaces) {
+    int modelCount = models.size();
+
+    _modelOffsets.clear();
+    _faceStates.clear();
+    for (BSPModel &model : models) {
+        assert(model.index == _modelOffsets.size());
+        _modelOffsets.push_back(_faceStates.size());
+        for (ODMFace &face : model.pFaces)
+            _faceStates.push_back(faceState(face, saturateSecretFaces));
+    }
+
+    // Assign vertex ranges, unit-major so that each (unit, model) pair ends up contiguous.
+    _faceSlots.assign(_faceStates.size(), FaceSlot());
+    _modelRanges.assign(MAX_TEXTURE_UNITS * modelCount, DrawRange());
+    int vertexCount = 0;
+    for (int unit = 0; unit < MAX_TEXTURE_UNITS; unit++) {
+        for (const BSPModel &model : models) {
+            DrawRange &range = _modelRanges[unit * modelCount + model.index];
+            range.first = vertexCount;
+
+            for (const ODMFace &face : model.pFaces) {
+                int faceIndex = _modelOffsets[model.index] + face.index;
+                const FaceState &state = _faceStates[faceIndex];
+                if (!state.texture || state.layer.unit != unit || face.uNumVertices < 3)
+                    continue;
+
+                FaceSlot &slot = _faceSlots[faceIndex];
+                slot.first = vertexCount;
+                slot.count = 3 * (face.uNumVertices - 2);
+                slot.unit = unit;
+                vertexCount += slot.count;
+            }
+
+            range.count = vertexCount - range.first;
+        }
+    }
+
+    _vertices.resize(vertexCount);
+    for (const BSPModel &model : models)
+        for (const ODMFace &face : model.pFaces)
+            if (_faceSlots[_modelOffsets[model.index] + face.index].first != -1)
+                writeFace(model, face, _modelOffsets[model.index] + face.index);
+
+    _layoutVersion++;
+}
+
+OutdoorBuildingBatches::FaceState OutdoorBuildingBatches::faceState(ODMFace &face, bool saturateSecretFaces) {
+    FaceState result;
+    result.texture = face.GetTexture();
+    result.attribflags = attribFlags(face, saturateSecretFaces);
+    result.visible = !face.Invisible();
+    if (result.texture)
+        result.layer = textureLayer(result.texture);
+    return result;
+}
+
+OutdoorBuildingBatches::TextureLayer OutdoorBuildingBatches::textureLayer(GraphicsImage *texture) {
+    auto pos = _textureLayers.find(texture);
+    if (pos != _textureLayers.end())
+        return pos->second;
+
+    TextureLayer result = _resolver ? _resolver(texture) : TextureLayer();
+    assert(result.unit >= 0 && result.unit < MAX_TEXTURE_UNITS);
+    _textureLayers.emplace(texture, result);
+    return result;
+}
+
+void OutdoorBuildingBatches::writeFace(const BSPModel &model, const ODMFace &face, int faceIndex) {
+    const FaceSlot &slot = _faceSlots[faceIndex];
+    const FaceState &state = _faceStates[faceIndex];
+    Vertex *thisvert = &_vertices[slot.first];
+
+    if (!state.visible) {
+        std::fill_n(thisvert, slot.count, Vertex()); // Degenerate triangles, rasterize into nothing.
+        return;
+    }
+
+    for (int z = 0; z < (face.uNumVertices - 2); z++) {
+        // 123, 134, 145, 156..
+        for (int i : {0, z + 1, z + 2}) {
+            thisvert->x = model.pVertices[face.pVertexIDs[i]].x;
+            thisvert->y = model.pVertices[face.pVertexIDs[i]].y;
+            thisvert->z = model.pVertices[face.pVertexIDs[i]].z;
+            thisvert->u = face.pTextureUIDs[i] + face.sTextureDeltaU;
+            thisvert->v = face.pTextureVIDs[i] + face.sTextureDeltaV;
+            thisvert->texunit = state.layer.unit;
+            thisvert->texturelayer = state.layer.layer;
+            thisvert->normx = face.facePlane.normal.x;
+            thisvert->normy = face.facePlane.normal.y;
+            thisvert->normz = face.facePlane.normal.z;
+            thisvert->attribs = state.attribflags;
+            thisvert++;
+        }
+    }
+}
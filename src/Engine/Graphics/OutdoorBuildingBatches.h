@@ -0,0 +1,148 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Graphics/FaceEnums.h"
+
+class BSPModel;
+class GraphicsImage;
+struct ODMFace;
+
+/**
+ * Renderer-agnostic vertex batches for outdoor BSP model geometry.
+ *
+ * Vertices for all model faces are baked once into a single buffer, grouped by texture unit, then by model, then by
+ * face. This way every (unit, model) pair maps onto a single contiguous vertex range, and the per-frame work boils
+ * down to culling models & emitting these ranges.
+ *
+ * Faces can still change at runtime - they can be hidden or shown by events, get a new texture, or cycle through a
+ * texture animation. These changes are picked up in `prepareFrame` for the visible models only. Faces that stay in
+ * the same texture unit are rewritten in place and reported through `dirtyRanges`, invisible faces are kept as
+ * degenerate triangles. If a face has to move to another texture unit, the whole layout is rebuilt and
+ * `layoutVersion` is bumped, in which case the renderer is expected to re-upload the whole buffer.
+ */
+class OutdoorBuildingBatches {
+ public:
+    static constexpr int MAX_TEXTURE_UNITS = 16;
+
+    struct Vertex {
+        float x;
+        float y;
+        float z;
+        float u;
+        float v;
+        float texunit;
+        float texturelayer;
+        float normx;
+        float normy;
+        float normz;
+        float attribs;
+    };
+
+    struct TextureLayer {
+        int unit = 0;
+        int layer = 0;
+    };
+
+    struct DrawRange {
+        int first = 0;
+        int count = 0;
+    };
+
+    /** Maps textures onto texture array slots. Called once per texture, results are cached. */
+    using TextureResolver = std::function<TextureLayer(GraphicsImage *)>;
+
+    /**
+     * Bakes the vertex batches for the provided models.
+     *
+     * @param models                    Outdoor models.
+     * @param resolver                  Texture resolver.
+     * @param saturateSecretFaces       Whether secret faces should be highlighted, see `Engine::is_saturate_faces`.
+     */
+    void build(std::vector<BSPModel> &models, TextureResolver resolver, bool saturateSecretFaces);
+
+    void clear();
+
+    /**
+     * Picks up face changes in the visible models & recalculates the draw ranges.
+     *
+     * @param models                    Outdoor models, same as the ones passed to `build`.
+     * @param visibleModelIds           Ids of the models to draw, in ascending order.
+     * @param saturateSecretFaces       Whether secret faces should be highlighted.
+     */
+    void prepareFrame(std::vector<BSPModel> &models, std::span<const int> visibleModelIds, bool saturateSecretFaces);
+
+    [[nodiscard]] std::span<const Vertex> vertices() const {
+        return _vertices;
+    }
+
+    /**
+     * @return                          Layout version, bumped every time the vertex buffer is rebuilt from scratch.
+     */
+    [[nodiscard]] int layoutVersion() const {
+        return _layoutVersion;
+    }
+
+    /**
+     * @return                          Vertex ranges that were rewritten in the last call to `prepareFrame`, sorted
+     *                                  and merged.
+     */
+    [[nodiscard]] std::span<const DrawRange> dirtyRanges() const {
+        return _dirtyRanges;
+    }
+
+    /**
+     * @param unit                      Texture unit.
+     * @return                          Vertex ranges to draw for the provided texture unit, as calculated in the last
+     *                                  call to `prepareFrame`.
+     */
+    [[nodiscard]] std::span<const DrawRange> drawRanges(int unit) const {
+        return _drawRanges[unit];
+    }
+
+    /**
+     * @return                          Number of face vertex rewrites since the last call to `build`.
+     */
+    [[nodiscard]] int faceUpdates() const {
+        return _faceUpdates;
+    }
+
+    [[nodiscard]] static int attribFlags(const ODMFace &face, bool saturateSecretFaces);
+
+ private:
+    struct FaceState {
+        GraphicsImage *texture = nullptr;
+        int attribflags = 0;
+        bool visible = false;
+        TextureLayer layer;
+    };
+
+    struct FaceSlot {
+        int first = -1; // -1 for faces without vertices in the buffer.
+        int count = 0;
+        int unit = -1;
+    };
+
+    void buildLayout(std::vector<BSPModel> &models, bool saturateSecretFaces);
+    [[nodiscard]] FaceState faceState(ODMFace &face, bool saturateSecretFaces);
+    [[nodiscard]] TextureLayer textureLayer(GraphicsImage *texture);
+    void writeFace(const BSPModel &model, const ODMFace &face, int faceIndex);
+
+ private:
+    TextureResolver _resolver;
+    std::unordered_map<GraphicsImage *, TextureLayer> _textureLayers;
+    std::vector<int> _modelOffsets; // Offsets into `_faceSlots` & `_faceStates`, same as in `OutdoorCollisionMesh`.
+    std::vector<FaceSlot> _faceSlots;
+    std::vector<FaceState> _faceStates;
+    std::vector<DrawRange> _modelRanges; // Indexed by `unit * modelCount + modelId`.
+    std::vector<Vertex> _vertices;
+    std::vector<DrawRange> _dirtyRanges;
+    std::array<std::vector<DrawRange>, MAX_TEXTURE_UNITS> _drawRanges;
+    int _layoutVersion = 0;
+    int _faceUpdates = 0;
+};
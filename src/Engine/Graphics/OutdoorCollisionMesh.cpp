@@ -0,0 +1,86 @@
+#include "OutdoorCollisionMesh.h"
+
+#include "Utility/Math/Float.h"
+
+#include "BSPModel.h"
+
+void OutdoorCollisionMesh::build(const std::vector<BSPModel> &models) {
+    clear();
+
+    for (const BSPModel &model : models) {
+        _modelOffsets.push_back(_planes.size());
+
+        for (const ODMFace &face : model.pFaces) {
+            _planes.push_back(face.facePlane);
+            _bboxes.push_back(face.pBoundingBox);
+            _attributes.push_back(face.uAttributes & COLLISION_ATTRIBUTES);
+
+            // Note that the projections are chosen differently for query points & face vertices when the plane flags
+            // are missing or inconsistent. This mirrors what BLVFace::Contains & BLVFace::Flatten do.
+            FaceAttributes plane = face.uAttributes & (FACE_XY_PLANE | FACE_YZ_PLANE | FACE_XZ_PLANE);
+            Projection queryProjection = (plane & FACE_XY_PLANE) ? Projection::XY : (plane & FACE_YZ_PLANE) ? Projection::YZ : Projection::XZ;
+            Projection vertexProjection = (plane & FACE_XY_PLANE) ? Projection::XY : (plane & FACE_XZ_PLANE) ? Projection::XZ : Projection::YZ;
+            _projections.push_back(queryProjection);
+
+            _vertexOffsets.push_back(_vertices.size());
+            for (int i = 0; i < face.uNumVertices; i++)
+                _vertices.push_back(model.pVertices[face.pVertexIDs[i]]);
+
+            for (int i = 0, j = face.uNumVertices - 1; i < face.uNumVertices; j = i++) {
+                Vec2f origin = project(model.pVertices[face.pVertexIDs[i]], vertexProjection);
+                Vec2f prev = project(model.pVertices[face.pVertexIDs[j]], vertexProjection);
+                _edges.push_back({origin, Vec2f(prev.x - origin.x, prev.y - origin.y)});
+            }
+        }
+    }
+
+    _vertexOffsets.push_back(_vertices.size());
+}
+
+void OutdoorCollisionMesh::clear() {
+    _modelOffsets.clear();
+    _planes.clear();
+    _bboxes.clear();
+    _attributes.clear();
+    _projections.clear();
+    _vertexOffsets.clear();
+    _vertices.clear();
+    _edges.clear();
+}
+
+bool OutdoorCollisionMesh::contains(int face, const Vec3f &pos) const {
+    uint32_t begin = _vertexOffsets[face];
+    uint32_t end = _vertexOffsets[face + 1];
+    if (end - begin < 3)
+        return false; // This does happen.
+
+    Vec2f point = project(pos, _projections[face]);
+
+    // Faces are convex, so we just check that the point lies on the same side relative to all of the edges.
+    int sign = 0;
+    for (uint32_t i = begin; i < end; i++) {
+        const Edge &edge = _edges[i];
+        float b_u = point.x - edge.origin.x;
+        float b_v = point.y - edge.origin.y;
+        float cross_product = edge.delta.x * b_v - edge.delta.y * b_u;
+        if (fuzzyIsNull(cross_product))
+            continue;
+
+        int cross_sign = static_cast<int>(cross_product > 0) * 2 - 1;
+        if (sign == 0) {
+            sign = cross_sign;
+        } else if (sign != cross_sign) {
+            return false;
+        }
+    }
+
+    return sign != 0;
+}
+
+Vec2f OutdoorCollisionMesh::project(const Vec3f &pos, Projection projection) {
+    switch (projection) {
+        case Projection::XY: return Vec2f(pos.x, pos.y);
+        case Projection::XZ: return Vec2f(pos.x, pos.z);
+        default: return Vec2f(pos.y, pos.z);
+    }
+}
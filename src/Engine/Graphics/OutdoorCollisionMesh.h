@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Engine/Graphics/FaceEnums.h"
+
+#include "Library/Geometry/BBox.h"
+#include "Library/Geometry/Plane.h"
+#include "Library/Geometry/Vec.h"
+
+class BSPModel;
+
+/**
+ * Flattened representation of outdoor BSP model faces that's used by the collision code.
+ *
+ * Everything that collisions need is precomputed on load & stored contiguously: face planes, bounding boxes,
+ * world-space vertices, and 2D edges projected onto the face's native plane. This way collision routines don't need
+ * to chase `BSPModel::pVertices` through vertex ids, and don't need to re-flatten faces on every containment check.
+ *
+ * Only collision-relevant face attributes are stored, see `COLLISION_ATTRIBUTES`. These can change at runtime (e.g.
+ * through `setFacesBit`), and thus should be kept in sync with `ODMFace::uAttributes` through `setAttributes`.
+ */
+class OutdoorCollisionMesh {
+ public:
+    static constexpr FaceAttributes COLLISION_ATTRIBUTES =
+        FACE_XY_PLANE | FACE_XZ_PLANE | FACE_YZ_PLANE | FACE_IsPortal | FACE_ETHEREAL;
+
+    void build(const std::vector<BSPModel> &models);
+    void clear();
+
+    [[nodiscard]] int faceIndex(int modelId, int faceId) const {
+        return _modelOffsets[modelId] + faceId;
+    }
+
+    void setAttributes(int modelId, int faceId, FaceAttributes attributes) {
+        _attributes[faceIndex(modelId, faceId)] = attributes & COLLISION_ATTRIBUTES;
+    }
+
+    [[nodiscard]] const Planef &plane(int face) const {
+        return _planes[face];
+    }
+
+    [[nodiscard]] const BBoxf &bbox(int face) const {
+        return _bboxes[face];
+    }
+
+    [[nodiscard]] FaceAttributes attributes(int face) const {
+        return _attributes[face];
+    }
+
+    [[nodiscard]] std::span<const Vec3f> vertices(int face) const {
+        return std::span(_vertices).subspan(_vertexOffsets[face], _vertexOffsets[face + 1] - _vertexOffsets[face]);
+    }
+
+    /**
+     * Same as `BLVFace::Contains` with default `slack` and `override_plane`, but works on precomputed data.
+     *
+     * @param face                      Face index, as returned by `faceIndex`.
+     * @param pos                       Point to check. Should lie on the face plane.
+     * @return                          Whether the provided point lies inside the face.
+     */
+    [[nodiscard]] bool contains(int face, const Vec3f &pos) const;
+
+ private:
+    enum class Projection : uint8_t {
+        XY,
+        XZ,
+        YZ
+    };
+
+    struct Edge {
+        Vec2f origin; // Projected vertex.
+        Vec2f delta; // Vector from this vertex to the previous one.
+    };
+
+    [[nodiscard]] static Vec2f project(const Vec3f &pos, Projection projection);
+
+ private:
+    std::vector<int> _modelOffsets;
+    std::vector<Planef> _planes;
+    std::vector<BBoxf> _bboxes;
+    std::vector<FaceAttributes> _attributes;
+    std::vector<Projection> _projections; // Projection used for the points passed to `contains`.
+    std::vector<uint32_t> _vertexOffsets; // Face count + 1 offsets into `_vertices` and `_edges`.
+    std::vector<Vec3f> _vertices;
+    std::vector<Edge> _edges;
+};
@@ -0,0 +1,84 @@
+#include "OutdoorFaceGrid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "BSPModel.h"
+
+void OutdoorFaceGrid::build(const std::vector<BSPModel> &models) {
+    clear();
+
+    auto forEachCell = [](const BBoxf &box, auto &&callback) {
+        int x1 = cellCoord(box.x1), x2 = cellCoord(box.x2);
+        int y1 = cellCoord(box.y1), y2 = cellCoord(box.y2);
+        for (int y = y1; y <= y2; y++)
+            for (int x = x1; x <= x2; x++)
+                callback(y * GRID_SIZE + x);
+    };
+
+    // Count pass, offsets are shifted by one so that the fill pass can use them as insertion points.
+    _cellOffsets.assign(GRID_SIZE * GRID_SIZE + 1, 0);
+    for (const BSPModel &model : models)
+        for (const ODMFace &face : model.pFaces)
+            forEachCell(face.pBoundingBox, [&](int cell) { _cellOffsets[cell + 1]++; });
+
+    for (size_t i = 1; i < _cellOffsets.size(); i++)
+        _cellOffsets[i] += _cellOffsets[i - 1];
+
+    // Fill pass. Models & faces are visited in order, so each cell ends up sorted.
+    std::vector<uint32_t> positions(_cellOffsets.begin(), _cellOffsets.end() - 1);
+    _cellFaces.resize(_cellOffsets.back());
+    for (const BSPModel &model : models) {
+        assert(model.index >= 0 && model.index <= UINT16_MAX);
+        for (const ODMFace &face : model.pFaces) {
+            FaceRef ref = {static_cast<uint16_t>(model.index), static_cast<uint16_t>(face.index)};
+            forEachCell(face.pBoundingBox, [&](int cell) { _cellFaces[positions[cell]++] = ref; });
+        }
+    }
+}
+
+void OutdoorFaceGrid::clear() {
+    _cellOffsets.clear();
+    _cellFaces.clear();
+    _queryBuffer.clear();
+}
+
+std::span<const OutdoorFaceGrid::FaceRef> OutdoorFaceGrid::facesAt(float x, float y) const {
+    if (_cellOffsets.empty())
+        return {};
+
+    int cell = cellCoord(y) * GRID_SIZE + cellCoord(x);
+    return std::span(_cellFaces).subspan(_cellOffsets[cell], _cellOffsets[cell + 1] - _cellOffsets[cell]);
+}
+
+std::span<const OutdoorFaceGrid::FaceRef> OutdoorFaceGrid::facesIn(const BBoxf &box) {
+    if (_cellOffsets.empty())
+        return {};
+
+    int x1 = cellCoord(box.x1), x2 = cellCoord(box.x2);
+    int y1 = cellCoord(box.y1), y2 = cellCoord(box.y2);
+    if (x1 == x2 && y1 == y2)
+        return facesAt(box.x1, box.y1);
+
+    _queryBuffer.clear();
+    for (int y = y1; y <= y2; y++) {
+        for (int x = x1; x <= x2; x++) {
+            int cell = y * GRID_SIZE + x;
+            _queryBuffer.insert(_queryBuffer.end(), _cellFaces.begin() + _cellOffsets[cell], _cellFaces.begin() + _cellOffsets[cell + 1]);
+        }
+    }
+
+    std::sort(_queryBuffer.begin(), _queryBuffer.end());
+    _queryBuffer.erase(std::unique(_queryBuffer.begin(), _queryBuffer.end()), _queryBuffer.end());
+    return _queryBuffer;
+}
+
+int OutdoorFaceGrid::cellCoord(float v) {
+    // Same mapping as in terrain's worldToGrid, but without flipping the y axis. Cells at the edges absorb everything
+    // that's outside the map. NaNs end up in cell 0.
+    float cell = std::floor(v / CELL_SIZE) + GRID_SIZE / 2;
+    if (!(cell >= 0))
+        return 0;
+    return static_cast<int>(std::min(cell, GRID_SIZE - 1.0f));
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <compare>
+#include <span>
+#include <vector>
+
+#include "Library/Geometry/BBox.h"
+
+class BSPModel;
+
+/**
+ * Uniform 2D grid over outdoor BSP model faces, used to quickly find the faces that might be under a given point or
+ * inside a given box.
+ *
+ * Grid has the same layout as the terrain grid, i.e. 128x128 cells 512 units wide. Each face is registered in every
+ * cell that its bounding box overlaps, so the returned candidate lists are conservative - callers are still expected
+ * to check the actual face bounding boxes.
+ *
+ * All queries return faces sorted by model index, then by face index, i.e. in the same order as a brute force loop
+ * over `OutdoorLocation::pBModels` would visit them. This is important for determinism.
+ */
+class OutdoorFaceGrid {
+ public:
+    struct FaceRef {
+        uint16_t modelId;
+        uint16_t faceId;
+
+        friend auto operator<=>(const FaceRef &l, const FaceRef &r) = default;
+    };
+
+    static constexpr int GRID_SIZE = 128;
+    static constexpr int CELL_SIZE = 512;
+
+    /**
+     * Rebuilds the grid from the provided models.
+     *
+     * @param models                    Models to build the grid for.
+     */
+    void build(const std::vector<BSPModel> &models);
+
+    void clear();
+
+    /**
+     * @param x                         World x coordinate.
+     * @param y                         World y coordinate.
+     * @return                          Candidate faces for the provided point. Returned span is valid until the next
+     *                                  call to `build` or `clear`.
+     */
+    [[nodiscard]] std::span<const FaceRef> facesAt(float x, float y) const;
+
+    /**
+     * @param box                       World-space box, z coordinates are ignored.
+     * @return                          Candidate faces for the provided box, without duplicates. Returned span is
+     *                                  valid until the next call to any of the non-const methods.
+     */
+    [[nodiscard]] std::span<const FaceRef> facesIn(const BBoxf &box);
+
+ private:
+    [[nodiscard]] static int cellCoord(float v);
+
+ private:
+    std::vector<uint32_t> _cellOffsets; // GRID_SIZE * GRID_SIZE + 1 offsets into `_cellFaces`, CSR-style.
+    std::vector<FaceRef> _cellFaces;
+    std::vector<FaceRef> _queryBuffer;
+};
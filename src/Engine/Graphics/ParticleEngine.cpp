@@ -1,5 +1,10 @@
 #include "Engine/Graphics/ParticleEngine.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
 #include "Engine/Graphics/Camera.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Random/Random.h"
@@ -46,61 +51,165 @@ void TrailParticleGenerator::UpdateParticles() {
     }
 }
 
+ParticleStore::ParticleStore(int capacity) {
+    setCapacity(capacity);
+}
+
+void ParticleStore::setCapacity(int capacity) {
+    assert(capacity > 0);
+
+    _capacity = capacity;
+    while (size() > _capacity)
+        remove(size() - 1);
+}
+
+void ParticleStore::clear() {
+    _types.clear();
+    _x.clear();
+    _y.clear();
+    _z.clear();
+    _shiftX.clear();
+    _shiftY.clear();
+    _shiftZ.clear();
+    _timeToLive.clear();
+    _rotationSpeeds.clear();
+    _angle.clear();
+    _colors.clear();
+    _lightColors.clear();
+    _textures.clear();
+    _paletteIds.clear();
+    _sizes.clear();
+}
+
+bool ParticleStore::add(const Particle_sw &particle, RandomEngine *rng) {
+    if (size() >= _capacity)
+        return false;
+
+    _types.push_back(particle.type);
+    _x.push_back(particle.x);
+    _y.push_back(particle.y);
+    _z.push_back(particle.z);
+    _shiftX.push_back(particle.r); // TODO: seems Particle_sw struct fields are mixed up here
+    _shiftY.push_back(particle.g);
+    _shiftZ.push_back(particle.b);
+    _timeToLive.push_back(particle.timeToLive.ticks());
+    _colors.push_back(particle.uDiffuse);
+    _lightColors.push_back(particle.uDiffuse);
+    _textures.push_back(particle.texture);
+    _paletteIds.push_back(particle.paletteID);
+    _sizes.push_back(particle.particle_size);
+    if (particle.type & ParticleType_Rotating) {
+        _rotationSpeeds.push_back(rng->random(256) - 128);
+        _angle.push_back(rng->random(TrigLUT.uIntegerDoublePi));
+    } else {
+        _rotationSpeeds.push_back(0);
+        _angle.push_back(0);
+    }
+    return true;
+}
+
+void ParticleStore::update(Duration time, RandomEngine *rng) {
+    assert(time > 0_ticks);
+    int64_t ticks = time.ticks();
+
+    // Drop expired particles first, so that the rest of the kernel only runs over the live ones.
+    for (int i = 0; i < size();) {
+        if (_timeToLive[i] <= ticks) {
+            remove(i);
+        } else {
+            i++;
+        }
+    }
+
+    // The loops below are kept branch-free & over separate arrays so that they get auto-vectorized.
+    int count = size();
+    const ParticleFlags *types = _types.data();
+    float *x = _x.data();
+    float *y = _y.data();
+    float *z = _z.data();
+    const float *shiftX = _shiftX.data();
+    const float *shiftY = _shiftY.data();
+    float *shiftZ = _shiftZ.data();
+    int64_t *timeToLive = _timeToLive.data();
+    int *angle = _angle.data();
+    const int *rotationSpeeds = _rotationSpeeds.data();
+
+    for (int i = 0; i < count; i++)
+        timeToLive[i] -= ticks;
+
+    // Dropping particles drop downward with acceleration.
+    float drop = ticks * 5.0f;
+    for (int i = 0; i < count; i++)
+        shiftZ[i] -= (types[i] & ParticleType_Dropping) ? drop : 0.0f;
+
+    // Ascending particles slowly float upward. This one can't be vectorized as random numbers have to be generated
+    // in particle order.
+    for (int i = 0; i < count; i++) {
+        if (types[i] & ParticleType_Ascending) {
+            x[i] += (rng->random(5) - 2) * ticks / 16.0f;
+            y[i] += (rng->random(5) - 2) * ticks / 16.0f;
+            z[i] += (rng->random(5) + 4) * ticks / 16.0f;
+        }
+    }
+
+    // Particle shift with time.
+    float shift = ticks / 128.0f;
+    for (int i = 0; i < count; i++) {
+        x[i] += shift * shiftX[i];
+        y[i] += shift * shiftY[i];
+        z[i] += shift * shiftZ[i];
+    }
+
+    for (int i = 0; i < count; i++)
+        angle[i] += ticks * rotationSpeeds[i] / 16;
+
+    // With time particles become more transparent.
+    // TODO(Nik-RE-dev): check colour format use in particles
+    for (int i = 0; i < count; i++) {
+        float dissipateFactor = std::min<int64_t>(2 * timeToLive[i], 255) / 255.0f;
+        _lightColors[i] = Color(floorf(_colors[i].r * dissipateFactor + 0.5f),
+                                floorf(_colors[i].g * dissipateFactor + 0.5f),
+                                floorf(_colors[i].b * dissipateFactor + 0.5f));
+    }
+}
+
+void ParticleStore::remove(int index) {
+    auto removeOne = [index]<class T>(std::vector<T> &array) {
+        array[index] = array.back();
+        array.pop_back();
+    };
+
+    removeOne(_types);
+    removeOne(_x);
+    removeOne(_y);
+    removeOne(_z);
+    removeOne(_shiftX);
+    removeOne(_shiftY);
+    removeOne(_shiftZ);
+    removeOne(_timeToLive);
+    removeOne(_rotationSpeeds);
+    removeOne(_angle);
+    removeOne(_colors);
+    removeOne(_lightColors);
+    removeOne(_textures);
+    removeOne(_paletteIds);
+    removeOne(_sizes);
+}
+
 ParticleEngine::ParticleEngine() {
     ResetParticles();
 }
 
 void ParticleEngine::ResetParticles() {
-    pParticles.fill({});
-    uStartParticle = PARTICLES_ARRAY_SIZE;
-    uEndParticle = 0;
+    _particles.clear();
+    _droppedParticles = 0;
     uTimeElapsed = 0_ticks;
 }
 
 void ParticleEngine::AddParticle(Particle_sw *particle) {
-    if (!pMiscTimer->isPaused()) {
-        Particle *freeParticle = nullptr;
-
-        for (int i = 0; i < pParticles.size(); i++) {
-            if (pParticles[i].type == ParticleType_Invalid) {
-                if (i < this->uStartParticle) {
-                    this->uStartParticle = i;
-                }
-                if (i > this->uEndParticle) {
-                    this->uEndParticle = i;
-                }
-                freeParticle = &pParticles[i];
-                break;
-            }
-        }
-
-        if (freeParticle) {
-            freeParticle->type = particle->type;
-            freeParticle->x = particle->x;
-            freeParticle->y = particle->y;
-            freeParticle->z = particle->z;
-            freeParticle->_x = particle->x;
-            freeParticle->_y = particle->y;
-            freeParticle->_z = particle->z;
-            freeParticle->shift_x = particle->r; // TODO: seems Particle_sw struct fields are mixed up here
-            freeParticle->shift_y = particle->g;
-            freeParticle->shift_z = particle->b;
-            freeParticle->uParticleColor = particle->uDiffuse;
-            freeParticle->uLightColor_bgr = particle->uDiffuse;
-            // v6 = (v4->uType & 4) == 0;
-            freeParticle->timeToLive = particle->timeToLive;
-            freeParticle->texture = particle->texture;
-            freeParticle->paletteID = particle->paletteID;
-            freeParticle->particle_size = particle->particle_size;
-            if (freeParticle->type & ParticleType_Rotating) {
-                freeParticle->rotation_speed = vrng->random(256) - 128;
-                freeParticle->angle = vrng->random(TrigLUT.uIntegerDoublePi);
-            } else {
-                freeParticle->rotation_speed = 0;
-                freeParticle->angle = 0;
-            }
-        }
-    }
+    if (!pMiscTimer->isPaused())
+        if (!_particles.add(*particle, vrng))
+            _droppedParticles++;
 }
 
 void ParticleEngine::Draw() {
@@ -114,9 +223,6 @@ void ParticleEngine::Draw() {
 }
 
 void ParticleEngine::UpdateParticles() {
-    unsigned uCurrentEnd = 0;
-    unsigned uCurrentBegin = PARTICLES_ARRAY_SIZE;
-
     // TODO(captainurist): checking pMiscTimer->isPaused(), then using pEventTimer->uTimeElapsed?
     Duration time = !pMiscTimer->isPaused() ? pEventTimer->dt() : 0_ticks;
 
@@ -124,110 +230,7 @@ void ParticleEngine::UpdateParticles() {
         return;
     }
 
-    for (unsigned int i = uStartParticle; i <= uEndParticle; ++i) {
-        Particle *p = &pParticles[i];
-
-        if (p->type == ParticleType_Invalid) {
-            continue;
-        }
-
-        if (p->timeToLive <= time) {
-            p->timeToLive = 0_ticks;
-            p->type = ParticleType_Invalid;
-            continue;
-        }
-
-        p->timeToLive -= time;
-
-        // Line particle type appear unused
-        if (p->type & ParticleType_Line) {
-            p->_x = p->x;
-            p->_y = p->y;
-            p->_z = p->z;
-        }
-
-        // Dropping particles drop downward with acceleration
-        if (p->type & ParticleType_Dropping) {
-            p->shift_z -= time.ticks() * 5.0;
-        }
-
-        // Ascending particles slowly float upward
-        if (p->type & ParticleType_Ascending) {
-            p->x += (vrng->random(5) - 2) * time.ticks() / 16.0;
-            p->y += (vrng->random(5) - 2) * time.ticks() / 16.0;
-            p->z += (vrng->random(5) + 4) * time.ticks() / 16.0;
-        }
-
-        // v9 = (signed int)(time * p->rotation_speed) / 16;
-
-        // Particle shift with time
-        double shift = time.ticks() / 128.0f;
-        p->x += shift * p->shift_x;
-        p->y += shift * p->shift_y;
-        p->z += shift * p->shift_z;
-
-        p->angle += time.ticks() * p->rotation_speed / 16;
-
-        // With time particles become more transparent
-        int dissipate_value = 2 * p->timeToLive.ticks();
-        if (dissipate_value >= 255) {
-            dissipate_value = 255;
-        }
-        float dissipate_factor = dissipate_value / 255.0f;
-        // v10 = (double)v22 * 0.0039215689;
-        // TODO(Nik-RE-dev): check colour format use in particles
-        p->uLightColor_bgr = Color(floorf(p->uParticleColor.r * dissipate_factor + 0.5),
-                                   floorf(p->uParticleColor.g * dissipate_factor + 0.5),
-                                   floorf(p->uParticleColor.b * dissipate_factor + 0.5));
-
-        if (i < uCurrentBegin) {
-           uCurrentBegin = i;
-        }
-        if (i > uCurrentEnd) {
-           uCurrentEnd = i;
-        }
-    }
-
-    uEndParticle = uCurrentEnd;
-    uStartParticle = uCurrentBegin;
-}
-
-bool ParticleEngine::ViewProject_TrueIfStillVisible_BLV(unsigned int uParticleID) {
-    Particle *pParticle;  // esi@1
-    int y_int_;           // [sp+10h] [bp-40h]@2
-    int x_int;            // [sp+20h] [bp-30h]@2
-    int z_int_;           // [sp+24h] [bp-2Ch]@2
-
-    pParticle = &this->pParticles[uParticleID];
-    if (pParticle->type == ParticleType_Invalid) return 0;
-    // uParticleID = LODWORD(pParticle->x);
-    // v56 = *(float *)&uParticleID + 6.7553994e15;
-    x_int = floorf(pParticle->x + 0.5f);
-    // uParticleID = LODWORD(pParticle->y);
-    // y_int_ = *(float *)&uParticleID + 6.7553994e15;
-    y_int_ = floorf(pParticle->y + 0.5f);
-    // uParticleID = LODWORD(pParticle->z);
-    // z_int_ = *(float *)&uParticleID + 6.7553994e15;
-    z_int_ = floorf(pParticle->z + 0.5f);
-
-    /*fixed x, y, z;*/
-    int xt, yt, zt;
-
-    if (!pCamera3D->ViewClip(x_int, y_int_, z_int_, &xt, &yt, &zt, 0)) return false;
-    pCamera3D->Project(xt, yt, zt, &pParticle->uScreenSpaceX, &pParticle->uScreenSpaceY);
-
-    pParticle->fov_x = pCamera3D->ViewPlaneDistPixels;
-
-    /*pParticle->screenspace_scale = fixed::FromFloat(pParticle->particle_size) *
-                                   fixed::FromFloat(pParticle->fov_x) / x;*/
-
-    pParticle->screenspace_scale = /*fixed::FromFloat*/(pParticle->particle_size) *
-        /*fixed::FromFloat*/(pParticle->fov_x) / /*fixed::FromInt*/(xt);
-
-    /*pParticle->zbuffer_depth = x.GetInt();*/
-    pParticle->zbuffer_depth = xt;
-
-    return true;
+    _particles.update(time, vrng);
 }
 
 void ParticleEngine::DrawParticles_BLV() {
@@ -235,80 +238,65 @@ void ParticleEngine::DrawParticles_BLV() {
 
     v15.sParentBillboardID = -1;
 
-    for (unsigned int i = uStartParticle; i <= uEndParticle; ++i) {
-        Particle *p = &pParticles[i];
+    for (int i = 0; i < _particles.size(); ++i) {
+        ParticleFlags type = _particles.type(i);
+        Vec3f pos = _particles.position(i);
 
-        if (p->type == ParticleType_Invalid) continue;
+        int x = floorf(pos.x + 0.5f);
+        int y = floorf(pos.y + 0.5f);
+        int z = floorf(pos.z + 0.5f);
+        int xt, yt, zt;
+        if (!pCamera3D->ViewClip(x, y, z, &xt, &yt, &zt, 0))
+            continue;
 
-        if (!ViewProject_TrueIfStillVisible_BLV(i)) continue;
+        int screenSpaceX, screenSpaceY;
+        pCamera3D->Project(xt, yt, zt, &screenSpaceX, &screenSpaceY);
+        float screenSpaceScale = _particles.particleSize(i) * pCamera3D->ViewPlaneDistPixels / xt;
+        short zbufferDepth = xt;
+        Color lightColor = _particles.lightColor(i);
 
-        // TODO(pskelton): reinstate this guard check
+        // TODO(pskelton): reinstate viewport guard check
         // TODO(Nik-RE-dev): all types except for Line appear to behave identically
-        if (true) {
-            /*p->uScreenSpaceX >= pBLVRenderParams->uViewportX &&
-            p->uScreenSpaceX < pBLVRenderParams->uViewportZ &&
-            p->uScreenSpaceY >= pBLVRenderParams->uViewportY &&
-            p->uScreenSpaceY < pBLVRenderParams->uViewportW) { */
-            if (p->type & ParticleType_Diffuse) {
-                // v14 = &pParticles[i];
-                v15.screenspace_projection_factor_x = p->screenspace_scale;
-                v15.screenspace_projection_factor_y = p->screenspace_scale;
-                v15.screen_space_x = p->uScreenSpaceX;
-                v15.screen_space_y = p->uScreenSpaceY;
-                v15.screen_space_z = p->zbuffer_depth;
-                v15.paletteID = p->paletteID;
-                render->MakeParticleBillboardAndPush(
-                    &v15, 0, p->uLightColor_bgr, p->angle);
-            } else if (p->type & ParticleType_Line) {  // type doesnt appear to be used
-                if (pLines.uNumLines < 100) {
-                    pLines.pLineVertices[2 * pLines.uNumLines].pos.x =
-                        p->uScreenSpaceX;
-                    pLines.pLineVertices[2 * pLines.uNumLines].pos.y =
-                        p->uScreenSpaceY;
-                    pLines.pLineVertices[2 * pLines.uNumLines].pos.z =
-                        1.0 - 1.0 / (p->zbuffer_depth * 0.061758894);
-                    pLines.pLineVertices[2 * pLines.uNumLines].rhw = 1.0;
-                    pLines.pLineVertices[2 * pLines.uNumLines].diffuse =
-                        p->uLightColor_bgr;
-                    pLines.pLineVertices[2 * pLines.uNumLines].specular = Color();
-                    pLines.pLineVertices[2 * pLines.uNumLines].texcoord.x = 0.0;
-                    pLines.pLineVertices[2 * pLines.uNumLines].texcoord.y = 0.0;
-
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].pos.x =
-                        p->uScreenSpaceZ;  // where is this set?
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].pos.y =
-                        p->uScreenSpaceW;
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].pos.z =
-                        1.0 - 1.0 / ((short)p->sZValue2 * 0.061758894);
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].rhw = 1.0;
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].diffuse =
-                        p->uLightColor_bgr;
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].specular = Color();
-                    pLines.pLineVertices[2 * pLines.uNumLines + 1].texcoord.x =
-                        0.0;
-                    pLines.pLineVertices[2 * pLines.uNumLines++ + 1]
-                        .texcoord.y = 0.0;
-                }
-            } else if (p->type & ParticleType_Bitmap) {
-                v15.screenspace_projection_factor_x = p->screenspace_scale;
-                v15.screenspace_projection_factor_y = p->screenspace_scale;
-                v15.screen_space_x = p->uScreenSpaceX;
-                v15.screen_space_y = p->uScreenSpaceY;
-                v15.screen_space_z = p->zbuffer_depth;
-                v15.paletteID = p->paletteID;
-                render->MakeParticleBillboardAndPush(
-                    &v15, p->texture, p->uLightColor_bgr, p->angle);
-            } else if (p->type & ParticleType_Sprite) {
-                v15.screenspace_projection_factor_x = p->screenspace_scale;
-                v15.screenspace_projection_factor_y = p->screenspace_scale;
-                v15.screen_space_x = p->uScreenSpaceX;
-                v15.screen_space_y = p->uScreenSpaceY;
-                v15.screen_space_z = p->zbuffer_depth;
-                v15.paletteID = p->paletteID;
-                render->MakeParticleBillboardAndPush(
-                    &v15, p->texture, p->uLightColor_bgr, p->angle);
+        if (type & ParticleType_Diffuse) {
+            v15.screenspace_projection_factor_x = screenSpaceScale;
+            v15.screenspace_projection_factor_y = screenSpaceScale;
+            v15.screen_space_x = screenSpaceX;
+            v15.screen_space_y = screenSpaceY;
+            v15.screen_space_z = zbufferDepth;
+            v15.paletteID = _particles.paletteId(i);
+            render->MakeParticleBillboardAndPush(&v15, 0, lightColor, _particles.angle(i));
+        } else if (type & ParticleType_Line) {  // type doesnt appear to be used
+            if (pLines.uNumLines < std::size(pLines.pLineVertices) / 2) {
+                // Line end point was never set, it's always at the screen origin.
+                RenderVertexD3D3 *vertices = &pLines.pLineVertices[2 * pLines.uNumLines++];
+                vertices[0].pos.x = screenSpaceX;
+                vertices[0].pos.y = screenSpaceY;
+                vertices[0].pos.z = 1.0 - 1.0 / (zbufferDepth * 0.061758894);
+                vertices[0].rhw = 1.0;
+                vertices[0].diffuse = lightColor;
+                vertices[0].specular = Color();
+                vertices[0].texcoord.x = 0.0;
+                vertices[0].texcoord.y = 0.0;
+
+                vertices[1].pos.x = 0;
+                vertices[1].pos.y = 0;
+                // Depth of an end point at zero z is 1.0 - 1.0 / (0 * 0.061758894), which is negative infinity.
+                // Spelled out explicitly instead of dividing by zero, this is what the original code was computing.
+                vertices[1].pos.z = -std::numeric_limits<float>::infinity();
+                vertices[1].rhw = 1.0;
+                vertices[1].diffuse = lightColor;
+                vertices[1].specular = Color();
+                vertices[1].texcoord.x = 0.0;
+                vertices[1].texcoord.y = 0.0;
             }
+        } else if (type & (ParticleType_Bitmap | ParticleType_Sprite)) {
+            v15.screenspace_projection_factor_x = screenSpaceScale;
+            v15.screenspace_projection_factor_y = screenSpaceScale;
+            v15.screen_space_x = screenSpaceX;
+            v15.screen_space_y = screenSpaceY;
+            v15.screen_space_z = zbufferDepth;
+            v15.paletteID = _particles.paletteId(i);
+            render->MakeParticleBillboardAndPush(&v15, _particles.texture(i), lightColor, _particles.angle(i));
         }
     }
 }
-
@@ -1,15 +1,19 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
+#include <vector>
 
 #include "Engine/Graphics/RenderEntities.h"
 #include "Engine/Time/Duration.h"
 
 #include "Library/Color/Color.h"
+#include "Library/Geometry/Vec.h"
 
 #include "Utility/Flags.h"
 
 class GraphicsImage;
+class RandomEngine;
 
 enum class ParticleFlag : uint32_t {
     ParticleType_Invalid = 0,
@@ -45,34 +49,87 @@ struct Particle_sw {
     int field_38[12]{};
 };
 
-struct Particle {
-    ParticleFlags type = ParticleType_Invalid;
-    float x = 0;
-    float y = 0;
-    float z = 0;
-    float shift_x = 0;
-    float shift_y = 0;
-    float shift_z = 0;
-    Color uParticleColor;
-    Duration timeToLive;
-    GraphicsImage *texture = nullptr;  // unsigned int resource_id;// bitmap IDirect3DTexture
-                       // idx or sprite idx depending on type
-    int paletteID = 0;
-    float particle_size = 0;  // field_28
-    float _x = 0;
-    float _y = 0;
-    float _z = 0;
-    int rotation_speed = 0;
-    int angle = 0;
-    int uScreenSpaceX = 0;
-    int uScreenSpaceY = 0;
-    int uScreenSpaceZ = 0;  // line end x
-    int uScreenSpaceW = 0;  // line end y
-    short zbuffer_depth;
-    int sZValue2 = 0;             // line end z
-    float screenspace_scale = 1.0;  // fixed screenspace_scale {};  // int _screenspace_scale;
-    float fov_x = 0;
-    Color uLightColor_bgr;
+/**
+ * Structure-of-arrays storage for active particles.
+ *
+ * Particles are kept densely packed in `[0, size())`, so that the update kernel can run over plain float arrays that
+ * the compiler is able to vectorize. Expired particles are removed by moving the last particle into their slot, thus
+ * neither adding nor removing a particle needs to scan for free slots. Note that this means that particle order
+ * is not stable.
+ */
+class ParticleStore {
+ public:
+    static constexpr int DEFAULT_CAPACITY = 2000;
+
+    explicit ParticleStore(int capacity = DEFAULT_CAPACITY);
+
+    [[nodiscard]] int capacity() const {
+        return _capacity;
+    }
+
+    /**
+     * Changes the store capacity. If there are more active particles than the new capacity allows, the extra
+     * particles are dropped.
+     *
+     * @param capacity                  New capacity, must be positive.
+     */
+    void setCapacity(int capacity);
+
+    [[nodiscard]] int size() const {
+        return _types.size();
+    }
+
+    [[nodiscard]] bool empty() const {
+        return _types.empty();
+    }
+
+    void clear();
+
+    /**
+     * @param particle                  Particle to add.
+     * @param rng                       Random engine to use for the initial rotation of rotating particles.
+     * @return                          Whether the particle was added, `false` if the store is full.
+     */
+    bool add(const Particle_sw &particle, RandomEngine *rng);
+
+    /**
+     * Advances all particles by the provided time, removing the ones that have expired.
+     *
+     * @param time                      Time elapsed, must be positive.
+     * @param rng                       Random engine to use for the ascending particles.
+     */
+    void update(Duration time, RandomEngine *rng);
+
+    [[nodiscard]] ParticleFlags type(int index) const { return _types[index]; }
+    [[nodiscard]] Vec3f position(int index) const { return Vec3f(_x[index], _y[index], _z[index]); }
+    [[nodiscard]] Vec3f shift(int index) const { return Vec3f(_shiftX[index], _shiftY[index], _shiftZ[index]); }
+    [[nodiscard]] Duration timeToLive(int index) const { return Duration::fromTicks(_timeToLive[index]); }
+    [[nodiscard]] int angle(int index) const { return _angle[index]; }
+    [[nodiscard]] Color lightColor(int index) const { return _lightColors[index]; }
+    [[nodiscard]] GraphicsImage *texture(int index) const { return _textures[index]; }
+    [[nodiscard]] int paletteId(int index) const { return _paletteIds[index]; }
+    [[nodiscard]] float particleSize(int index) const { return _sizes[index]; }
+
+ private:
+    void remove(int index);
+
+ private:
+    int _capacity = 0;
+    std::vector<ParticleFlags> _types;
+    std::vector<float> _x;
+    std::vector<float> _y;
+    std::vector<float> _z;
+    std::vector<float> _shiftX;
+    std::vector<float> _shiftY;
+    std::vector<float> _shiftZ;
+    std::vector<int64_t> _timeToLive; // In ticks, so that the update kernel operates on plain integers.
+    std::vector<int> _rotationSpeeds;
+    std::vector<int> _angle;
+    std::vector<Color> _colors;
+    std::vector<Color> _lightColors; // Particle color faded out according to remaining time to live.
+    std::vector<GraphicsImage *> _textures;
+    std::vector<int> _paletteIds;
+    std::vector<float> _sizes;
 };
 
 struct stru2_LineList {
@@ -83,8 +140,6 @@ struct stru2_LineList {
 
 class ParticleEngine {
  public:
-    static const int PARTICLES_ARRAY_SIZE = 500;
-
     /**
      * Particle engine constructor.
      *
@@ -100,7 +155,7 @@ class ParticleEngine {
     void ResetParticles();
 
     /**
-     * Add particle to engine.
+     * Add particle to engine. Particle is dropped if the engine is full.
      *
      * @offset 0x48AB23
      */
@@ -122,22 +177,35 @@ class ParticleEngine {
     void UpdateParticles();
 
     /**
-     * @offset 0x48AE74
+     * @offset 0x48BBA6
      */
-    bool ViewProject_TrueIfStillVisible_BLV(unsigned int uParticleID);
+    void DrawParticles_BLV();
+
+    [[nodiscard]] const ParticleStore &particles() const {
+        return _particles;
+    }
 
     /**
-     * @offset 0x48BBA6
+     * @param capacity                  Max number of active particles, see `GameConfig::Graphics::MaxParticles`.
      */
-    void DrawParticles_BLV();
+    void setCapacity(int capacity) {
+        _particles.setCapacity(capacity);
+    }
+
+    /**
+     * @return                          Number of particles dropped because the engine was full, since the last call
+     *                                  to `ResetParticles`.
+     */
+    [[nodiscard]] int droppedParticles() const {
+        return _droppedParticles;
+    }
 
-    std::array<Particle, PARTICLES_ARRAY_SIZE> pParticles;
     stru2_LineList pLines;
-    char field_D160[4800]; // unused
-    float field_E420; // unused
-    int uStartParticle;
-    int uEndParticle;
     Duration uTimeElapsed;
+
+ private:
+    ParticleStore _particles;
+    int _droppedParticles = 0;
 };
 
 struct TrailParticle {
@@ -38,60 +38,10 @@ bool BaseRenderer::Initialize() {
     return true;
 }
 
-unsigned int BaseRenderer::Billboard_ProbablyAddToListAndSortByZOrder(float z) {
-    if (uNumBillboardsToDraw >= 999) {
-        return 0;
-    }
-
-    if (!uNumBillboardsToDraw) {
-        uNumBillboardsToDraw = 1;
-        return 0;
-    }
-
-    unsigned int v7 = 0;
-    for (int left = 0, right = uNumBillboardsToDraw; left < right;) {  // binsearch
-        v7 = left + (right - left) / 2;
-        if (z <= render->pBillboardRenderListD3D[v7].z_order)
-            right = v7;
-        else
-            left = v7 + 1;
-    }
-
-    if (z > render->pBillboardRenderListD3D[v7].z_order) {
-        if (v7 == render->uNumBillboardsToDraw - 1) {
-            v7 = render->uNumBillboardsToDraw;
-        } else {
-            if (render->uNumBillboardsToDraw > v7) {
-                for (unsigned int i = 0; i < render->uNumBillboardsToDraw - v7; i++) {
-                    render->pBillboardRenderListD3D[render->uNumBillboardsToDraw - i] =
-                        render->pBillboardRenderListD3D[render->uNumBillboardsToDraw - (i + 1)];
-                }
-            }
-            ++v7;
-        }
-        uNumBillboardsToDraw++;
-        return v7;
-    }
-
-    if (z <= render->pBillboardRenderListD3D[v7].z_order) {
-        if (render->uNumBillboardsToDraw > v7) {
-            for (unsigned int i = 0; i < render->uNumBillboardsToDraw - v7; i++) {
-                render->pBillboardRenderListD3D[render->uNumBillboardsToDraw - i] =
-                    render->pBillboardRenderListD3D[render->uNumBillboardsToDraw - (i + 1)];
-            }
-        }
-        uNumBillboardsToDraw++;
-        return v7;
-    }
-
-    return v7;
-}
-
-
 // TODO: Move this to sprites ?
 // combined with IndoorLocation::PrepareItemsRenderList_BLV() (0044028F)
 void BaseRenderer::DrawSpriteObjects() {
-    for (unsigned int i = 0; i < pSpriteObjects.size(); ++i) {
+    for (int i = spriteObjectSlots.nextLive(0); i < spriteObjectSlots.size(); i = spriteObjectSlots.nextLive(i + 1)) {
         // exit if we are at max sprites
         if (::uNumBillboardsToDraw >= 500) {
             logger->warning("Billboards Full");
@@ -415,8 +365,7 @@ void BaseRenderer::TransformBillboard(const SoftwareBillboard *pSoftBillboard, c
     if (pSprite->texture->height() == 0 || pSprite->texture->width() == 0)
         assert(false);
 
-    unsigned int billboard_index = Billboard_ProbablyAddToListAndSortByZOrder(pSoftBillboard->screen_space_z);
-    RenderBillboardD3D *billboard = &pBillboardRenderListD3D[billboard_index];
+    RenderBillboardD3D *billboard = &pBillboardRenderListD3D.add(pSoftBillboard->screen_space_z);
 
     float scr_proj_x = pSoftBillboard->screenspace_projection_factor_x;
     float scr_proj_y = pSoftBillboard->screenspace_projection_factor_y;
@@ -507,8 +456,7 @@ void BaseRenderer::MakeParticleBillboardAndPush(SoftwareBillboard *a2,
                                                 GraphicsImage *texture,
                                                 Color uDiffuse,
                                                 int angle) {
-    unsigned int billboard_index = Billboard_ProbablyAddToListAndSortByZOrder(a2->screen_space_z);
-    RenderBillboardD3D *billboard = &pBillboardRenderListD3D[billboard_index];
+    RenderBillboardD3D *billboard = &pBillboardRenderListD3D.add(a2->screen_space_z);
 
     billboard->opacity = RenderBillboardD3D::Opaque_1;
     billboard->field_90 = a2->field_44;
@@ -630,21 +578,21 @@ void BaseRenderer::BillboardSphereSpellFX(SpellFX_Billboard *a1, Color diffuse)
         }
     }
 
-    unsigned int v5 = Billboard_ProbablyAddToListAndSortByZOrder(depth);
-    pBillboardRenderListD3D[v5].field_90 = 0;
-    pBillboardRenderListD3D[v5].sParentBillboardID = -1;
-    pBillboardRenderListD3D[v5].opacity = RenderBillboardD3D::Opaque_2;
-    pBillboardRenderListD3D[v5].texture = 0;
-    pBillboardRenderListD3D[v5].uNumVertices = a1->uNumVertices;
-    pBillboardRenderListD3D[v5].z_order = depth;
-    pBillboardRenderListD3D[v5].PaletteIndex = 0;
+    RenderBillboardD3D &billboard = pBillboardRenderListD3D.add(depth);
+    billboard.field_90 = 0;
+    billboard.sParentBillboardID = -1;
+    billboard.opacity = RenderBillboardD3D::Opaque_2;
+    billboard.texture = 0;
+    billboard.uNumVertices = a1->uNumVertices;
+    billboard.z_order = depth;
+    billboard.PaletteIndex = 0;
 
-    pBillboardRenderListD3D[v5].pQuads[3].pos.x = 0.0f;
-    pBillboardRenderListD3D[v5].pQuads[3].pos.y = 0.0f;
-    pBillboardRenderListD3D[v5].pQuads[3].pos.z = 0.0f;
+    billboard.pQuads[3].pos.x = 0.0f;
+    billboard.pQuads[3].pos.y = 0.0f;
+    billboard.pQuads[3].pos.z = 0.0f;
 
     for (unsigned int i = 0; i < (unsigned int)a1->uNumVertices; ++i) {
-        pBillboardRenderListD3D[v5].pQuads[i].pos = a1->field_104[i].pos;
+        billboard.pQuads[i].pos = a1->field_104[i].pos;
 
         float rhw = 1.f / a1->field_104[i].pos.z;
         float z = 1.f - 1.f / (a1->field_104[i].pos.z * 1000.f / pCamera3D->GetFarClip());
@@ -652,7 +600,7 @@ void BaseRenderer::BillboardSphereSpellFX(SpellFX_Billboard *a1, Color diffuse)
         double v10 = a1->field_104[i].pos.z;
         v10 *= 1000.f / pCamera3D->GetFarClip();
 
-        pBillboardRenderListD3D[v5].pQuads[i].rhw = rhw;
+        billboard.pQuads[i].rhw = rhw;
 
         Color v12;
         if (diffuse.a) {
@@ -660,11 +608,11 @@ void BaseRenderer::BillboardSphereSpellFX(SpellFX_Billboard *a1, Color diffuse)
         } else {
             v12 = diffuse;
         }
-        pBillboardRenderListD3D[v5].pQuads[i].diffuse = v12;
-        pBillboardRenderListD3D[v5].pQuads[i].specular = Color();
+        billboard.pQuads[i].diffuse = v12;
+        billboard.pQuads[i].specular = Color();
 
-        pBillboardRenderListD3D[v5].pQuads[i].texcoord.x = 0.5;
-        pBillboardRenderListD3D[v5].pQuads[i].texcoord.y = 0.5;
+        billboard.pQuads[i].texcoord.x = 0.5;
+        billboard.pQuads[i].texcoord.y = 0.5;
     }
 }
 
@@ -700,7 +648,7 @@ void BaseRenderer::DrawBillboards_And_MaybeRenderSpecialEffects_And_EndScene() {
 std::vector<Actor*> BaseRenderer::getActorsInViewport(int pDepth) {
     std::vector<Actor*> foundActors;
 
-    for (int i = 0; i < render->uNumBillboardsToDraw; i++) {
+    for (int i = 0; i < render->pBillboardRenderListD3D.size(); i++) {
         int renderId = render->pBillboardRenderListD3D[i].sParentBillboardID;
         if(renderId == -1) {
             continue; // E.g. spell particle.
@@ -36,7 +36,7 @@ void NullRenderer::DrawLines(const RenderVertexD3D3 *vertices, int num_vertices)
 
 void NullRenderer::BeginScene3D() {
     // TODO(captainurist): doesn't belong here.
-    uNumBillboardsToDraw = 0;
+    pBillboardRenderListD3D.clear();
 }
 
 void NullRenderer::DrawProjectile(float srcX, float srcY, float a3, float a4,
@@ -6,6 +6,7 @@
 #include <map>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <glad/gl.h> // NOLINT: not a C system header.
 
@@ -346,7 +347,7 @@ void OpenGLRenderer::BeginScene3D() {
     glClearDepthf(1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    render->uNumBillboardsToDraw = 0;  // moved from drawbillboards - cant reset this until mouse picking finished
+    render->pBillboardRenderListD3D.clear();  // moved from drawbillboards - cant reset this until mouse picking finished
 
     SetFogParametersGL();
     gamma = GetGamma();
@@ -2382,7 +2383,7 @@ void OpenGLRenderer::DoRenderBillboards_D3D() {
     float oneon = 1.0f / (pCamera3D->GetNearClip() * 2.0f);
     float oneof = 1.0f / (pCamera3D->GetFarClip());
 
-    for (int i = uNumBillboardsToDraw - 1; i >= 0; --i) {
+    for (int i = pBillboardRenderListD3D.size() - 1; i >= 0; --i) {
         //if (pBillboardRenderListD3D[i].opacity != RenderBillboardD3D::NoBlend) {
         //    if (blendtrack != pBillboardRenderListD3D[i].opacity) {
         //        blendtrack = pBillboardRenderListD3D[i].opacity;
@@ -3149,8 +3150,7 @@ void OpenGLRenderer::Present() {
     swapBuffers();
 }
 
-GLshaderverts *outbuildshaderstore[16] = { nullptr };
-int numoutbuildverts[16] = { 0 };
+std::vector<int> outbuildVisibleModels;
 
 void OpenGLRenderer::DrawOutdoorBuildings() {
     // shader
@@ -3167,32 +3167,7 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
     _set_3d_projection_matrix();
     _set_3d_modelview_matrix();
 
-    if (outbuildVAO[0] == 0) {
-        // count all triangles
-        // make out build shader store
-        int verttotals = 0;
-
-        for (int i = 0; i < 16; i++) {
-            numoutbuildverts[i] = 0;
-
-            //for (BSPModel &model : pOutdoor->pBModels) {
-            //    //int reachable;
-            //    //if (IsBModelVisible(&model, &reachable)) {
-            //    //model.field_40 |= 1;
-            //    if (!model.pFaces.empty()) {
-            //        for (ODMFace &face : model.pFaces) {
-            //            if (!face.Invisible()) {
-            //                numoutbuildverts += 3 * (face.uNumVertices - 2);
-            //            }
-            //        }
-            //    }
-            //}
-
-            free(outbuildshaderstore[i]);
-            outbuildshaderstore[i] = nullptr;
-            outbuildshaderstore[i] = (GLshaderverts *)malloc(sizeof(GLshaderverts) * 20000);
-        }
-
+    if (outbuildVAO == 0) {
         // reserve first 7 layers for water tiles in unit 0
         auto wtrtexture = this->hd_water_tile_anim[0];
         //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
@@ -3327,32 +3302,47 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
             //}
         }
 
-        for (int l = 0; l < 16; l++) {
-            glGenVertexArrays(1, &outbuildVAO[l]);
-            glGenBuffers(1, &outbuildVBO[l]);
+        // bake vertex batches, texture layers are resolved once per texture
+        outbuildBatches.build(pOutdoor->pBModels, [this](GraphicsImage *texture) {
+            OutdoorBuildingBatches::TextureLayer result;
+            auto mapiter = outbuildtexmap.find(texture->GetName());
+            if (mapiter != outbuildtexmap.end()) {
+                int unitlayer = mapiter->second;
+                result.layer = unitlayer & 0xFF;
+                result.unit = (unitlayer & 0xFF00) >> 8;
+            } else if (texture->GetName() != "wtrtyl") {
+                // TODO(pskelton): set to water for now
+                logger->warning("Texture not found in map!");
+            }
+            return result;
+        }, engine->is_saturate_faces);
+        outbuildLayoutVersion = outbuildBatches.layoutVersion();
 
-            glBindVertexArray(outbuildVAO[l]);
-            glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO[l]);
+        glGenVertexArrays(1, &outbuildVAO);
+        glGenBuffers(1, &outbuildVBO);
 
-            glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, outbuildshaderstore[l], GL_DYNAMIC_DRAW);
+        glBindVertexArray(outbuildVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO);
 
-            // position attribute
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
-            glEnableVertexAttribArray(0);
-            // tex uv attribute
-            glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, u));
-            glEnableVertexAttribArray(1);
-            // tex unit attribute
-            // tex array layer attribute
-            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, texunit));
-            glEnableVertexAttribArray(2);
-            // normals
-            glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, normx));
-            glEnableVertexAttribArray(3);
-            // attribs - not used here yet
-            glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, attribs));
-            glEnableVertexAttribArray(4);
-        }
+        glBufferData(GL_ARRAY_BUFFER, outbuildBatches.vertices().size_bytes(), outbuildBatches.vertices().data(), GL_DYNAMIC_DRAW);
+
+        using OutbuildVertex = OutdoorBuildingBatches::Vertex;
+        // position attribute
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(OutbuildVertex), (void *)offsetof(OutbuildVertex, x));
+        glEnableVertexAttribArray(0);
+        // tex uv attribute
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(OutbuildVertex), (void *)offsetof(OutbuildVertex, u));
+        glEnableVertexAttribArray(1);
+        // tex unit attribute
+        // tex array layer attribute
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(OutbuildVertex), (void *)offsetof(OutbuildVertex, texunit));
+        glEnableVertexAttribArray(2);
+        // normals
+        glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(OutbuildVertex), (void *)offsetof(OutbuildVertex, normx));
+        glEnableVertexAttribArray(3);
+        // attribs - not used here yet
+        glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(OutbuildVertex), (void *)offsetof(OutbuildVertex, attribs));
+        glEnableVertexAttribArray(4);
 
         // texture set up
 
@@ -3414,129 +3404,28 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
         }
     }
 
-        // else update verts - blank store
-        for (int i = 0; i < 16; i++) {
-            numoutbuildverts[i] = 0;
-        }
-
-        for (BSPModel &model : pOutdoor->pBModels) {
-            bool reachable;
-            if (IsBModelVisible(&model, 256, &reachable)) {
-                //if (model.index == 35) continue;
-                model.field_40 |= 1;
-                if (!model.pFaces.empty()) {
-                    for (ODMFace &face : model.pFaces) {
-                        if (!face.Invisible()) {
-                            array_73D150[0].vWorldPosition = model.pVertices[face.pVertexIDs[0]];
-
-                            if (pCamera3D->is_face_faced_to_cameraODM(&face, &array_73D150[0])) {
-                                int texunit = 0;
-                                int texlayer = 0;
-
-                                if (face.IsTextureFrameTable()) {
-                                    texlayer = -1;
-                                    texunit = -1;
-                                } else {
-                                    texlayer = face.texlayer;
-                                    texunit = face.texunit;
-                                }
-
-                                if (texlayer == -1) { // texture has been reset - see if its in the map
-                                    GraphicsImage *tex = face.GetTexture();
-                                    std::string texname = tex->GetName();
-                                    auto mapiter = bsptexmap.find(texname);
-                                    if (mapiter != bsptexmap.end()) {
-                                        // if so, extract unit and layer
-                                        int unitlayer = mapiter->second;
-                                        face.texlayer = texlayer = unitlayer & 0xFF;
-                                        face.texunit = texunit = (unitlayer & 0xFF00) >> 8;
-                                    } else {
-                                        logger->warning("Texture not found in map!");
-                                        // TODO(pskelton): set to water for now - fountains in walls of mist
-                                        texunit = face.texlayer = 0;
-                                        texlayer = face.texunit = 0;
-                                    }
-                                }
-
-                                int attribflags = 0;
-
-                                if (face.uAttributes & FACE_IsFluid)
-                                    attribflags |= 2;
-                                if (face.uAttributes & FACE_INDOOR_SKY)
-                                    attribflags |= 0x400;
-
-                                if (face.uAttributes & FACE_FlowDown)
-                                    attribflags |= 0x400;
-                                else if (face.uAttributes & FACE_FlowUp)
-                                    attribflags |= 0x800;
-
-                                if (face.uAttributes & FACE_FlowRight)
-                                    attribflags |= 0x2000;
-                                else if (face.uAttributes & FACE_FlowLeft)
-                                    attribflags |= 0x1000;
-
-                                if (face.uAttributes & FACE_IsLava)
-                                    attribflags |= 0x4000;
-
-                                if (face.uAttributes & FACE_OUTLINED || (face.uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
-                                    attribflags |= 0x00010000;
-
-                                // load up verts here
-                                for (int z = 0; z < (face.uNumVertices - 2); z++) {
-                                    // 123, 134, 145, 156..
-                                    GLshaderverts *thisvert = &outbuildshaderstore[texunit][numoutbuildverts[texunit]];
-
-                                    // copy first
-                                    thisvert->x = model.pVertices[face.pVertexIDs[0]].x;
-                                    thisvert->y = model.pVertices[face.pVertexIDs[0]].y;
-                                    thisvert->z = model.pVertices[face.pVertexIDs[0]].z;
-                                    thisvert->u = face.pTextureUIDs[0] + face.sTextureDeltaU;
-                                    thisvert->v = face.pTextureVIDs[0] + face.sTextureDeltaV;
-                                    thisvert->texunit = texunit;
-                                    thisvert->texturelayer = texlayer;
-                                    thisvert->normx = face.facePlane.normal.x;
-                                    thisvert->normy = face.facePlane.normal.y;
-                                    thisvert->normz = face.facePlane.normal.z;
-                                    thisvert->attribs = attribflags;
-                                    thisvert++;
-
-                                    // copy other two (z+1)(z+2)
-                                    for (unsigned i = 1; i < 3; ++i) {
-                                        thisvert->x = model.pVertices[face.pVertexIDs[z + i]].x;
-                                        thisvert->y = model.pVertices[face.pVertexIDs[z + i]].y;
-                                        thisvert->z = model.pVertices[face.pVertexIDs[z + i]].z;
-                                        thisvert->u = face.pTextureUIDs[z + i] + face.sTextureDeltaU;
-                                        thisvert->v = face.pTextureVIDs[z + i] + face.sTextureDeltaV;
-                                        thisvert->texunit = texunit;
-                                        thisvert->texturelayer = texlayer;
-                                        thisvert->normx = face.facePlane.normal.x;
-                                        thisvert->normy = face.facePlane.normal.y;
-                                        thisvert->normz = face.facePlane.normal.z;
-                                        thisvert->attribs = attribflags;
-                                        thisvert++;
-                                    }
-
-                                    numoutbuildverts[texunit] += 3;
-                                    assert(numoutbuildverts[texunit] <= 9999);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
+    // cull models & update the faces that have changed
+    outbuildVisibleModels.clear();
+    for (BSPModel &model : pOutdoor->pBModels) {
+        bool reachable;
+        if (IsBModelVisible(&model, 256, &reachable)) {
+            model.field_40 |= 1;
+            outbuildVisibleModels.push_back(model.index);
         }
+    }
 
-        for (int l = 0; l < 16; l++) {
-            if (numoutbuildverts[l]) {
-                glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO[l]);
-                // orphan buffer
-                glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-                // update buffer
-                glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * numoutbuildverts[l], outbuildshaderstore[l]);
-            }
-        }
+    outbuildBatches.prepareFrame(pOutdoor->pBModels, outbuildVisibleModels, engine->is_saturate_faces);
 
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, outbuildVBO);
+    if (outbuildLayoutVersion != outbuildBatches.layoutVersion()) {
+        glBufferData(GL_ARRAY_BUFFER, outbuildBatches.vertices().size_bytes(), outbuildBatches.vertices().data(), GL_DYNAMIC_DRAW);
+        outbuildLayoutVersion = outbuildBatches.layoutVersion();
+    } else {
+        for (OutdoorBuildingBatches::DrawRange range : outbuildBatches.dirtyRanges())
+            glBufferSubData(GL_ARRAY_BUFFER, sizeof(OutdoorBuildingBatches::Vertex) * range.first,
+                            sizeof(OutdoorBuildingBatches::Vertex) * range.count, &outbuildBatches.vertices()[range.first]);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 
     // terrain debug
     if (config->debug.Terrain.value())
@@ -3690,9 +3579,11 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
 
             // draw each set of triangles
             glBindTexture(GL_TEXTURE_2D_ARRAY, outbuildtextures[unit]);
-            glBindVertexArray(outbuildVAO[unit]);
-            glDrawArrays(GL_TRIANGLES, 0, (numoutbuildverts[unit]));
-            drawcalls++;
+            glBindVertexArray(outbuildVAO);
+            for (OutdoorBuildingBatches::DrawRange range : outbuildBatches.drawRanges(unit)) {
+                glDrawArrays(GL_TRIANGLES, range.first, range.count);
+                drawcalls++;
+            }
         //}
     }
 
@@ -3773,8 +3664,73 @@ void OpenGLRenderer::DrawOutdoorBuildings() {
     ///////////////// shader end
 }
 
-GLshaderverts *BSPshaderstore[16] = { nullptr };
-int numBSPverts[16] = { 0 };
+// Last state that was written into the static vertex buffer for each indoor face.
+struct BSPFaceState {
+    int texunit = -1;
+    int texlayer = -1;
+    int attribflags = -1;
+
+    friend bool operator==(const BSPFaceState &l, const BSPFaceState &r) = default;
+};
+
+std::vector<GLshaderverts> bspVertices; // Static indoor vertex buffer contents, see IndoorDrawList.
+std::vector<BSPFaceState> bspFaceStates;
+std::vector<std::pair<int, int>> bspDirtyRanges; // [first, last) vertex ranges to upload this frame.
+std::vector<uint32_t> bspIndices; // Concatenated per-unit index lists.
+
+static void writeBSPFaceVertices(int uFaceID, const BSPFaceState &state, float skymodtimex, float skymodtimey) {
+    const BLVFace *face = &pIndoor->pFaces[uFaceID];
+    const BLVFaceExtra &extra = pIndoor->pFaceExtras[face->uFaceExtraID];
+    GLshaderverts *thisvert = &bspVertices[pIndoor->drawList.firstVertex(uFaceID)];
+
+    for (int z = 0; z < (face->uNumVertices - 2); z++) {
+        // 123, 134, 145, 156..
+        for (int i : {0, z + 1, z + 2}) {
+            thisvert->x = pIndoor->pVertices[face->pVertexIDs[i]].x;
+            thisvert->y = pIndoor->pVertices[face->pVertexIDs[i]].y;
+            thisvert->z = pIndoor->pVertices[face->pVertexIDs[i]].z;
+            thisvert->u = face->pVertexUIDs[i] + extra.sTextureDeltaU;
+            thisvert->v = face->pVertexVIDs[i] + extra.sTextureDeltaV;
+            if (face->Indoor_sky()) {
+                thisvert->u = (skymodtimex + thisvert->u) * 0.25f;
+                thisvert->v = (skymodtimey + thisvert->v) * 0.25f;
+            }
+            thisvert->texunit = state.texunit;
+            thisvert->texturelayer = state.texlayer;
+            thisvert->normx = face->facePlane.normal.x;
+            thisvert->normy = face->facePlane.normal.y;
+            thisvert->normz = face->facePlane.normal.z;
+            thisvert->attribs = state.attribflags;
+            thisvert->sector = face->uSectorID;
+            thisvert++;
+        }
+    }
+}
+
+static int bspFaceAttribFlags(const BLVFace *face) {
+    int attribflags = 0;
+
+    if (face->uAttributes & FACE_IsFluid)
+        attribflags |= 2;
+
+    if (face->uAttributes & FACE_FlowDown)
+        attribflags |= 0x400;
+    else if (face->uAttributes & FACE_FlowUp)
+        attribflags |= 0x800;
+
+    if (face->uAttributes & FACE_FlowRight)
+        attribflags |= 0x2000;
+    else if (face->uAttributes & FACE_FlowLeft)
+        attribflags |= 0x1000;
+
+    if (face->uAttributes & FACE_IsLava)
+        attribflags |= 0x4000;
+
+    if (face->uAttributes & FACE_OUTLINED || (face->uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
+        attribflags |= 0x00010000;
+
+    return attribflags;
+}
 
 void OpenGLRenderer::DrawIndoorFaces() {
     // void RenderOpenGL::DrawIndoorBSP() {
@@ -3794,7 +3750,9 @@ void OpenGLRenderer::DrawIndoorFaces() {
         _set_3d_projection_matrix();
         _set_3d_modelview_matrix();
 
-        if (bspVAO[0] == 0) {
+        IndoorDrawList &drawList = pIndoor->drawList;
+
+        if (bspVAO == 0) {
             // lights setup
             int cntnosect = 0;
 
@@ -3810,14 +3768,6 @@ void OpenGLRenderer::DrawIndoorFaces() {
             if (cntnosect)
                 logger->warning("{} lights - sector not found", cntnosect);
 
-            for (int i = 0; i < 16; i++) {
-                numBSPverts[i] = 0;
-                free(BSPshaderstore[i]);
-                BSPshaderstore[i] = nullptr;
-                BSPshaderstore[i] = (GLshaderverts*)malloc(sizeof(GLshaderverts) * 20000);
-            }
-
-
             // reserve first 7 layers for water tiles in unit 0
             auto wtrtexture = this->hd_water_tile_anim[0];
             //terraintexmap.insert(std::make_pair("wtrtyl", terraintexmap.size()));
@@ -3922,36 +3872,50 @@ void OpenGLRenderer::DrawIndoorFaces() {
                 face->texlayer = texlayer;
             }
 
-            for (int l = 0; l < 16; l++) {
-                glGenVertexArrays(1, &bspVAO[l]);
-                glGenBuffers(1, &bspVBO[l]);
-
-                glBindVertexArray(bspVAO[l]);
-                glBindBuffer(GL_ARRAY_BUFFER, bspVBO[l]);
-
-                glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-
-                // position attribute
-                glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
-                glEnableVertexAttribArray(0);
-                // tex uv attribute
-                glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, u));
-                glEnableVertexAttribArray(1);
-                // tex unit attribute
-                // tex array layer attribute
-                glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, texunit));
-                glEnableVertexAttribArray(2);
-                // normals
-                glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, normx));
-                glEnableVertexAttribArray(3);
-                // attribs
-                glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, attribs));
-                glEnableVertexAttribArray(4);
-                //sector
-                glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void*)offsetof(GLshaderverts, sector));
-                glEnableVertexAttribArray(5);
+            // Fill in the static vertex buffer. Animated faces are skipped here as their texture is resolved on draw, sky
+            // floors & door faces are rewritten on every draw anyway.
+            bspVertices.assign(drawList.vertexCount(), GLshaderverts());
+            bspFaceStates.assign(pIndoor->pFaces.size(), BSPFaceState());
+            for (int test = 0; test < pIndoor->pFaces.size(); test++) {
+                BLVFace *face = &pIndoor->pFaces[test];
+                if (face->isPortal() || !face->GetTexture() || face->IsTextureFrameTable() || face->texunit == -1 || drawList.isDynamic(test))
+                    continue;
+
+                BSPFaceState state = {face->texunit, face->texlayer, bspFaceAttribFlags(face)};
+                writeBSPFaceVertices(test, state, 0, 0);
+                bspFaceStates[test] = state;
             }
 
+            glGenVertexArrays(1, &bspVAO);
+            glGenBuffers(1, &bspVBO);
+            glGenBuffers(1, &bspEBO);
+
+            glBindVertexArray(bspVAO);
+            glBindBuffer(GL_ARRAY_BUFFER, bspVBO);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bspEBO);
+
+            glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * bspVertices.size(), bspVertices.data(), GL_DYNAMIC_DRAW);
+
+            // position attribute
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, x));
+            glEnableVertexAttribArray(0);
+            // tex uv attribute
+            glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, u));
+            glEnableVertexAttribArray(1);
+            // tex unit attribute
+            // tex array layer attribute
+            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, texunit));
+            glEnableVertexAttribArray(2);
+            // normals
+            glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, normx));
+            glEnableVertexAttribArray(3);
+            // attribs
+            glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void *)offsetof(GLshaderverts, attribs));
+            glEnableVertexAttribArray(4);
+            //sector
+            glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(GLshaderverts), (void*)offsetof(GLshaderverts, sector));
+            glEnableVertexAttribArray(5);
+
             // texture set up
 
             // loop over all units
@@ -4002,13 +3966,10 @@ void OpenGLRenderer::DrawIndoorFaces() {
         }
 
 
-            // update verts - blank store
+            // build per-unit index lists, re-writing vertices of the faces that have changed
 
-            for (int i = 0; i < 16; i++) {
-                numBSPverts[i] = 0;
-            }
-
-            bool drawnsky = false;
+            drawList.beginFrame();
+            bspDirtyRanges.clear();
 
             for (unsigned i = 0; i < pBspRenderer->num_faces; ++i) {
                 int uFaceID = pBspRenderer->faces[i].uFaceID;
@@ -4029,29 +3990,9 @@ void OpenGLRenderer::DrawIndoorFaces() {
                 }
 
                 ++pBLVRenderParams->uNumFacesRenderedThisFrame;
-                // load up verts here
                 int texlayer = 0;
                 int texunit = 0;
-                int attribflags = 0;
-
-                if (face->uAttributes & FACE_IsFluid)
-                    attribflags |= 2;
-
-                if (face->uAttributes & FACE_FlowDown)
-                    attribflags |= 0x400;
-                else if (face->uAttributes & FACE_FlowUp)
-                    attribflags |= 0x800;
-
-                if (face->uAttributes & FACE_FlowRight)
-                    attribflags |= 0x2000;
-                else if (face->uAttributes & FACE_FlowLeft)
-                    attribflags |= 0x1000;
-
-                if (face->uAttributes & FACE_IsLava)
-                    attribflags |= 0x4000;
-
-                if (face->uAttributes & FACE_OUTLINED || (face->uAttributes & FACE_IsSecret) && engine->is_saturate_faces)
-                    attribflags |= 0x00010000;
+                int attribflags = bspFaceAttribFlags(face);
 
                 if (face->IsTextureFrameTable()) {
                     texlayer = -1;
@@ -4078,68 +4019,47 @@ void OpenGLRenderer::DrawIndoorFaces() {
                     }
                 }
 
+                // load up verts here, but only if they differ from what's already in the buffer
+                BSPFaceState state = {texunit, texlayer, attribflags};
+                if (drawList.isDynamic(uFaceID) || bspFaceStates[uFaceID] != state) {
+                    writeBSPFaceVertices(uFaceID, state, skymodtimex, skymodtimey);
+                    bspFaceStates[uFaceID] = state;
 
-                for (int z = 0; z < (face->uNumVertices - 2); z++) {
-                    // 123, 134, 145, 156..
-                    GLshaderverts *thisvert = &BSPshaderstore[texunit][numBSPverts[texunit]];
-
-                    // copy first
-                    thisvert->x = pIndoor->pVertices[face->pVertexIDs[0]].x;
-                    thisvert->y = pIndoor->pVertices[face->pVertexIDs[0]].y;
-                    thisvert->z = pIndoor->pVertices[face->pVertexIDs[0]].z;
-                    thisvert->u = face->pVertexUIDs[0] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaU  /*+ face->sTextureDeltaU*/;
-                    thisvert->v = face->pVertexVIDs[0] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaV  /*+ face->sTextureDeltaV*/;
-                    if (face->Indoor_sky()) {
-                        thisvert->u = (skymodtimex + thisvert->u) * 0.25f;
-                        thisvert->v = (skymodtimey + thisvert->v) * 0.25f;
-                    }
-                    thisvert->texunit = texunit;
-                    thisvert->texturelayer = texlayer;
-                    thisvert->normx = face->facePlane.normal.x;
-                    thisvert->normy = face->facePlane.normal.y;
-                    thisvert->normz = face->facePlane.normal.z;
-                    thisvert->attribs = attribflags;
-                    thisvert->sector = face->uSectorID;
-                    thisvert++;
-
-                    // copy other two (z+1)(z+2)
-                    for (unsigned i = 1; i < 3; ++i) {
-                        thisvert->x = pIndoor->pVertices[face->pVertexIDs[z + i]].x;
-                        thisvert->y = pIndoor->pVertices[face->pVertexIDs[z + i]].y;
-                        thisvert->z = pIndoor->pVertices[face->pVertexIDs[z + i]].z;
-                        thisvert->u = face->pVertexUIDs[z + i] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaU  /*+ face->sTextureDeltaU*/;
-                        thisvert->v = face->pVertexVIDs[z + i] + pIndoor->pFaceExtras[face->uFaceExtraID].sTextureDeltaV  /*+ face->sTextureDeltaV*/;
-                        if (face->Indoor_sky()) {
-                            thisvert->u = (skymodtimex + thisvert->u) * 0.25f;
-                            thisvert->v = (skymodtimey + thisvert->v) * 0.25f;
-                        }
-                        thisvert->texunit = texunit;
-                        thisvert->texturelayer = texlayer;
-                        thisvert->normx = face->facePlane.normal.x;
-                        thisvert->normy = face->facePlane.normal.y;
-                        thisvert->normz = face->facePlane.normal.z;
-                        thisvert->attribs = attribflags;
-                        thisvert->sector = face->uSectorID;
-                        thisvert++;
-                    }
-
-                    numBSPverts[texunit] += 3;
-                    assert(numBSPverts[texunit] <= 19999);
+                    int first = drawList.firstVertex(uFaceID);
+                    bspDirtyRanges.emplace_back(first, first + drawList.numVertices(uFaceID));
                 }
+
+                drawList.addFace(uFaceID, texunit);
             }
 
-            for (int l = 0; l < 16; l++) {
-                if (numBSPverts[l]) {
-                    glBindBuffer(GL_ARRAY_BUFFER, bspVBO[l]);
-                    // orphan buffer
-                    glBufferData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * 20000, NULL, GL_DYNAMIC_DRAW);
-                    // update buffer
-                    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLshaderverts) * numBSPverts[l], BSPshaderstore[l]);
-                }
+            glBindBuffer(GL_ARRAY_BUFFER, bspVBO);
+
+            // update changed vertex ranges, merging adjacent ones
+            std::sort(bspDirtyRanges.begin(), bspDirtyRanges.end());
+            for (size_t i = 0; i < bspDirtyRanges.size();) {
+                auto [first, last] = bspDirtyRanges[i++];
+                while (i < bspDirtyRanges.size() && bspDirtyRanges[i].first <= last)
+                    last = std::max(last, bspDirtyRanges[i++].second);
+                if (first < last)
+                    glBufferSubData(GL_ARRAY_BUFFER, sizeof(GLshaderverts) * first, sizeof(GLshaderverts) * (last - first), &bspVertices[first]);
             }
 
             glBindBuffer(GL_ARRAY_BUFFER, 0);
 
+            // upload index lists
+            bspIndices.clear();
+            for (int unit = 0; unit < IndoorDrawList::MAX_TEXTURE_UNITS; unit++)
+                bspIndices.insert(bspIndices.end(), drawList.indices(unit).begin(), drawList.indices(unit).end());
+
+            glBindVertexArray(bspVAO);
+            if (!bspIndices.empty()) {
+                // orphan buffer
+                glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32_t) * bspIndices.size(), NULL, GL_STREAM_DRAW);
+                // update buffer
+                glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(uint32_t) * bspIndices.size(), bspIndices.data());
+            }
+            glBindVertexArray(0);
+
         // terrain debug
         if (config->debug.Terrain.value())
             // TODO: OpenGL ES doesn't provide wireframe functionality so enable it only for classic OpenGL for now
@@ -4338,6 +4258,7 @@ void OpenGLRenderer::DrawIndoorFaces() {
 
         glActiveTexture(GL_TEXTURE0);
 
+        size_t indexOffset = 0;
         for (int unit = 0; unit < 16; unit++) {
             // skip if textures are empty
             //if (numoutbuildtexloaded[unit] > 0) {
@@ -4345,10 +4266,15 @@ void OpenGLRenderer::DrawIndoorFaces() {
                 glUniform1i(bspshader.uniformLocation("watertiles"), GLint(0));
             }
 
+            size_t indexCount = pIndoor->drawList.indices(unit).size();
+            if (indexCount == 0)
+                continue;
+
             // draw each set of triangles
             glBindTexture(GL_TEXTURE_2D_ARRAY, bsptextures[unit]);
-            glBindVertexArray(bspVAO[unit]);
-            glDrawArrays(GL_TRIANGLES, 0, (numBSPverts[unit]));
+            glBindVertexArray(bspVAO);
+            glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, (void *)(sizeof(uint32_t) * indexOffset));
+            indexOffset += indexCount;
             drawcalls++;
             //}
         }
@@ -4898,15 +4824,13 @@ void OpenGLRenderer::ReleaseTerrain() {
         numoutbuildtexloaded[i] = 0;
         outbuildtexturewidths[i] = 0;
         outbuildtextureheights[i] = 0;
-        glDeleteBuffers(1, &outbuildVBO[i]);
-        glDeleteVertexArrays(1, &outbuildVAO[i]);
-        outbuildVBO[i] = 0;
-        outbuildVAO[i] = 0;
-        if (outbuildshaderstore[i]) {
-            free(outbuildshaderstore[i]);
-            outbuildshaderstore[i] = nullptr;
-        }
     }
+
+    glDeleteBuffers(1, &outbuildVBO);
+    glDeleteVertexArrays(1, &outbuildVAO);
+    outbuildVBO = 0;
+    outbuildVAO = 0;
+    outbuildBatches.clear();
 }
 
 void OpenGLRenderer::ReleaseBSP() {
@@ -4925,15 +4849,19 @@ void OpenGLRenderer::ReleaseBSP() {
         bsptexloaded[i] = 0;
         bsptexturewidths[i] = 0;
         bsptextureheights[i] = 0;
-        glDeleteBuffers(1, &bspVBO[i]);
-        glDeleteVertexArrays(1, &bspVAO[i]);
-        bspVAO[i] = 0;
-        bspVBO[i] = 0;
-        if (BSPshaderstore[i]) {
-            free(BSPshaderstore[i]);
-            BSPshaderstore[i] = nullptr;
-        }
     }
+
+    glDeleteBuffers(1, &bspVBO);
+    glDeleteBuffers(1, &bspEBO);
+    glDeleteVertexArrays(1, &bspVAO);
+    bspVAO = 0;
+    bspVBO = 0;
+    bspEBO = 0;
+
+    bspVertices.clear();
+    bspFaceStates.clear();
+    bspDirtyRanges.clear();
+    bspIndices.clear();
 }
 
 
@@ -8,6 +8,7 @@
 #include <glm/glm.hpp>
 
 #include "Engine/Graphics/FrameLimiter.h"
+#include "Engine/Graphics/OutdoorBuildingBatches.h"
 #include "BaseRenderer.h"
 
 #include "Library/Color/Colorf.h"
@@ -161,7 +162,9 @@ class OpenGLRenderer : public BaseRenderer {
     std::map<std::string, int> terraintexmap;
 
     // outside building shader
-    GLuint outbuildVBO[16]{}, outbuildVAO[16]{};
+    GLuint outbuildVBO{}, outbuildVAO{};
+    OutdoorBuildingBatches outbuildBatches;
+    int outbuildLayoutVersion = 0;
     GLuint outbuildtextures[16]{};
     unsigned int numoutbuildtexloaded[16]{};
     unsigned int outbuildtexturewidths[16]{};
@@ -169,7 +172,7 @@ class OpenGLRenderer : public BaseRenderer {
     std::map<std::string, int> outbuildtexmap;
 
     // indoors bsp shader
-    GLuint bspVBO[16]{}, bspVAO[16]{};
+    GLuint bspVBO{}, bspVAO{}, bspEBO{};
     GLuint bsptextures[16]{};
     unsigned int bsptexloaded[16]{};
     unsigned int bsptexturewidths[16]{};
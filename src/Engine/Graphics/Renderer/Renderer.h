@@ -10,6 +10,7 @@
 #include "Engine/HitMap.h"
 
 #include "TextureRenderId.h"
+#include "Engine/Graphics/BillboardRenderList.h"
 #include "Engine/Graphics/RenderEntities.h"
 
 class Actor;
@@ -176,9 +177,8 @@ class Renderer {
     Color uFogColor;
     int hd_water_current_frame;
     GraphicsImage *hd_water_tile_anim[7];
-    RenderBillboardD3D pBillboardRenderListD3D[1000];
-    unsigned int uNumBillboardsToDraw; // TODO(captainurist): this is not properly cleared if BeginScene3D is not called,
-                                       //                     resulting in dangling textures in pBillboardRenderListD3D.
+    // TODO(captainurist): this is not properly cleared if BeginScene3D is not called, resulting in dangling textures.
+    BillboardRenderList pBillboardRenderListD3D;
 
     int drawcalls;
 
@@ -4,6 +4,7 @@
 #include <cstring>
 #include <algorithm>
 #include <string>
+#include <vector>
 
 #include "Engine/OurMath.h"
 #include "Engine/Objects/DecorationList.h"
@@ -164,6 +165,46 @@ void SpriteFrameTable::InitializeSprite(signed int uSpriteID) {
     }
 }
 
+void SpriteFrameTable::collectSpriteNames(int uSpriteID, std::vector<std::string> *names) const {
+    if (uSpriteID < 0 || uSpriteID >= pSpriteSFrames.size())
+        return;
+
+    // Mirrors the naming logic in InitializeSprite.
+    for (size_t i = uSpriteID; i < pSpriteSFrames.size(); i++) {
+        const SpriteFrame &frame = pSpriteSFrames[i];
+        const std::string &name = frame.texture_name;
+
+        if (frame.uFlags & 0x10) {
+            names->push_back(name);
+        } else if (frame.uFlags & 0x10000) {
+            for (std::string_view suffix : {"0", "2", "4"})
+                names->push_back(name + std::string(suffix));
+        } else if (frame.uFlags & 0x40) {
+            for (std::string_view suffix : {"0", "1", "2"})
+                names->push_back(name + std::string(suffix));
+            if (name.size() >= 3) {
+                std::string base = name.substr(0, name.size() - 3);
+                names->push_back(base + "stA3");
+                names->push_back(base + "stA4");
+            }
+        } else {
+            for (int direction = 0; direction < 8; direction++) {
+                if ((0x0100 << direction) & frame.uFlags) {
+                    if (direction != 0)
+                        names->push_back(fmt::format("{}{}", name, 8 - direction));
+                } else if (name.size() < 7) {
+                    names->push_back(fmt::format("{}{}", name, direction));
+                } else {
+                    names->push_back(name);
+                }
+            }
+        }
+
+        if (!(frame.uFlags & 1))
+            break;
+    }
+}
+
 //----- (0044D813) --------------------------------------------------------
 int SpriteFrameTable::FastFindSprite(std::string_view pSpriteName) {
     auto cmp = [this] (uint16_t index, std::string_view name) {
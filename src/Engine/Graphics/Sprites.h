@@ -52,6 +52,15 @@ struct SpriteFrameTable {
     void ResetLoadedFlags();
     void InitializeSprite(signed int uSpriteID);
 
+    /**
+     * Collects the names of the LOD sprites that `InitializeSprite` would load for the provided sprite id. This is
+     * used to prefetch sprites before loading them, so the result is allowed to contain extra names or miss some.
+     *
+     * @param uSpriteID                 Sprite id, index into `pSpriteSFrames`.
+     * @param[out] names                Vector to append the sprite names to.
+     */
+    void collectSpriteNames(int uSpriteID, std::vector<std::string> *names) const;
+
     /**
      * @param pSpriteName               Name of the sprite to find. Names are case-insensitive.
      * @return                          Index in `pSpriteSFrames` for the sprite, or 0 if sprite wasn't found.
@@ -0,0 +1,46 @@
+#include <random>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/BillboardRenderList.h"
+
+// Reference implementation - sorted insertion, as done by the old Billboard_ProbablyAddToListAndSortByZOrder.
+static void insertSorted(std::vector<int> *ids, std::vector<float> *zs, int id, float z) {
+    size_t pos = 0;
+    while (pos < zs->size() && (*zs)[pos] < z)
+        pos++;
+    ids->insert(ids->begin() + pos, id);
+    zs->insert(zs->begin() + pos, z);
+}
+
+GAME_TEST(BillboardRenderList, MatchesSortedInsertion) {
+    std::mt19937 gen(314);
+    std::uniform_int_distribution<int> zDistribution(0, 200); // Lots of equal z values.
+
+    BillboardRenderList list;
+    std::vector<int> expectedIds;
+    std::vector<float> expectedZs;
+
+    for (int i = 0; i < 3000; i++) { // More than the old limit of 999.
+        float z = zDistribution(gen);
+        RenderBillboardD3D &billboard = list.add(z);
+        billboard.z_order = z;
+        billboard.PaletteIndex = i;
+        insertSorted(&expectedIds, &expectedZs, i, z);
+
+        // Interleave accesses with additions, the list should re-sort itself.
+        if (i % 500 == 0 || i == 2999) {
+            ASSERT_EQ(list.size(), expectedIds.size());
+            for (int j = 0; j < list.size(); j++) {
+                EXPECT_EQ(list[j].PaletteIndex, expectedIds[j]);
+                EXPECT_EQ(list[j].z_order, expectedZs[j]);
+            }
+        }
+    }
+
+    list.clear();
+    EXPECT_EQ(list.size(), 0);
+    list.add(1.0f).PaletteIndex = 1;
+    EXPECT_EQ(list[0].PaletteIndex, 1);
+}
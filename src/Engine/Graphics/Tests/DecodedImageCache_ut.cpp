@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <string>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/DecodedImageCache.h"
+#include "Engine/Graphics/ImageLoader.h"
+#include "Engine/LodTextureCache.h"
+
+#include "Library/FileSystem/Memory/MemoryFileSystem.h"
+#include "Library/Lod/LodWriter.h"
+#include "Library/LodFormats/LodFormats.h"
+#include "Library/LodFormats/LodImage.h"
+
+#include "Utility/ScopeGuard.h"
+#include "Utility/Streams/BlobOutputStream.h"
+
+GAME_TEST(DecodedImageCache, RoundTrip) {
+    MemoryFileSystem fs("memfs");
+    DecodedImageCache cache(&fs);
+
+    DecodedImageSource source;
+    source.path = "some.lod/texture";
+    source.size = 100;
+    source.stamp = 1234;
+    RgbaImage rgba = RgbaImage::solid(3, 2, Color(1, 2, 3, 4));
+    rgba[1][2] = Color(5, 6, 7, 8);
+    GrayscaleImage indexed = GrayscaleImage::solid(3, 2, 9);
+    Palette palette;
+    for (size_t i = 0; i < 256; i++)
+        palette.colors[i] = Color(i, 255 - i, i / 2, 255);
+
+    RgbaImage rgba2;
+    GrayscaleImage indexed2;
+    Palette palette2;
+    EXPECT_FALSE(cache.load(source, "variant", &rgba2, &indexed2, &palette2));
+    EXPECT_EQ(cache.misses(), 1);
+
+    cache.store(source, "variant", rgba, indexed, palette);
+    EXPECT_TRUE(cache.load(source, "variant", &rgba2, &indexed2, &palette2));
+    EXPECT_EQ(cache.hits(), 1);
+    EXPECT_EQ(rgba2.size(), rgba.size());
+    EXPECT_EQ(rgba2[1][2], Color(5, 6, 7, 8));
+    EXPECT_EQ(rgba2[0][0], Color(1, 2, 3, 4));
+    EXPECT_EQ(indexed2.size(), indexed.size());
+    EXPECT_EQ(indexed2[1][1], 9);
+    EXPECT_EQ(palette2.colors, palette.colors);
+
+    // Different variant is a different entry.
+    EXPECT_FALSE(cache.load(source, "other", &rgba2, &indexed2, &palette2));
+
+    // Changed source invalidates the entry.
+    DecodedImageSource changedSource = source;
+    changedSource.stamp = 4321;
+    EXPECT_FALSE(cache.load(changedSource, "variant", &rgba2, &indexed2, &palette2));
+
+    // Images w/o indexed data are supported too.
+    cache.store(changedSource, "variant", rgba, GrayscaleImage(), palette);
+    EXPECT_TRUE(cache.load(changedSource, "variant", &rgba2, &indexed2, &palette2));
+    EXPECT_FALSE(indexed2);
+    EXPECT_EQ(rgba2[1][2], Color(5, 6, 7, 8));
+}
+
+GAME_TEST(DecodedImageCache, LodLoaders) {
+    MemoryFileSystem fs("memfs");
+    DecodedImageCache cache(&fs);
+    DecodedImageCache *oldCache = pDecodedImageCache;
+    pDecodedImageCache = &cache;
+    auto guard = ScopeGuard([&] { pDecodedImageCache = oldCache; });
+
+    auto equal = [](const RgbaImage &l, const RgbaImage &r) {
+        return l.size() == r.size() && std::ranges::equal(l.pixels(), r.pixels());
+    };
+
+    // Compressed PCX: second load is a hit and returns the same pixels.
+    PCX_LOD_Compressed_Loader pcxLoader(pIcons_LOD, "makeme.pcx");
+    RgbaImage pcx1, pcx2;
+    GrayscaleImage indexed;
+    Palette palette;
+    EXPECT_TRUE(pcxLoader.LoadCached(&pcx1, &indexed, &palette));
+    EXPECT_EQ(cache.misses(), 1);
+    EXPECT_TRUE(pcxLoader.LoadCached(&pcx2, &indexed, &palette));
+    EXPECT_EQ(cache.hits(), 1);
+    EXPECT_TRUE(equal(pcx1, pcx2));
+
+    // Bitmaps: cached, uncached & repeated loads all produce the same result, and the palette of the texture in the
+    // LOD texture cache stays as it is in the LOD.
+    Bitmaps_LOD_Loader bitmapLoader(pBitmaps_LOD, "hdwtr000");
+    RgbaImage bitmap1, bitmap2, bitmap3;
+    EXPECT_TRUE(bitmapLoader.LoadCached(&bitmap1, &indexed, &palette));
+    EXPECT_TRUE(bitmapLoader.LoadCached(&bitmap2, &indexed, &palette));
+    EXPECT_TRUE(bitmapLoader.Load(&bitmap3, &indexed, &palette));
+    EXPECT_EQ(cache.hits(), 2);
+    EXPECT_TRUE(equal(bitmap1, bitmap2));
+    EXPECT_TRUE(equal(bitmap1, bitmap3));
+    EXPECT_EQ(pBitmaps_LOD->loadTexture("hdwtr000")->palette.colors,
+              lod::decodeImage(pBitmaps_LOD->reader().read("hdwtr000")).palette.colors);
+}
+
+GAME_TEST(DecodedImageCache, InPlaceReplacement) {
+    MemoryFileSystem fs("memfs");
+    DecodedImageCache cache(&fs);
+    DecodedImageCache *oldCache = pDecodedImageCache;
+    pDecodedImageCache = &cache;
+    auto guard = ScopeGuard([&] { pDecodedImageCache = oldCache; });
+
+    // Same texture with an inverted palette. Palette is stored at the end of the entry, so the entry keeps its size.
+    Blob original = Blob::copy(pBitmaps_LOD->reader().read("hdwtr000"));
+    std::string replaced(original.string_view());
+    for (size_t i = replaced.size() - 768; i < replaced.size(); i++)
+        replaced[i] = static_cast<char>(~replaced[i]);
+    ASSERT_EQ(replaced.size(), original.size());
+
+    auto makeLod = [](const Blob &entry) {
+        LodInfo info;
+        info.version = LOD_VERSION_MM7;
+        info.rootName = "bitmaps";
+
+        Blob lod;
+        BlobOutputStream stream(&lod, "some.lod");
+        LodWriter writer(&stream, info);
+        writer.write("hdwtr000", entry);
+        writer.close();
+        stream.close();
+        return lod;
+    };
+
+    RgbaImage image1, image2, image3;
+    GrayscaleImage indexed;
+    Palette palette;
+
+    LodTextureCache lod1;
+    lod1.open(makeLod(original).withDisplayPath("some.lod"));
+    Bitmaps_LOD_Loader loader1(&lod1, "hdwtr000");
+    EXPECT_TRUE(loader1.LoadCached(&image1, &indexed, &palette));
+    EXPECT_EQ(cache.misses(), 1);
+
+    // Same LOD path, same entry offset, same entry size, same LOD size - but different data, so this must be a miss.
+    LodTextureCache lod2;
+    lod2.open(makeLod(Blob::fromString(replaced)).withDisplayPath("some.lod"));
+    ASSERT_EQ(lod2.reader().fileSize(), lod1.reader().fileSize());
+    Bitmaps_LOD_Loader loader2(&lod2, "hdwtr000");
+    EXPECT_TRUE(loader2.LoadCached(&image2, &indexed, &palette));
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 2);
+
+    EXPECT_TRUE(loader2.Load(&image3, &indexed, &palette));
+    EXPECT_TRUE(std::ranges::equal(image2.pixels(), image3.pixels()));
+    EXPECT_FALSE(std::ranges::equal(image1.pixels(), image2.pixels()));
+}
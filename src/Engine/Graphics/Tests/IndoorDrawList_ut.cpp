@@ -0,0 +1,89 @@
+#include <array>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/IndoorDrawList.h"
+
+GAME_TEST(IndoorDrawList, Build) {
+    std::array<int16_t, 4> quad = {{0, 1, 2, 3}};
+    std::array<int16_t, 3> triangle = {{3, 4, 5}};
+    std::array<int16_t, 5> pentagon = {{6, 7, 8, 9, 10}};
+    std::array<int16_t, 3> sky = {{11, 12, 13}};
+
+    std::vector<BLVFace> faces(5);
+    faces[0].uNumVertices = 4;
+    faces[0].pVertexIDs = quad.data();
+    faces[1].uNumVertices = 3;
+    faces[1].pVertexIDs = triangle.data();
+    faces[2].uNumVertices = 0; // Degenerate faces get an empty range.
+    faces[3].uNumVertices = 5;
+    faces[3].pVertexIDs = pentagon.data();
+    faces[4].uNumVertices = 3;
+    faces[4].pVertexIDs = sky.data();
+    faces[4].uAttributes = FACE_INDOOR_SKY;
+
+    // Door moves face 3 and vertex 3, which is shared with faces 0 & 1.
+    std::array<int16_t, 1> doorFaces = {{3}};
+    std::array<int16_t, 1> doorVertices = {{3}};
+    std::vector<BLVDoor> doors(1);
+    doors[0].pFaceIDs = doorFaces.data();
+    doors[0].uNumFaces = doorFaces.size();
+    doors[0].pVertexIDs = doorVertices.data();
+    doors[0].uNumVertices = doorVertices.size();
+
+    IndoorDrawList list;
+    list.build(faces, doors);
+
+    EXPECT_EQ(list.faceCount(), 5);
+    EXPECT_EQ(list.vertexCount(), 6 + 3 + 0 + 9 + 3);
+    EXPECT_EQ(list.firstVertex(0), 0);
+    EXPECT_EQ(list.firstVertex(1), 6);
+    EXPECT_EQ(list.firstVertex(3), 9);
+    EXPECT_EQ(list.numVertices(2), 0);
+    EXPECT_EQ(list.numVertices(3), 9);
+
+    EXPECT_TRUE(list.isDynamic(0));
+    EXPECT_TRUE(list.isDynamic(1));
+    EXPECT_FALSE(list.isDynamic(2));
+    EXPECT_TRUE(list.isDynamic(3));
+    EXPECT_TRUE(list.isDynamic(4));
+
+    list.build(faces, {});
+    EXPECT_FALSE(list.isDynamic(0));
+    EXPECT_FALSE(list.isDynamic(3));
+    EXPECT_TRUE(list.isDynamic(4));
+}
+
+GAME_TEST(IndoorDrawList, Frame) {
+    std::array<int16_t, 4> quad = {{0, 1, 2, 3}};
+    std::vector<BLVFace> faces(3);
+    for (BLVFace &face : faces) {
+        face.uNumVertices = 4;
+        face.pVertexIDs = quad.data();
+    }
+
+    IndoorDrawList list;
+    list.build(faces, {});
+
+    list.beginFrame();
+    list.addFace(2, 0);
+    list.addFace(1, 5);
+    list.addFace(0, 0);
+    EXPECT_EQ(list.indexCount(), 18);
+    auto indices = [&](int unit) {
+        return std::vector<uint32_t>(list.indices(unit).begin(), list.indices(unit).end());
+    };
+    EXPECT_EQ(indices(0), std::vector<uint32_t>({12, 13, 14, 15, 16, 17, 0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(indices(5), std::vector<uint32_t>({6, 7, 8, 9, 10, 11}));
+    EXPECT_TRUE(list.indices(1).empty());
+
+    list.beginFrame();
+    EXPECT_EQ(list.indexCount(), 0);
+    EXPECT_TRUE(list.indices(0).empty());
+
+    list.clear();
+    EXPECT_EQ(list.faceCount(), 0);
+    EXPECT_EQ(list.vertexCount(), 0);
+}
@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Objects/ObjectGrid.h"
+#include "Engine/Engine.h"
+#include "Engine/MapEnumFunctions.h"
+#include "Engine/MapInfo.h"
+
+static std::vector<Vec3f> sectorSamplePoints(float step) {
+    std::vector<Vec3f> result;
+    for (const BLVSector &sector : pIndoor->pSectors | std::views::drop(1))
+        for (float y = sector.pBounding.y1; y <= sector.pBounding.y2; y += step)
+            for (float x = sector.pBounding.x1; x <= sector.pBounding.x2; x += step)
+                result.push_back(Vec3f(x + 7, y + 11, sector.pBounding.z1 + 40));
+    return result;
+}
+
+static float floorZ(const BLVFace &face, float x, float y) {
+    if (face.uPolygonType == POLYGON_Floor)
+        return pIndoor->pVertices[face.pVertexIDs[0]].z;
+    return face.zCalc.calculate(x, y);
+}
+
+/**
+ * @param pos                           Point to check.
+ * @param halfHeight                    Vertical slack for the sector bounds check. `GetSector` uses 64.
+ * @return                              Floor faces that `GetSector` considers for the given point, in the order in
+ *                                      which they are checked.
+ */
+static std::vector<int> candidateFloors(const Vec3f &pos, float halfHeight = 64) {
+    std::vector<int> result;
+    for (int i = 1; i < pIndoor->pSectors.size(); i++) {
+        const BLVSector &sector = pIndoor->pSectors[i];
+        if (!sector.pBounding.intersectsCuboid(pos, Vec3f(5, 5, halfHeight)) || !sector.pFloors)
+            continue;
+
+        for (int z = 0; z < sector.uNumFloors + sector.uNumPortals; z++) {
+            int faceId = z < sector.uNumFloors ? sector.pFloors[z] : sector.pPortals[z - sector.uNumFloors];
+            BLVFace &face = pIndoor->pFaces[faceId];
+            if (face.uPolygonType != POLYGON_Floor && face.uPolygonType != POLYGON_InBetweenFloorAndWall)
+                continue;
+            if (face.Contains(Vec3f(pos.x, pos.y, 0), MODEL_INDOOR, engine->config->gameplay.FloorChecksEps.value(), FACE_XY_PLANE))
+                result.push_back(faceId);
+        }
+    }
+    return result;
+}
+
+GAME_TEST(IndoorLocation, GetSector) {
+    game.startNewGame();
+
+    // Grid is only an acceleration structure, results must be the same as for a brute force scan in all indoor maps.
+    int maps = 0;
+    for (MapId map : pMapStats->pInfos.indices()) {
+        if (!isMapIndoor(map))
+            continue;
+
+        game.teleportTo(map, Vec3f(0, 0, 0), 0);
+        ASSERT_EQ(engine->_currentLoadedMapId, map);
+        maps++;
+
+        std::vector<Vec3f> points = sectorSamplePoints(256);
+
+        // Grid with a single cell degenerates into a brute force scan over all sectors.
+        std::vector<BBoxf> bounds;
+        for (const BLVSector &sector : pIndoor->pSectors)
+            bounds.push_back(sector.pBounding);
+        ObjectGrid bruteForceGrid(65536);
+        bruteForceGrid.build(bounds);
+
+        std::vector<int> grid, bruteForce;
+        for (const Vec3f &pos : points)
+            grid.push_back(pIndoor->GetSector(pos));
+        std::swap(pIndoor->sectorGrid, bruteForceGrid);
+        for (const Vec3f &pos : points)
+            bruteForce.push_back(pIndoor->GetSector(pos));
+        std::swap(pIndoor->sectorGrid, bruteForceGrid);
+        EXPECT_EQ(grid, bruteForce) << pMapStats->pInfos[map].fileName;
+    }
+    EXPECT_GT(maps, 0);
+}
+
+GAME_TEST(IndoorLocation, GetSectorManyFloors) {
+    game.startNewGame();
+    game.teleportTo(MAP_DRAGON_CAVES, Vec3f(0, 0, 0), 0);
+    ASSERT_EQ(engine->_currentLoadedMapId, MAP_DRAGON_CAVES);
+
+    // Dragon caves have spots with more than five floors stacked on top of each other. GetSector used to only look at
+    // the first five floors it found, so standing on any of the others could return the wrong sector. Check points
+    // right above every such floor, the sector of the floor right below the point must be picked.
+    int checkedPoints = 0;
+    for (const Vec3f &sample : sectorSamplePoints(64)) {
+        std::vector<int> floors = candidateFloors(Vec3f(sample.x, sample.y, 0), 1000000);
+        if (floors.size() <= 5)
+            continue;
+
+        for (int faceId : floors) {
+            const BLVFace &face = pIndoor->pFaces[faceId];
+            Vec3f pos(sample.x, sample.y, floorZ(face, sample.x, sample.y) + 10);
+
+            std::vector<int> candidates = candidateFloors(pos);
+            auto index = std::ranges::find(candidates, faceId) - candidates.begin();
+            if (index < 5 || index == candidates.size())
+                continue; // Old code would have seen this one too.
+
+            // Skip the points where another floor is just as close, picked sector is ambiguous there.
+            int closest = 0;
+            for (int otherId : candidates) {
+                const BLVFace &other = pIndoor->pFaces[otherId];
+                int dist = pos.z - floorZ(other, pos.x, pos.y);
+                if (dist >= 0 && dist <= 10 && other.uSectorID != face.uSectorID)
+                    closest++;
+            }
+            if (closest > 0)
+                continue;
+
+            EXPECT_EQ(pIndoor->GetSector(pos), face.uSectorID) << pos.x << ", " << pos.y << ", " << pos.z;
+            checkedPoints++;
+        }
+    }
+    EXPECT_GT(checkedPoints, 0);
+}
@@ -0,0 +1,69 @@
+#include <chrono>
+#include <utility>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/LineOfSightCache.h"
+#include "Engine/Objects/Actor.h"
+#include "Engine/MapEnums.h"
+
+GAME_TEST(LineOfSightCache, FindInsert) {
+    using namespace std::chrono_literals; // NOLINT
+
+    LineOfSightCache cache;
+    Vec3f a(1, 2, 3), b(4, 5, 6);
+
+    EXPECT_EQ(cache.find(1, 2, a, b), std::nullopt);
+    cache.insert(1, 2, a, b, true, 100ns);
+    EXPECT_EQ(cache.find(1, 2, a, b), true);
+    EXPECT_EQ(cache.find(2, 1, a, b), std::nullopt); // Different sectors.
+    EXPECT_EQ(cache.find(1, 2, b, a), std::nullopt); // Line of sight checks are not symmetric.
+    EXPECT_EQ(cache.find(1, 2, Vec3f(-0.0f, 0, 0), b), std::nullopt);
+    cache.insert(1, 2, Vec3f(0, 0, 0), b, false, 100ns);
+    EXPECT_EQ(cache.find(1, 2, Vec3f(0, 0, 0), b), false);
+    EXPECT_EQ(cache.find(1, 2, Vec3f(-0.0f, 0, 0), b), std::nullopt); // Keys are bitwise.
+
+    EXPECT_EQ(cache.hits(), 2);
+    EXPECT_EQ(cache.misses(), 5);
+    EXPECT_EQ(cache.savedTime(), 200ns * 2 / 5);
+
+    cache.invalidate();
+    EXPECT_EQ(cache.find(1, 2, a, b), std::nullopt);
+    EXPECT_EQ(cache.hits(), 2);
+
+    cache.resetStats();
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 0);
+}
+
+GAME_TEST(LineOfSightCache, CastleHarmondale) {
+    game.startNewGame();
+    game.teleportTo(MAP_CASTLE_HARMONDALE, Vec3f(-5100, 2100, 0), 0);
+
+    std::vector<std::pair<Pid, Pid>> queries;
+    for (int i = 0; i < pActors.size(); i++) {
+        queries.emplace_back(Pid(OBJECT_Actor, i), Pid(OBJECT_Character, 0));
+        for (int j = 0; j < pActors.size(); j++)
+            if (i != j)
+                queries.emplace_back(Pid(OBJECT_Actor, i), Pid(OBJECT_Actor, j));
+    }
+    ASSERT_FALSE(queries.empty());
+
+    std::vector<bool> uncached, cached;
+    for (const auto &[from, to] : queries) {
+        lineOfSightCache.invalidate();
+        uncached.push_back(Detect_Between_Objects(from, to));
+    }
+
+    // Cached results must match the uncached ones, both on the first pass and when served from the cache.
+    lineOfSightCache.invalidate();
+    lineOfSightCache.resetStats();
+    for (int pass = 0; pass < 2; pass++) {
+        cached.clear();
+        for (const auto &[from, to] : queries)
+            cached.push_back(Detect_Between_Objects(from, to));
+        EXPECT_EQ(cached, uncached);
+    }
+    EXPECT_GT(lineOfSightCache.hits(), 0);
+}
@@ -0,0 +1,106 @@
+#include <array>
+#include <cstring>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/Image.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/OutdoorBuildingBatches.h"
+#include "Engine/MapEnums.h"
+
+using Vertex = OutdoorBuildingBatches::Vertex;
+using UnitVertices = std::array<std::vector<Vertex>, OutdoorBuildingBatches::MAX_TEXTURE_UNITS>;
+
+GAME_TEST(OutdoorBuildingBatches, Harmondale) {
+    game.startNewGame();
+    game.teleportTo(MAP_HARMONDALE, Vec3f(-18000, 12500, 480), 0);
+
+    std::vector<BSPModel> &models = pOutdoor->pBModels;
+
+    // Same unit & layer assignment scheme as in the renderer - one unit per texture size.
+    std::map<std::pair<int, int>, int> units;
+    std::map<int, int> layers;
+    std::map<GraphicsImage *, OutdoorBuildingBatches::TextureLayer> textureLayers;
+    auto resolver = [&](GraphicsImage *texture) {
+        auto [pos, inserted] = textureLayers.emplace(texture, OutdoorBuildingBatches::TextureLayer());
+        if (inserted) {
+            std::pair<int, int> size(texture->width(), texture->height());
+            int unit = units.emplace(size, units.size() % OutdoorBuildingBatches::MAX_TEXTURE_UNITS).first->second;
+            pos->second = OutdoorBuildingBatches::TextureLayer(unit, layers[unit]++);
+        }
+        return pos->second;
+    };
+
+    OutdoorBuildingBatches batches;
+    batches.build(models, resolver, false);
+
+    std::vector<int> modelIds;
+    for (const BSPModel &model : models)
+        modelIds.push_back(model.index);
+
+    // This is what the renderer used to do on every frame - generate the vertices for all visible faces.
+    auto streamAll = [&] {
+        UnitVertices result;
+        for (BSPModel &model : models) {
+            for (ODMFace &face : model.pFaces) {
+                GraphicsImage *texture = face.GetTexture();
+                if (face.Invisible() || !texture)
+                    continue;
+
+                OutdoorBuildingBatches::TextureLayer layer = resolver(texture);
+                for (int z = 0; z < face.uNumVertices - 2; z++) {
+                    for (int i : {0, z + 1, z + 2}) {
+                        const Vec3f &pos = model.pVertices[face.pVertexIDs[i]];
+                        const Vec3f &normal = face.facePlane.normal;
+                        result[layer.unit].push_back(Vertex(pos.x, pos.y, pos.z,
+                                                            face.pTextureUIDs[i] + face.sTextureDeltaU,
+                                                            face.pTextureVIDs[i] + face.sTextureDeltaV,
+                                                            layer.unit, layer.layer, normal.x, normal.y, normal.z,
+                                                            OutdoorBuildingBatches::attribFlags(face, false)));
+                    }
+                }
+            }
+        }
+        return result;
+    };
+
+    // Batches must contain exactly the same triangles, in the same order, minus the degenerate ones.
+    auto expectMatchesStreaming = [&] {
+        UnitVertices expected = streamAll();
+        Vertex degenerate = {};
+        for (int unit = 0; unit < OutdoorBuildingBatches::MAX_TEXTURE_UNITS; unit++) {
+            std::vector<Vertex> drawn;
+            for (OutdoorBuildingBatches::DrawRange range : batches.drawRanges(unit))
+                for (const Vertex &vertex : batches.vertices().subspan(range.first, range.count))
+                    if (std::memcmp(&vertex, &degenerate, sizeof(Vertex)) != 0)
+                        drawn.push_back(vertex);
+            ASSERT_EQ(drawn.size(), expected[unit].size());
+            EXPECT_EQ(std::memcmp(drawn.data(), expected[unit].data(), drawn.size() * sizeof(Vertex)), 0);
+        }
+    };
+
+    batches.prepareFrame(models, modelIds, false);
+    expectMatchesStreaming();
+    EXPECT_EQ(batches.faceUpdates(), 0);
+    EXPECT_TRUE(batches.dirtyRanges().empty());
+
+    // Hiding a face should only rewrite that face.
+    ODMFace *faceToHide = nullptr;
+    for (BSPModel &model : models)
+        for (ODMFace &face : model.pFaces)
+            if (!faceToHide && face.Visible() && face.GetTexture() && face.uNumVertices >= 3)
+                faceToHide = &face;
+    ASSERT_NE(faceToHide, nullptr);
+    int layoutVersion = batches.layoutVersion();
+    faceToHide->uAttributes |= FACE_IsInvisible;
+    batches.prepareFrame(models, modelIds, false);
+    EXPECT_EQ(batches.layoutVersion(), layoutVersion);
+    EXPECT_EQ(batches.faceUpdates(), 1);
+    ASSERT_EQ(batches.dirtyRanges().size(), 1);
+    EXPECT_EQ(batches.dirtyRanges()[0].count, 3 * (faceToHide->uNumVertices - 2));
+    expectMatchesStreaming();
+    faceToHide->uAttributes &= ~FACE_IsInvisible;
+}
@@ -0,0 +1,62 @@
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/BSPModel.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/OutdoorCollisionMesh.h"
+#include "Engine/MapEnums.h"
+
+GAME_TEST(OutdoorCollisionMesh, Build) {
+    std::vector<BSPModel> models(2);
+    models[0].index = 0;
+    models[1].index = 1;
+
+    // Square floor in the second model, with vertices listed in a shuffled order in the vertex array.
+    BSPModel &model = models[1];
+    model.pVertices = {Vec3f(100, 0, 10), Vec3f(0, 0, 10), Vec3f(100, 100, 10), Vec3f(0, 100, 10)};
+    ODMFace &face = model.pFaces.emplace_back();
+    face.facePlane.normal = Vec3f(0, 0, 1);
+    face.facePlane.dist = -10;
+    face.uAttributes = FACE_XY_PLANE | FACE_OUTLINED;
+    face.uNumVertices = 4;
+    face.pVertexIDs = {{1, 0, 2, 3}};
+    face.pBoundingBox = BBoxf::forPoints(Vec3f(0, 0, 10), Vec3f(100, 100, 10));
+
+    OutdoorCollisionMesh mesh;
+    mesh.build(models);
+
+    int index = mesh.faceIndex(1, 0);
+    EXPECT_EQ(index, 0);
+    EXPECT_EQ(mesh.attributes(index), FACE_XY_PLANE); // FACE_OUTLINED is not collision-relevant.
+    EXPECT_EQ(mesh.plane(index), face.facePlane);
+    ASSERT_EQ(mesh.vertices(index).size(), 4);
+    EXPECT_EQ(mesh.vertices(index)[0], Vec3f(0, 0, 10));
+    EXPECT_EQ(mesh.vertices(index)[3], Vec3f(0, 100, 10));
+
+    EXPECT_TRUE(mesh.contains(index, Vec3f(50, 50, 10)));
+    EXPECT_TRUE(mesh.contains(index, Vec3f(1, 99, 10)));
+    EXPECT_FALSE(mesh.contains(index, Vec3f(101, 50, 10)));
+    EXPECT_FALSE(mesh.contains(index, Vec3f(50, -1, 10)));
+
+    mesh.setAttributes(1, 0, FACE_XY_PLANE | FACE_ETHEREAL | FACE_IsFluid);
+    EXPECT_EQ(mesh.attributes(index), FACE_XY_PLANE | FACE_ETHEREAL);
+}
+
+GAME_TEST(OutdoorCollisionMesh, Harmondale) {
+    game.startNewGame();
+    game.teleportTo(MAP_HARMONDALE, Vec3f(-18000, 12500, 480), 0);
+
+    // Check points on a 5x5x5 lattice inside each face's bounding box, results must match ODMFace::Contains.
+    for (const BSPModel &model : pOutdoor->pBModels) {
+        for (const ODMFace &face : model.pFaces) {
+            const BBoxf &box = face.pBoundingBox;
+            int meshFace = pOutdoor->collisionMesh.faceIndex(model.index, face.index);
+            for (int i = 0; i < 125; i++) {
+                Vec3f pos(box.x1 + (box.x2 - box.x1) * (i % 5) / 4, box.y1 + (box.y2 - box.y1) * (i / 5 % 5) / 4,
+                          box.z1 + (box.z2 - box.z1) * (i / 25) / 4);
+                EXPECT_EQ(pOutdoor->collisionMesh.contains(meshFace, pos), face.Contains(pos, model.index));
+            }
+        }
+    }
+}
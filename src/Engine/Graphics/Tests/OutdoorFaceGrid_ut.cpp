@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/BSPModel.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/OutdoorFaceGrid.h"
+#include "Engine/Objects/Actor.h"
+#include "Engine/MapEnums.h"
+
+static std::vector<BSPModel> makeRandomModels(std::mt19937 &gen) {
+    std::uniform_real_distribution<float> pos(-40000.0f, 40000.0f);
+    std::uniform_real_distribution<float> size(0.0f, 3000.0f);
+
+    std::vector<BSPModel> result;
+    for (int i = 0; i < 20; i++) {
+        BSPModel &model = result.emplace_back();
+        model.index = i;
+        for (int j = 0; j < 40; j++) {
+            ODMFace &face = model.pFaces.emplace_back();
+            face.index = j;
+            face.pBoundingBox.x1 = pos(gen);
+            face.pBoundingBox.y1 = pos(gen);
+            face.pBoundingBox.x2 = face.pBoundingBox.x1 + size(gen);
+            face.pBoundingBox.y2 = face.pBoundingBox.y1 + size(gen);
+        }
+    }
+    return result;
+}
+
+static void checkContainsAll(std::span<const OutdoorFaceGrid::FaceRef> candidates, const std::vector<BSPModel> &models, const BBoxf &box) {
+    EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+    EXPECT_EQ(std::adjacent_find(candidates.begin(), candidates.end()), candidates.end());
+
+    for (const BSPModel &model : models) {
+        for (const ODMFace &face : model.pFaces) {
+            if (!box.intersects(face.pBoundingBox))
+                continue;
+            OutdoorFaceGrid::FaceRef ref = {static_cast<uint16_t>(model.index), static_cast<uint16_t>(face.index)};
+            EXPECT_TRUE(std::binary_search(candidates.begin(), candidates.end(), ref));
+        }
+    }
+}
+
+GAME_TEST(OutdoorFaceGrid, MatchesBruteForce) {
+    std::mt19937 gen(12345);
+    std::vector<BSPModel> models = makeRandomModels(gen);
+
+    OutdoorFaceGrid grid;
+    EXPECT_TRUE(grid.facesAt(0, 0).empty());
+    grid.build(models);
+
+    std::uniform_real_distribution<float> pos(-45000.0f, 45000.0f);
+    std::uniform_real_distribution<float> size(0.0f, 2000.0f);
+    for (int i = 0; i < 1000; i++) {
+        float x = pos(gen), y = pos(gen);
+        checkContainsAll(grid.facesAt(x, y), models, BBoxf::forPoints(Vec3f(x, y, 0), Vec3f(x, y, 0)));
+
+        BBoxf box = BBoxf::forPoints(Vec3f(x, y, 0), Vec3f(x + size(gen), y + size(gen), 0));
+        checkContainsAll(grid.facesIn(box), models, box);
+    }
+
+    grid.clear();
+    EXPECT_TRUE(grid.facesAt(0, 0).empty());
+}
+
+GAME_TEST(OutdoorFaceGrid, Harmondale) {
+    game.startNewGame();
+    game.teleportTo(MAP_HARMONDALE, Vec3f(-18000, 12500, 480), 0);
+
+    std::vector<Vec3f> points;
+    for (int y = -32768; y < 32768; y += 256)
+        for (int x = -32768; x < 32768; x += 256)
+            points.push_back(Vec3f(x + 17, y + 23, 0)); // Offset so that we don't always land on cell boundaries.
+    for (const Actor &actor : pActors)
+        points.push_back(actor.pos);
+
+    // Filtered grid queries must produce exactly the same faces, in the same order, as a brute force scan.
+    for (const Vec3f &pos : points) {
+        std::vector<Pid> bruteForce, grid;
+        for (const BSPModel &model : pOutdoor->pBModels)
+            if (model.pBoundingBox.containsXY(pos.x, pos.y))
+                for (const ODMFace &face : model.pFaces)
+                    if (face.pBoundingBox.containsXY(pos.x, pos.y))
+                        bruteForce.push_back(Pid::odmFace(model.index, face.index));
+        for (OutdoorFaceGrid::FaceRef ref : pOutdoor->faceGrid.facesAt(pos.x, pos.y)) {
+            const BSPModel &model = pOutdoor->pBModels[ref.modelId];
+            const ODMFace &face = model.pFaces[ref.faceId];
+            if (model.pBoundingBox.containsXY(pos.x, pos.y) && face.pBoundingBox.containsXY(pos.x, pos.y))
+                grid.push_back(Pid::odmFace(model.index, face.index));
+        }
+        EXPECT_EQ(grid, bruteForce);
+
+        // Same for box queries, using boxes of roughly actor size.
+        BBoxf box = BBoxf::cubic(pos, 128);
+        bruteForce.clear();
+        grid.clear();
+        for (const BSPModel &model : pOutdoor->pBModels)
+            if (box.intersects(model.pBoundingBox))
+                for (const ODMFace &face : model.pFaces)
+                    if (box.intersects(face.pBoundingBox))
+                        bruteForce.push_back(Pid::odmFace(model.index, face.index));
+        for (OutdoorFaceGrid::FaceRef ref : pOutdoor->faceGrid.facesIn(box)) {
+            const BSPModel &model = pOutdoor->pBModels[ref.modelId];
+            const ODMFace &face = model.pFaces[ref.faceId];
+            if (box.intersects(model.pBoundingBox) && box.intersects(face.pBoundingBox))
+                grid.push_back(Pid::odmFace(model.index, face.index));
+        }
+        EXPECT_EQ(grid, bruteForce);
+    }
+}
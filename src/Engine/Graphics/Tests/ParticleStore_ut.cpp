@@ -0,0 +1,80 @@
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Graphics/ParticleEngine.h"
+
+#include "Library/Random/SequentialRandomEngine.h"
+
+static Particle_sw makeParticle(ParticleFlags type, float x, Duration timeToLive) {
+    Particle_sw result;
+    result.type = type;
+    result.x = x;
+    result.timeToLive = timeToLive;
+    result.uDiffuse = Color(200, 100, 50);
+    return result;
+}
+
+GAME_TEST(ParticleStore, Capacity) {
+    SequentialRandomEngine rng;
+    ParticleStore store(3);
+
+    for (int i = 0; i < 3; i++)
+        EXPECT_TRUE(store.add(makeParticle(ParticleType_Diffuse, i, Duration::fromTicks(100)), &rng));
+    EXPECT_FALSE(store.add(makeParticle(ParticleType_Diffuse, 3, Duration::fromTicks(100)), &rng));
+    EXPECT_EQ(store.size(), 3);
+
+    store.setCapacity(2);
+    EXPECT_EQ(store.size(), 2);
+    EXPECT_EQ(store.position(0).x, 0);
+    EXPECT_EQ(store.position(1).x, 1);
+
+    store.setCapacity(10);
+    EXPECT_TRUE(store.add(makeParticle(ParticleType_Diffuse, 3, Duration::fromTicks(100)), &rng));
+    EXPECT_EQ(store.size(), 3);
+
+    store.clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_EQ(store.capacity(), 10);
+}
+
+GAME_TEST(ParticleStore, Expiration) {
+    SequentialRandomEngine rng;
+    ParticleStore store;
+
+    store.add(makeParticle(ParticleType_Diffuse, 0, Duration::fromTicks(10)), &rng);
+    store.add(makeParticle(ParticleType_Diffuse, 1, Duration::fromTicks(100)), &rng);
+    store.add(makeParticle(ParticleType_Diffuse, 2, Duration::fromTicks(20)), &rng);
+    store.add(makeParticle(ParticleType_Diffuse, 3, Duration::fromTicks(200)), &rng);
+
+    // Expired particles are replaced with the ones from the end.
+    store.update(Duration::fromTicks(20), &rng);
+    ASSERT_EQ(store.size(), 2);
+    EXPECT_EQ(store.position(0).x, 3);
+    EXPECT_EQ(store.position(1).x, 1);
+    EXPECT_EQ(store.timeToLive(0), Duration::fromTicks(180));
+    EXPECT_EQ(store.timeToLive(1), Duration::fromTicks(80));
+
+    store.update(Duration::fromTicks(80), &rng);
+    ASSERT_EQ(store.size(), 1);
+    EXPECT_EQ(store.position(0).x, 3);
+}
+
+GAME_TEST(ParticleStore, Update) {
+    SequentialRandomEngine rng;
+    ParticleStore store;
+
+    Particle_sw particle = makeParticle(ParticleType_Dropping | ParticleType_Rotating, 0, Duration::fromTicks(100));
+    particle.r = 128; // Shift.
+    particle.b = 256;
+    store.add(particle, &rng);
+    int angle = store.angle(0);
+    EXPECT_EQ(store.lightColor(0), Color(200, 100, 50));
+
+    store.update(Duration::fromTicks(16), &rng);
+    EXPECT_EQ(store.shift(0), Vec3f(128, 0, 256 - 16 * 5));
+    EXPECT_EQ(store.position(0), Vec3f(16, 0, (256 - 16 * 5) / 8));
+    EXPECT_EQ(store.angle(0), angle + 1 - 128); // Rotation speed is the first random number minus 128.
+
+    // Light color fades out once time to live goes below 128 ticks.
+    EXPECT_EQ(store.timeToLive(0), Duration::fromTicks(84));
+    EXPECT_EQ(store.lightColor(0), Color(132, 66, 33));
+}
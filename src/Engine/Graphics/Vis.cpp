@@ -132,7 +132,7 @@ bool Vis::IsPolygonOccludedByBillboard(RenderVertexSoft *vertices,
     // v5 = 0;
 
     // v6 = render->pBillboardRenderListD3D;
-    for (unsigned i = 0; i < render->uNumBillboardsToDraw; ++i) {
+    for (unsigned i = 0; i < render->pBillboardRenderListD3D.size(); ++i) {
         RenderBillboardD3D *billboard = &render->pBillboardRenderListD3D[i];
         if (IsPointInsideD3DBillboard(billboard, x, y)) {
             if (v13 == -1)
@@ -226,7 +226,7 @@ void Vis::GetPolygonScreenSpaceCenter(RenderVertexSoft *vertices,
 void Vis::PickBillboards_Mouse(float fPickDepth, float fX, float fY,
                                Vis_SelectionList *list,
                                Vis_SelectionFilter *filter) {
-    for (int i = 0; i < render->uNumBillboardsToDraw; ++i) {
+    for (int i = 0; i < render->pBillboardRenderListD3D.size(); ++i) {
         RenderBillboardD3D *d3d_billboard = &render->pBillboardRenderListD3D[i];
         if (isBillboardPartOfSelection(i, filter) && IsPointInsideD3DBillboard(d3d_billboard, fX, fY)) {
             if (DoesRayIntersectBillboard(fPickDepth, i)) {
@@ -724,7 +724,7 @@ Vis_PIDAndDepth Vis::PickMouse(float fDepth, float fMouseX, float fMouseY,
 //----- (004C06F8) --------------------------------------------------------
 void Vis::PickBillboards_Keyboard(float pick_depth, Vis_SelectionList *list,
                                   Vis_SelectionFilter *filter) {
-    for (int i = 0; i < render->uNumBillboardsToDraw; ++i) {
+    for (int i = 0; i < render->pBillboardRenderListD3D.size(); ++i) {
         RenderBillboardD3D *d3d_billboard = &render->pBillboardRenderListD3D[i];
 
         if (isBillboardPartOfSelection(i, filter)) {
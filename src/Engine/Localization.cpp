@@ -1,15 +1,15 @@
 #include "Localization.h"
 
-#include <cstring>
 #include <string>
-#include <vector>
+#include <string_view>
 
 #include "Engine/Objects/CharacterEnumFunctions.h"
 #include "Engine/Engine.h"
 #include "Engine/GameResourceManager.h"
 
+#include "Library/Tsv/TsvReader.h"
+
 #include "Utility/String/Transformations.h"
-#include "Utility/String/Split.h"
 
 Localization *localization = nullptr;
 
@@ -26,47 +26,17 @@ std::string Localization::SkillValueShortString(CombinedSkillValue skillValue) c
 
 //----- (00452C49) --------------------------------------------------------
 bool Localization::Initialize() {
-    char *tmp_pos;     // eax@3
-    int step;          // ebp@4
-    unsigned char c;   // dl@5
-    int temp_str_len;  // ecx@5
-    bool string_end;   // [sp+14h] [bp-4h]@4
-
-    this->localization_raw = engine->_gameResourceManager->getEventsFile("global.txt").string_view();
-    if (this->localization_raw.empty()) {
+    Blob globalTxt = engine->_gameResourceManager->getEventsFile("global.txt");
+    if (globalTxt.empty()) {
         return false;
     }
 
-    strtok(this->localization_raw.data(), "\r");
-    strtok(NULL, "\r");
-
+    TsvReader tsv(globalTxt);
+    tsv.skipLines(2);
     for (LstrId i : Segment(LSTR_FIRST_MM7, LSTR_LAST_MM7)) {
-        char *test_string = strtok(NULL, "\r") + 1;
-        step = 0;
-        string_end = false;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            if (c != '\t') {
-                do {
-                    if (!c) break;
-                    c = *(test_string + temp_str_len + 1);
-                    temp_str_len++;
-                } while (c != '\t');
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) string_end = true;
-
-            *tmp_pos = 0;
-            if (temp_str_len == 0) {
-                string_end = true;
-            } else {
-                if (step == 1)
-                    this->localization_strings[i] = removeQuotes(test_string);
-            }
-            ++step;
-            test_string = tmp_pos + 1;
-        } while (step <= 2 && !string_end);
+        tsv.readLine();
+        if (tsv.leadingFieldCount(3) > 1)
+            this->localization_strings[i] = removeQuotes(tsv.field(1));
     }
 
     // TODO(captainurist): should be moved to localization files eventually
@@ -334,20 +304,18 @@ void Localization::InitializeSkillNames() {
     //    "But there is not much room to improve finesse or mastery for such a rudimentary weapon though. "
     //    "So don't expect to become thwonking killer and devastating anyone beyond weaklings.";
 
-    skill_desc_raw = engine->_gameResourceManager->getEventsFile("skilldes.txt").string_view();
-    strtok(skill_desc_raw.data(), "\r");
+    Blob skillDescTxt = engine->_gameResourceManager->getEventsFile("skilldes.txt");
+    TsvReader tsv(skillDescTxt);
+    tsv.skipLines(1);
     for (Skill i : allVisibleSkills()) {
-        char *test_string = strtok(NULL, "\r") + 1;
-
-        if (test_string != NULL && strlen(test_string) > 0) {
-            auto tokens = tokenize(test_string, '\t');
-            assert(tokens.size() >= 6 && "Invalid number of tokens");
-
-            this->skill_descriptions[i] = removeQuotes(tokens[1]);
-            this->skill_descriptions_normal[i] = removeQuotes(tokens[2]);
-            this->skill_descriptions_expert[i] = removeQuotes(tokens[3]);
-            this->skill_descriptions_master[i] = removeQuotes(tokens[4]);
-            this->skill_descriptions_grand[i] = removeQuotes(tokens[5]);
+        tsv.readLine();
+
+        if (!tsv.line().empty()) {
+            this->skill_descriptions[i] = removeQuotes(tsv.field(1));
+            this->skill_descriptions_normal[i] = removeQuotes(tsv.field(2));
+            this->skill_descriptions_expert[i] = removeQuotes(tsv.field(3));
+            this->skill_descriptions_master[i] = removeQuotes(tsv.field(4));
+            this->skill_descriptions_grand[i] = removeQuotes(tsv.field(5));
         }
     }
 }
@@ -398,13 +366,13 @@ void Localization::InitializeClassNames() {
     this->class_names[CLASS_ARCHAMGE] = this->localization_strings[LSTR_ARCHMAGE];
     this->class_names[CLASS_LICH] = this->localization_strings[LSTR_LICH];
 
-    this->class_desc_raw = engine->_gameResourceManager->getEventsFile("class.txt").string_view();
-    strtok(this->class_desc_raw.data(), "\r");
+    Blob classTxt = engine->_gameResourceManager->getEventsFile("class.txt");
+    TsvReader tsv(classTxt);
+    tsv.skipLines(1);
     for (Class i : class_desciptions.indices()) {
-        char *test_string = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(test_string, '\t');
-        assert(tokens.size() == 3 && "Invalid number of tokens");
-        class_desciptions[i] = removeQuotes(tokens[1]);
+        tsv.readLine();
+        assert(tsv.fieldCount() == 3 && "Invalid number of tokens");
+        class_desciptions[i] = removeQuotes(tsv.field(1));
     }
 }
 
@@ -476,12 +444,13 @@ void Localization::InitializeAttributeNames() {
     this->attribute_names[ATTRIBUTE_SPEED]        = this->localization_strings[LSTR_SPEED];
     this->attribute_names[ATTRIBUTE_LUCK]         = this->localization_strings[LSTR_LUCK];
 
-    this->attribute_desc_raw = engine->_gameResourceManager->getEventsFile("stats.txt").string_view();
-    strtok(this->attribute_desc_raw.data(), "\r");
+    Blob statsTxt = engine->_gameResourceManager->getEventsFile("stats.txt");
+    TsvReader tsv(statsTxt);
+    tsv.skipLines(1);
     for (int i = 0; i < 26; ++i) {
-        char *test_string = strtok(NULL, "\r") + 1;
-        std::vector<std::string_view> tokens = split(test_string, '\t');
-        assert(tokens.size() == 2 && "Invalid number of tokens");
+        tsv.readLine();
+        assert(tsv.fieldCount() == 2 && "Invalid number of tokens");
+        std::string_view description = removeQuotes(tsv.field(1));
         switch (i) {
             case 0:
             case 1:
@@ -490,64 +459,64 @@ void Localization::InitializeAttributeNames() {
             case 4:
             case 5:
             case 6:
-                this->attribute_descriptions[static_cast<Attribute>(i)] = removeQuotes(tokens[1]);
+                this->attribute_descriptions[static_cast<Attribute>(i)] = description;
                 break;
             case 7:
-                this->hp_description = removeQuotes(tokens[1]);
+                this->hp_description = description;
                 break;
             case 8:
-                this->armour_class_description = removeQuotes(tokens[1]);
+                this->armour_class_description = description;
                 break;
             case 9:
-                this->sp_description = removeQuotes(tokens[1]);
+                this->sp_description = description;
                 break;
             case 10:
-                this->character_condition_description = removeQuotes(tokens[1]);
+                this->character_condition_description = description;
                 break;
             case 11:
-                this->fast_spell_description = removeQuotes(tokens[1]);
+                this->fast_spell_description = description;
                 break;
             case 12:
-                this->age_description = removeQuotes(tokens[1]);
+                this->age_description = description;
                 break;
             case 13:
-                this->level_description = removeQuotes(tokens[1]);
+                this->level_description = description;
                 break;
             case 14:
-                this->exp_description = removeQuotes(tokens[1]);
+                this->exp_description = description;
                 break;
             case 15:
-                this->melee_attack_description = removeQuotes(tokens[1]);
+                this->melee_attack_description = description;
                 break;
             case 16:
-                this->melee_damage_description = removeQuotes(tokens[1]);
+                this->melee_damage_description = description;
                 break;
             case 17:
-                this->ranged_attack_description = removeQuotes(tokens[1]);
+                this->ranged_attack_description = description;
                 break;
             case 18:
-                this->ranged_damage_description = removeQuotes(tokens[1]);
+                this->ranged_damage_description = description;
                 break;
             case 19:
-                this->fire_res_description = removeQuotes(tokens[1]);
+                this->fire_res_description = description;
                 break;
             case 20:
-                this->air_res_description = removeQuotes(tokens[1]);
+                this->air_res_description = description;
                 break;
             case 21:
-                this->water_res_description = removeQuotes(tokens[1]);
+                this->water_res_description = description;
                 break;
             case 22:
-                this->earth_res_description = removeQuotes(tokens[1]);
+                this->earth_res_description = description;
                 break;
             case 23:
-                this->mind_res_description = removeQuotes(tokens[1]);
+                this->mind_res_description = description;
                 break;
             case 24:
-                this->body_res_description = removeQuotes(tokens[1]);
+                this->body_res_description = description;
                 break;
             case 25:
-                this->skill_points_description = removeQuotes(tokens[1]);
+                this->skill_points_description = description;
                 break;
         }
     }
@@ -245,11 +245,7 @@ class Localization {
     void InitializeNpcProfessionNames();
 
  private:
-    std::string localization_raw;
     IndexedArray<std::string, LSTR_FIRST, LSTR_LAST> localization_strings;
-    std::string class_desc_raw;
-    std::string attribute_desc_raw;
-    std::string skill_desc_raw;
 
     std::array<std::string, 14> mm6_item_categories;
     std::array<std::string, 12> month_names;
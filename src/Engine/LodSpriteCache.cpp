@@ -1,6 +1,7 @@
 #include "LodSpriteCache.h"
 
 #include <vector>
+#include <unordered_set>
 #include <utility>
 #include <string>
 #include <memory>
@@ -9,6 +10,7 @@
 
 #include "Utility/String/Ascii.h"
 #include "Utility/MapAccess.h"
+#include "Utility/Parallel.h"
 
 #include "AssetsManager.h"
 
@@ -52,13 +54,35 @@ Sprite *LodSpriteCache::loadSprite(std::string_view pContainerName) {
     if (!LoadSpriteFromFile(header.get(), name))
         return nullptr;
 
+    return insertSprite(pContainerName, std::move(name), std::move(header));
+}
+
+void LodSpriteCache::prefetchSprites(std::span<const std::string> names) {
+    std::vector<std::string> missing;
+    std::unordered_set<std::string> seen;
+    for (const std::string &name : names) {
+        std::string lowerName = ascii::toLower(name);
+        if (!_spriteByName.contains(lowerName) && _reader.exists(lowerName) && seen.insert(lowerName).second)
+            missing.push_back(name);
+    }
+
+    std::vector<std::unique_ptr<LodSprite>> headers(missing.size());
+    parallelFor(missing.size(), [&](size_t i) {
+        headers[i] = std::make_unique<LodSprite>(lod::decodeSprite(_reader.read(missing[i])));
+    });
+
+    for (size_t i = 0; i < missing.size(); i++)
+        insertSprite(missing[i], ascii::toLower(missing[i]), std::move(headers[i]));
+}
+
+Sprite *LodSpriteCache::insertSprite(std::string_view pContainerName, std::string name, std::unique_ptr<LodSprite> header) {
     Sprite &sprite = _spriteByName[name];
     sprite.pName = pContainerName;
     sprite.uWidth = header->image.width();
     sprite.uHeight = header->image.height();
     sprite.texture = assets->getSprite(pContainerName); // TODO(captainurist): very weird dependency here.
     sprite.sprite_header = header.release();
-    _spritesInOrder.push_back(name);
+    _spritesInOrder.push_back(std::move(name));
     return &sprite;
 }
 
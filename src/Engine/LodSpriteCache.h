@@ -1,5 +1,6 @@
 #pragma once
 
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -25,8 +26,18 @@ class LodSpriteCache {
 
     Sprite *loadSprite(std::string_view pContainerName);
 
+    /**
+     * Decodes the provided sprites on a set of worker threads and puts them into the cache, so that subsequent
+     * `loadSprite` calls for these sprites don't have to hit the LOD. Sprites that are already in the cache or don't
+     * exist in the LOD are skipped.
+     *
+     * @param names                     Names of the sprites to prefetch.
+     */
+    void prefetchSprites(std::span<const std::string> names);
+
  private:
     bool LoadSpriteFromFile(LodSprite *pSprite, std::string_view pContainer);
+    Sprite *insertSprite(std::string_view pContainerName, std::string name, std::unique_ptr<LodSprite> header);
 
  private:
     LodReader _reader;
@@ -1,12 +1,15 @@
 #include "LodTextureCache.h"
 
+#include <unordered_set>
 #include <utility>
 #include <string>
+#include <vector>
 
 #include "Library/LodFormats/LodFormats.h"
 
 #include "Utility/String/Ascii.h"
 #include "Utility/MapAccess.h"
+#include "Utility/Parallel.h"
 
 LodTextureCache *pIcons_LOD = nullptr;
 LodTextureCache *pIcons_LOD_mm6 = nullptr;
@@ -56,6 +59,26 @@ LodImage *LodTextureCache::loadTexture(std::string_view pContainer, bool useDumm
     }
 }
 
+void LodTextureCache::prefetchTextures(std::span<const std::string> names) {
+    std::vector<std::string> missing;
+    std::unordered_set<std::string> seen;
+    for (const std::string &name : names) {
+        std::string lowerName = ascii::toLower(name);
+        if (!_textureByName.contains(lowerName) && _reader.exists(lowerName) && seen.insert(lowerName).second)
+            missing.push_back(std::move(lowerName));
+    }
+
+    std::vector<LodImage> textures(missing.size());
+    parallelFor(missing.size(), [&](size_t i) {
+        textures[i] = lod::decodeImage(_reader.read(missing[i]));
+    });
+
+    for (size_t i = 0; i < missing.size(); i++) {
+        _textureByName.emplace(missing[i], std::move(textures[i]));
+        _texturesInOrder.push_back(std::move(missing[i]));
+    }
+}
+
 Blob LodTextureCache::LoadCompressedTexture(std::string_view pContainer) {
     return lod::decodeCompressed(_reader.read(pContainer));
 }
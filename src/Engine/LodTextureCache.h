@@ -2,6 +2,7 @@
 
 #include <string>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -24,9 +25,22 @@ class LodTextureCache {
 
     LodImage *loadTexture(std::string_view pContainer, bool useDummyOnError = true);
 
+    /**
+     * Decodes the provided textures on a set of worker threads and puts them into the cache, so that subsequent
+     * `loadTexture` calls for these textures don't have to hit the LOD. Textures that are already in the cache or
+     * don't exist in the LOD are skipped.
+     *
+     * @param names                     Names of the textures to prefetch.
+     */
+    void prefetchTextures(std::span<const std::string> names);
+
     Blob LoadCompressedTexture(std::string_view pContainer); // TODO(captainurist): doesn't belong here.
     Blob read(std::string_view pContainer); // TODO(captainurist): doesn't belong here.
 
+    const LodReader &reader() const {
+        return _reader;
+    }
+
  private:
     bool LoadTextureFromLOD(LodImage *pOutTex, std::string_view pContainer);
 
@@ -1,9 +1,11 @@
 #include "MapInfo.h"
 
-#include <cstdlib>
-#include <cstring>
-#include <sstream>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <utility>
+
+#include "Library/Tsv/TsvReader.h"
 
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Ascii.h"
@@ -40,155 +42,112 @@ const char *location_type[] = {
     "PSYCHOTIC"
 };
 
-void MapStats::Initialize(const Blob &mapStats) {
-    std::string pMapStatsTXT(mapStats.string_view());
-    std::stringstream stream(pMapStatsTXT);
-    std::string tmpString;
-    std::getline(stream, tmpString);
-    std::getline(stream, tmpString);
-    std::getline(stream, tmpString);
+/**
+ * Parses encounter monster count, either a single number, or a range like `2-5`.
+ */
+static void parseEncounterCount(std::string_view field, uint8_t *minCount, uint8_t *maxCount) {
+    *minCount = 1;
+    *maxCount = 1;
+    if (field.empty())
+        return;
+
+    size_t separator = field.find('-');
+    *minCount = TsvReader::toInt(field.substr(0, separator));
+    if (separator != std::string_view::npos) {
+        *maxCount = TsvReader::toInt(field.substr(separator + 1));
+    } else {
+        *maxCount = *minCount;
+    }
+}
 
-    char work_str[32];
-    int work_str_pos;
-    int work_str_len;
+void MapStats::Initialize(const Blob &mapStats) {
+    TsvReader tsv(mapStats);
+    tsv.skipLines(3);
 
     MapId i = MAP_FIRST;
-    while (!stream.eof()) {
-        std::getline(stream, tmpString);
-        std::stringstream line(tmpString);
-        size_t decode_step = 0;
-        while (!line.eof()) {
-            std::getline(line, tmpString, '\t');
-            char test_string[1024];
-            strncpy(test_string, tmpString.c_str(), sizeof(test_string) - 1);
-            switch (decode_step) {
+    while (tsv.tryReadLine()) {
+        for (size_t column = 0; column < tsv.fieldCount(); column++) {
+            std::string_view field = tsv.field(column);
+            switch (column) {
                 case 1:
-                    pInfos[i].name = removeQuotes(test_string);  // randoms crashes here  // got 1 too
+                    pInfos[i].name = removeQuotes(field);  // randoms crashes here  // got 1 too
                     break;
                 case 2:
-                    pInfos[i].fileName = ascii::toLower(removeQuotes(test_string));
+                    pInfos[i].fileName = ascii::toLower(removeQuotes(field));
                     break;
                 case 3:
-                    pInfos[i].numResets = atoi(test_string);
+                    pInfos[i].numResets = TsvReader::toInt(field);
                     break;
                 case 4:
-                    pInfos[i].firstVisitedAt = atoi(test_string);
+                    pInfos[i].firstVisitedAt = TsvReader::toInt(field);
                     break;
                 case 5:
-                    pInfos[i].perceptionDifficulty = atoi(test_string);
+                    pInfos[i].perceptionDifficulty = TsvReader::toInt(field);
                     break;
                 case 6:
-                    pInfos[i].respawnIntervalDays = atoi(test_string);
+                    pInfos[i].respawnIntervalDays = TsvReader::toInt(field);
                     break;
                 case 7:
-                    pInfos[i].alertDays = atoi(test_string);
+                    pInfos[i].alertDays = TsvReader::toInt(field);
                     break;
                 case 8:
-                    pInfos[i].baseStealingFine = atoi(test_string);
+                    pInfos[i].baseStealingFine = TsvReader::toInt(field);
                     break;
                 case 9:
-                    pInfos[i].disarmDifficulty = atoi(test_string);
+                    pInfos[i].disarmDifficulty = TsvReader::toInt(field);
                     break;
                 case 10:
-                    pInfos[i].trapDamageD20DiceCount = atoi(test_string);
+                    pInfos[i].trapDamageD20DiceCount = TsvReader::toInt(field);
                     break;
                 case 11:
-                    pInfos[i].mapTreasureLevel = static_cast<MapTreasureLevel>(atoi(test_string));  // treasure levels 0-6
+                    pInfos[i].mapTreasureLevel = static_cast<MapTreasureLevel>(TsvReader::toInt(field));  // treasure levels 0-6
                     break;
                 case 12:
-                    pInfos[i].encounterChance = atoi(test_string);
+                    pInfos[i].encounterChance = TsvReader::toInt(field);
                     break;
                 case 13:
-                    pInfos[i].encounter1Chance = atoi(test_string);
+                    pInfos[i].encounter1Chance = TsvReader::toInt(field);
                     break;
                 case 14:
-                    pInfos[i].encounter2Chance = atoi(test_string);
+                    pInfos[i].encounter2Chance = TsvReader::toInt(field);
                     break;
                 case 15:
-                    pInfos[i].encounter3Chance = atoi(test_string);
+                    pInfos[i].encounter3Chance = TsvReader::toInt(field);
                     break;
                 case 16:
-                    pInfos[i].encounter1MonsterTexture = removeQuotes(test_string);
+                    pInfos[i].encounter1MonsterTexture = removeQuotes(field);
                     break;
                 case 18:
-                    pInfos[i].Dif_M1 = atoi(test_string);
+                    pInfos[i].Dif_M1 = TsvReader::toInt(field);
                     break;
                 case 19:
-                    pInfos[i].encounter1MinCount = 1;
-                    pInfos[i].encounter1MaxCount = 1;
-                    strncpy(work_str, test_string, sizeof(work_str) - 1);
-                    work_str_pos = 0;
-                    work_str_len = strlen(work_str);
-                    if (work_str_len) {
-                        while (work_str[work_str_pos] != '-') {
-                            ++work_str_pos;
-                            if (work_str_pos >= work_str_len) break;
-                        }
-                        work_str[work_str_pos] = 0;
-                        pInfos[i].encounter1MinCount = atoi(work_str);
-                        if (work_str_pos < work_str_len)
-                            pInfos[i].encounter1MaxCount = atoi(&work_str[work_str_pos + 1]);
-                        else
-                            pInfos[i].encounter1MaxCount = pInfos[i].encounter1MinCount;
-                    }
+                    parseEncounterCount(field, &pInfos[i].encounter1MinCount, &pInfos[i].encounter1MaxCount);
                     break;
                 case 20:
-                    pInfos[i].encounter2MonsterTexture = removeQuotes(test_string);
+                    pInfos[i].encounter2MonsterTexture = removeQuotes(field);
                     break;
                 case 22:
-                    pInfos[i].Dif_M2 = atoi(test_string);
+                    pInfos[i].Dif_M2 = TsvReader::toInt(field);
                     break;
                 case 23:
-                    pInfos[i].encounter2MinCount = 1;
-                    pInfos[i].encounter2MaxCount = 1;
-                    strncpy(work_str, test_string, sizeof(work_str) - 1);
-                    work_str_pos = 0;
-                    work_str_len = strlen(work_str);
-                    if (work_str_len) {
-                        while (work_str[work_str_pos] != '-') {
-                            ++work_str_pos;
-                            if (work_str_pos >= work_str_len) break;
-                        }
-                        work_str[work_str_pos] = 0;
-                        pInfos[i].encounter2MinCount = atoi(work_str);
-                        if (work_str_pos < work_str_len)
-                            pInfos[i].encounter2MaxCount = atoi(&work_str[work_str_pos + 1]);
-                        else
-                            pInfos[i].encounter2MaxCount = pInfos[i].encounter2MinCount;
-                    }
+                    parseEncounterCount(field, &pInfos[i].encounter2MinCount, &pInfos[i].encounter2MaxCount);
                     break;
                 case 24:
-                    pInfos[i].encounter3MonsterTexture = removeQuotes(test_string);
+                    pInfos[i].encounter3MonsterTexture = removeQuotes(field);
                     break;
                 case 26:
-                    pInfos[i].Dif_M3 = atoi(test_string);
+                    pInfos[i].Dif_M3 = TsvReader::toInt(field);
                     break;
                 case 27:
-                    pInfos[i].encounter3MinCount = 1;
-                    pInfos[i].encounter3MaxCount = 1;
-                    strncpy(work_str, test_string, sizeof(work_str) - 1);
-                    work_str_pos = 0;
-                    work_str_len = strlen(work_str);
-                    if (work_str_len) {
-                        while (work_str[work_str_pos] != '-') {
-                            ++work_str_pos;
-                            if (work_str_pos >= work_str_len) break;
-                        }
-                        work_str[work_str_pos] = 0;
-                        pInfos[i].encounter3MinCount = atoi(work_str);
-                        if (work_str_pos < work_str_len)
-                            pInfos[i].encounter3MaxCount = atoi(&work_str[work_str_pos + 1]);
-                        else
-                            pInfos[i].encounter3MaxCount = pInfos[i].encounter3MinCount;
-                    }
+                    parseEncounterCount(field, &pInfos[i].encounter3MinCount, &pInfos[i].encounter3MaxCount);
                     break;
                 case 28:
-                    pInfos[i].musicId = static_cast<MusicId>(atoi(test_string));
+                    pInfos[i].musicId = static_cast<MusicId>(TsvReader::toInt(field));
                     break;
                 case 29: {
                     pInfos[i].uEAXEnv = 0xff;
                     for (int j = 0; j < 25; j++) {
-                        if (!strcmp(test_string, location_type[j])) {
+                        if (field == location_type[j]) {
                             pInfos[i].uEAXEnv = j;
                             break;
                         }
@@ -198,7 +157,6 @@ void MapStats::Initialize(const Blob &mapStats) {
                     }
                 } break;
             }
-            decode_step++;
         }
         i = static_cast<MapId>(std::to_underlying(i) + 1);
     }
@@ -1,6 +1,8 @@
 #include "Engine/Objects/Actor.h"
 
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <deque>
 #include <string>
 #include <utility>
@@ -14,11 +16,13 @@
 #include "Engine/Graphics/DecalBuilder.h"
 #include "Engine/Objects/Decoration.h"
 #include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/LineOfSightCache.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Graphics/Overlays.h"
 #include "Engine/Graphics/Sprites.h"
 #include "Engine/Graphics/Vis.h"
 #include "Engine/Localization.h"
+#include "Engine/Objects/ObjectGrid.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
@@ -2052,7 +2056,7 @@ void Actor::AI_Pursue3(unsigned int uActorID, Pid a2,
 
 //----- (00401221) --------------------------------------------------------
 void Actor::_SelectTarget(unsigned int uActorID, Pid *OutTargetPID,
-                          bool can_target_party) {
+                          bool can_target_party, ObjectGrid *actorGrid) {
     int v5;                     // ecx@1
     MonsterHostility v10;             // eax@13
     unsigned v11;                   // ebx@16
@@ -2075,24 +2079,29 @@ void Actor::_SelectTarget(unsigned int uActorID, Pid *OutTargetPID,
     assert(uActorID < pActors.size());
     Actor *thisActor = &pActors[uActorID];
 
-    for (unsigned i = 0; i < pActors.size(); ++i) {
+    auto isTargetable = [&](unsigned i) {
+        const Actor *actor = &pActors[i];
+        return !(actor->aiState == Dead || actor->aiState == Dying ||
+                 actor->aiState == Removed || actor->aiState == Summoned ||
+                 actor->aiState == Disabled || uActorID == i);
+    };
+
+    auto checkTarget = [&](unsigned i) {
         Actor *actor = &pActors[i];
-        if (actor->aiState == Dead || actor->aiState == Dying ||
-            actor->aiState == Removed || actor->aiState == Summoned ||
-            actor->aiState == Disabled || uActorID == i)
-            continue;
+        if (!isTargetable(i))
+            return;
 
         if (!thisActor->lastCharacterIdToHit || Pid(OBJECT_Actor, v5) != thisActor->lastCharacterIdToHit) {
             v10 = thisActor->GetActorsRelation(actor);
-            if (v10 == HOSTILITY_FRIENDLY) continue;
+            if (v10 == HOSTILITY_FRIENDLY) return;
         } else if (thisActor->IsNotAlive()) {
             thisActor->lastCharacterIdToHit = Pid();
             v10 = thisActor->GetActorsRelation(actor);
-            if (v10 == HOSTILITY_FRIENDLY) continue;
+            if (v10 == HOSTILITY_FRIENDLY) return;
         } else {
             if ((actor->group != 0 || thisActor->group != 0) &&
                 actor->group == thisActor->group)
-                continue;
+                return;
             v10 = HOSTILITY_LONG;
         }
         if (thisActor->monsterInfo.hostilityType != HOSTILITY_FRIENDLY)
@@ -2109,6 +2118,34 @@ void Actor::_SelectTarget(unsigned int uActorID, Pid *OutTargetPID,
             lowestRadius = v23 * v23 + v27 * v27 + v12 * v12;
             closestId = i;
         }
+    };
+
+    if (!actorGrid) {
+        for (unsigned i = 0; i < pActors.size(); ++i)
+            checkTarget(i);
+    } else {
+        // The loop above resets lastCharacterIdToHit when checking the first targetable actor. Do the same here, even
+        // if that actor is too far away to end up in the grid query.
+        if (thisActor->lastCharacterIdToHit && Pid(OBJECT_Actor, v5) == thisActor->lastCharacterIdToHit && thisActor->IsNotAlive()) {
+            for (unsigned i = 0; i < pActors.size(); ++i) {
+                if (isTargetable(i)) {
+                    thisActor->lastCharacterIdToHit = Pid();
+                    break;
+                }
+            }
+        }
+
+        // Actors that are further away than the hostility range are skipped by checkTarget, so we can only look at
+        // the nearby ones. Note that the distances are truncated to integers, hence the +1.
+        int range = _4DF380_hostilityRanges[HOSTILITY_LONG];
+        if (thisActor->monsterInfo.hostilityType != HOSTILITY_FRIENDLY)
+            range = _4DF380_hostilityRanges[pMonsterStats->infos[thisActor->monsterInfo.id].hostilityType];
+        for (int i : actorGrid->query(BBoxf::cubic(thisActor->pos, range + 1)))
+            checkTarget(i);
+
+        // Actors spawned after the grid was built.
+        for (unsigned i = actorGrid->size(); i < pActors.size(); ++i)
+            checkTarget(i);
     }
 
     if (lowestRadius != UINT_MAX) {
@@ -2566,6 +2603,14 @@ void Actor::UpdateActorAI() {
         pActor->UpdateAnimation();
     }
 
+    // Actors don't move inside the loop below, so we can build the target selection grid once.
+    static std::vector<Vec3f> actorPositions;
+    static ObjectGrid actorGrid;
+    actorPositions.clear();
+    for (const Actor &actor : pActors)
+        actorPositions.push_back(actor.pos);
+    actorGrid.build(actorPositions);
+
     // loops over for the actors in "full" ai state
     for (int v78 = 0; v78 < ai_arrays_size; ++v78) {
         unsigned actor_id = ai_near_actors_ids[v78];
@@ -2576,7 +2621,7 @@ void Actor::UpdateActorAI() {
 
         v47 = pActor->monsterInfo.recoveryTime * flt_debugrecmod3;
 
-        Actor::_SelectTarget(actor_id, &ai_near_actors_targets_pid[actor_id], true);
+        Actor::_SelectTarget(actor_id, &ai_near_actors_targets_pid[actor_id], true, &actorGrid);
 
         if (pActor->monsterInfo.hostilityType != HOSTILITY_FRIENDLY && !ai_near_actors_targets_pid[actor_id])
             pActor->monsterInfo.hostilityType = HOSTILITY_FRIENDLY;
@@ -3862,9 +3907,67 @@ void toggleActorGroupFlag(unsigned int uGroupID, ActorAttribute uFlag,
     }
 }
 
+namespace {
+
+struct ActorDistance {
+    int id;
+    int distance;
+
+    // Ties are broken by id. Actors are collected in id order, so this is the same order as std::stable_sort by
+    // distance would produce.
+    friend bool operator<(const ActorDistance &l, const ActorDistance &r) {
+        return l.distance < r.distance || (l.distance == r.distance && l.id < r.id);
+    }
+};
+
+/**
+ * Distances to the actors that are in range, sorted lazily. Reused between frames to avoid allocations.
+ */
+class ActorDistanceList {
+ public:
+    void clear() {
+        _distances.clear();
+        _sortedCount = 0;
+    }
+
+    void add(ActorDistance distance) {
+        assert(_sortedCount == 0);
+        _distances.push_back(distance);
+    }
+
+    [[nodiscard]] size_t size() const {
+        return _distances.size();
+    }
+
+    /**
+     * Makes sure that the first `count` elements are the nearest actors, in sorted order. Rest of the list is left in
+     * an unspecified order.
+     */
+    void sortPrefix(size_t count) {
+        if (count <= _sortedCount)
+            return;
+
+        // Sort at least twice as much as we already have, so that element-by-element iteration stays O(n log n).
+        count = std::min(_distances.size(), std::max(count, 2 * _sortedCount));
+        std::partial_sort(_distances.begin() + _sortedCount, _distances.begin() + count, _distances.end());
+        _sortedCount = count;
+    }
+
+    [[nodiscard]] const ActorDistance &operator[](size_t index) const {
+        return _distances[index];
+    }
+
+ private:
+    std::vector<ActorDistance> _distances;
+    size_t _sortedCount = 0;
+};
+
+} // namespace
+
 //----- (004014E6) --------------------------------------------------------
 void Actor::MakeActorAIList_ODM() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
+    static ActorDistanceList activeActorsDistances;
+    activeActorsDistances.clear();
 
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
 
@@ -3893,30 +3996,35 @@ void Actor::MakeActorAIList_ODM() {
                     pParty->SetRedAlert();
             }
             actor.attributes |= ACTOR_ACTIVE;
-            activeActorsDistances.push_back({actor.id, distance});
+            activeActorsDistances.add({actor.id, distance});
         } else {
             actor.ResetActive();
         }
     }
 
-    // sort active actors by distance
-    // use stable_sort to make tests work across all platforms
-    std::stable_sort(activeActorsDistances.begin(), activeActorsDistances.end(), [] (std::pair<int, int> a, std::pair<int, int> b) { return a.second < b.second; });
-
-    // and takes nearest amount
+    // take nearest amount, only these need to be sorted
     int configLimit = engine->config->gameplay.MaxActiveAIActors.value();
-    for (int i = 0; (i < configLimit) && (i < activeActorsDistances.size()); i++) {
-        ai_near_actors_ids[i] = activeActorsDistances[i].first;
+    ai_arrays_size = std::min(configLimit, (int)activeActorsDistances.size());
+    activeActorsDistances.sortPrefix(ai_arrays_size);
+    for (int i = 0; i < ai_arrays_size; i++) {
+        ai_near_actors_ids[i] = activeActorsDistances[i].id;
         pActors[ai_near_actors_ids[i]].attributes |= ACTOR_FULL_AI_STATE;
     }
-
-    ai_arrays_size = std::min(configLimit, (int)activeActorsDistances.size());
 }
 
 //----- (004016FA) --------------------------------------------------------
 int Actor::MakeActorAIList_BLV() {
-    std::vector<std::pair<int, int>> activeActorsDistances; // pair<id, distance>
-    std::vector<int> pickedActorIds;
+    static ActorDistanceList activeActorsDistances;
+    static std::vector<int> pickedActorIds;
+    static std::vector<bool> pickedActorMask; // Same as pickedActorIds, but indexed by actor id.
+    activeActorsDistances.clear();
+    pickedActorIds.clear();
+    pickedActorMask.assign(pActors.size(), false);
+
+    auto pickActor = [&](int actorId) {
+        pickedActorIds.push_back(actorId);
+        pickedActorMask[actorId] = true;
+    };
 
     // reset party alert level
     pParty->uFlags &= ~PARTY_FLAG_ALERT_RED_OR_YELLOW;
@@ -3947,22 +4055,20 @@ int Actor::MakeActorAIList_BLV() {
                 if (!(pParty->GetYellowAlert()) && distance < 5120)
                     pParty->SetYellowAlert();
             }
-            activeActorsDistances.push_back({actor.id, distance});
+            activeActorsDistances.add({actor.id, distance});
         } else {
             // otherwise idle
             actor.ResetActive();
         }
     }
 
-    // sort active actors by distance
-    // use stable_sort to make tests work across all platforms
-    std::stable_sort(activeActorsDistances.begin(), activeActorsDistances.end(), [] (std::pair<int, int> a, std::pair<int, int> b) { return a.second < b.second; });
-
     // checks nearby actors can detect player and take nearest 30
-    for (const auto &[actorId, _] : activeActorsDistances) {
+    for (size_t i = 0; i < activeActorsDistances.size(); i++) {
+        activeActorsDistances.sortPrefix(i + 1);
+        int actorId = activeActorsDistances[i].id;
         if (pActors[actorId].ActorNearby() || Detect_Between_Objects(Pid(OBJECT_Actor, actorId), Pid(OBJECT_Character, 0))) {
             pActors[actorId].attributes |= ACTOR_NEARBY;
-            pickedActorIds.push_back(actorId);
+            pickActor(actorId);
             if (pickedActorIds.size() >= 30) {
                 break;
             }
@@ -3971,28 +4077,26 @@ int Actor::MakeActorAIList_BLV() {
 
     // add any actors than can act and are in the same sector
     for (int i = 0; i < pActors.size(); ++i) {
-        if (pActors[i].CanAct() && pActors[i].sectorId == pBLVRenderParams->uPartySectorID) {
-            auto found = std::find_if(pickedActorIds.begin(), pickedActorIds.end(), [&] (int id) { return id == i; });
-            if (found == pickedActorIds.end()) {
-                pActors[i].attributes |= ACTOR_ACTIVE;
-                pickedActorIds.push_back(i);
-            }
+        if (pActors[i].CanAct() && pActors[i].sectorId == pBLVRenderParams->uPartySectorID && !pickedActorMask[i]) {
+            pActors[i].attributes |= ACTOR_ACTIVE;
+            pickActor(i);
         }
     }
 
     // add any actors that are active and have previosuly detected the player
-    for (const auto &[actorId, _] : activeActorsDistances) {
-        if (pActors[actorId].attributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[actorId].CanAct()) {
-            auto found = std::find_if(pickedActorIds.begin(), pickedActorIds.end(), [&actorId = actorId] (int id) { return id == actorId; });
-            if (found == pickedActorIds.end()) {
-                pActors[actorId].attributes |= ACTOR_ACTIVE;
-                pickedActorIds.push_back(actorId);
-            }
+    // only the first configLimit picked actors are used, so past that point the order doesn't matter
+    int configLimit = engine->config->gameplay.MaxActiveAIActors.value();
+    for (size_t i = 0; i < activeActorsDistances.size(); i++) {
+        if (pickedActorIds.size() < configLimit)
+            activeActorsDistances.sortPrefix(i + 1);
+        int actorId = activeActorsDistances[i].id;
+        if (pActors[actorId].attributes & (ACTOR_ACTIVE | ACTOR_NEARBY) && pActors[actorId].CanAct() && !pickedActorMask[actorId]) {
+            pActors[actorId].attributes |= ACTOR_ACTIVE;
+            pickActor(actorId);
         }
     }
 
     // activate ai state for first x actors from list
-    int configLimit = engine->config->gameplay.MaxActiveAIActors.value();
     for (int i = 0; (i < configLimit) && (i < pickedActorIds.size()); i++) {
         ai_near_actors_ids[i] = pickedActorIds[i];
         pActors[pickedActorIds[i]].attributes |= ACTOR_FULL_AI_STATE;
@@ -4003,69 +4107,14 @@ int Actor::MakeActorAIList_BLV() {
     return ai_arrays_size;
 }
 
-//----- (004070EF) --------------------------------------------------------
-bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
-    // get object 1 info
-    int obj1_pid = uObjID.id();
-    int obj1_sector;
-    Vec3f pos1;
-
-    switch (uObjID.type()) {
-        case OBJECT_Decoration:
-            pos1 = pLevelDecorations[obj1_pid].vPosition;
-            obj1_sector = pIndoor->GetSector(pos1);
-            break;
-        case OBJECT_Actor:
-            pos1 = pActors[obj1_pid].pos + Vec3f(0, 0, pActors[obj1_pid].height * 0.69999999);
-            obj1_sector = pActors[obj1_pid].sectorId;
-            break;
-        case OBJECT_Sprite:
-            pos1 = pSpriteObjects[obj1_pid].vPosition;
-            obj1_sector = pSpriteObjects[obj1_pid].uSectorID;
-            break;
-        default:
-            return 0;
-    }
-
-    // get object 2 info
-    int obj2_pid = uObj2ID.id();
-    int obj2_sector;
-    Vec3f pos2;
-
-    switch (uObj2ID.type()) {
-        case OBJECT_Decoration:
-            pos2 = pLevelDecorations[obj2_pid].vPosition;
-            obj2_sector = pIndoor->GetSector(pos2);
-            break;
-        case OBJECT_Character:
-            pos2 = pParty->pos + Vec3f(0, 0, pParty->eyeLevel);
-            obj2_sector = pBLVRenderParams->uPartyEyeSectorID;
-            break;
-        case OBJECT_Actor:
-            pos2 = pActors[obj2_pid].pos + Vec3f(0, 0, pActors[obj2_pid].height * 0.69999999);
-            obj2_sector = pActors[obj2_pid].sectorId;
-            break;
-        case OBJECT_Sprite:
-            pos2 = pSpriteObjects[obj2_pid].vPosition;
-            obj2_sector = pSpriteObjects[obj2_pid].uSectorID;
-            break;
-        default:
-            return 0;
-    }
-
-    // get distance between objects
+/**
+ * Indoor part of `Detect_Between_Objects`, walks the portals from `obj1_sector` towards `obj2_sector`.
+ */
+static bool traceLineOfSightThroughPortals(int obj1_sector, int obj2_sector, const Vec3f &pos1, const Vec3f &pos2) {
     float dist_x = pos2.x - pos1.x;
     float dist_y = pos2.y - pos1.y;
     float dist_z = pos2.z - pos1.z;
     float dist_3d = sqrt(dist_x * dist_x + dist_y * dist_y + dist_z * dist_z);
-    // range check
-    if (dist_3d > 5120) return 0;
-
-    // if in range always detected outdoors
-    if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) return 1;
-
-    // monster in same sector with player/ monster
-    if (obj1_sector == obj2_sector) return 1;
 
     // normalising
     float rayxnorm = dist_x / dist_3d;
@@ -4161,6 +4210,80 @@ bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
     return 1;
 }
 
+//----- (004070EF) --------------------------------------------------------
+bool Detect_Between_Objects(Pid uObjID, Pid uObj2ID) {
+    // get object 1 info
+    int obj1_pid = uObjID.id();
+    int obj1_sector;
+    Vec3f pos1;
+
+    switch (uObjID.type()) {
+        case OBJECT_Decoration:
+            pos1 = pLevelDecorations[obj1_pid].vPosition;
+            obj1_sector = pIndoor->GetSector(pos1);
+            break;
+        case OBJECT_Actor:
+            pos1 = pActors[obj1_pid].pos + Vec3f(0, 0, pActors[obj1_pid].height * 0.69999999);
+            obj1_sector = pActors[obj1_pid].sectorId;
+            break;
+        case OBJECT_Sprite:
+            pos1 = pSpriteObjects[obj1_pid].vPosition;
+            obj1_sector = pSpriteObjects[obj1_pid].uSectorID;
+            break;
+        default:
+            return 0;
+    }
+
+    // get object 2 info
+    int obj2_pid = uObj2ID.id();
+    int obj2_sector;
+    Vec3f pos2;
+
+    switch (uObj2ID.type()) {
+        case OBJECT_Decoration:
+            pos2 = pLevelDecorations[obj2_pid].vPosition;
+            obj2_sector = pIndoor->GetSector(pos2);
+            break;
+        case OBJECT_Character:
+            pos2 = pParty->pos + Vec3f(0, 0, pParty->eyeLevel);
+            obj2_sector = pBLVRenderParams->uPartyEyeSectorID;
+            break;
+        case OBJECT_Actor:
+            pos2 = pActors[obj2_pid].pos + Vec3f(0, 0, pActors[obj2_pid].height * 0.69999999);
+            obj2_sector = pActors[obj2_pid].sectorId;
+            break;
+        case OBJECT_Sprite:
+            pos2 = pSpriteObjects[obj2_pid].vPosition;
+            obj2_sector = pSpriteObjects[obj2_pid].uSectorID;
+            break;
+        default:
+            return 0;
+    }
+
+    // get distance between objects
+    float dist_x = pos2.x - pos1.x;
+    float dist_y = pos2.y - pos1.y;
+    float dist_z = pos2.z - pos1.z;
+    float dist_3d = sqrt(dist_x * dist_x + dist_y * dist_y + dist_z * dist_z);
+    // range check
+    if (dist_3d > 5120) return 0;
+
+    // if in range always detected outdoors
+    if (uCurrentlyLoadedLevelType == LEVEL_OUTDOOR) return 1;
+
+    // monster in same sector with player/ monster
+    if (obj1_sector == obj2_sector) return 1;
+
+    // same positions & sectors => same result, unless doors moved in between.
+    if (std::optional<bool> cached = lineOfSightCache.find(obj1_sector, obj2_sector, pos1, pos2))
+        return *cached;
+
+    auto startTime = std::chrono::steady_clock::now();
+    bool result = traceLineOfSightThroughPortals(obj1_sector, obj2_sector, pos1, pos2);
+    lineOfSightCache.insert(obj1_sector, obj2_sector, pos1, pos2, result, std::chrono::steady_clock::now() - startTime);
+    return result;
+}
+
 //----- (0044FA4C) --------------------------------------------------------
 void Spawn_Light_Elemental(int spell_power, Mastery caster_skill_mastery, Duration duration) {
     // size_t uActorIndex;            // [sp+10h] [bp-10h]@6
@@ -4393,6 +4516,35 @@ void SpawnEncounter(MapInfo *pMapInfo, SpawnPoint *spawn, int monsterCatMod, int
 void evaluateAoeDamage() {
     SpriteObject *pSpriteObj = nullptr;
 
+    // AoE attacks only look at the actors inside the attack sphere. Actors don't move while we're dealing damage, so
+    // the grid is built once, on the first AoE attack.
+    static std::vector<Vec3f> actorPositions;
+    static ObjectGrid actorGrid;
+    float maxActorRadius = 0;
+    bool actorGridBuilt = false;
+
+    // Line of sight results for the current attack origin, indexed by actor id: -1 means not checked yet. Geometry
+    // doesn't change here either, so several attacks landing on the same spot in a frame trace each actor only once.
+    static std::vector<int8_t> actorLineOfSight;
+    static std::vector<int> checkedActorIds;
+    std::optional<Vec3f> lineOfSightOrigin;
+    auto checkActorLineOfSight = [&](int actorId, const Vec3f &from) {
+        if (lineOfSightOrigin != from) {
+            for (int id : checkedActorIds)
+                actorLineOfSight[id] = -1;
+            checkedActorIds.clear();
+            lineOfSightOrigin = from;
+        }
+        if (actorLineOfSight.size() < pActors.size())
+            actorLineOfSight.resize(pActors.size(), -1);
+
+        if (actorLineOfSight[actorId] == -1) {
+            actorLineOfSight[actorId] = Check_LineOfSight(pActors[actorId].pos + Vec3f(0, 0, 50), from);
+            checkedActorIds.push_back(actorId);
+        }
+        return actorLineOfSight[actorId] == 1;
+    };
+
     for (AttackDescription &attack : attackList) {
         ObjectType attackerType = attack.pid.type();
         int attackerId = attack.pid.id();
@@ -4460,40 +4612,61 @@ void evaluateAoeDamage() {
                 }
             }
 
-            for (int actorID = 0; actorID < pActors.size(); ++actorID) {
-                if (pActors[actorID].CanAct()) {
-                    Vec3f distanceVec = pActors[actorID].pos + Vec3f(0, 0, pActors[actorID].height / 2) - attack.pos;
-                    float distanceSq = distanceVec.lengthSqr();
-                    float attackRange = attack.attackRange + pActors[actorID].radius;
-                    float attackRangeSq = attackRange * attackRange;
-                    // TODO: using absolute Z here is BS, it's used as speed in ItemDamageFromActor
-                    Vec3f attVF = Vec3f(distanceVec.x, distanceVec.y, pActors[actorID].pos.z);
-                    attVF.normalize();
-
-                    // check range
-                    if (distanceSq < attackRangeSq) {
-                        // check line of sight
-                        if (Check_LineOfSight(pActors[actorID].pos + Vec3f(0, 0, 50), attack.pos)) {
-                            switch (attackerType) {
-                                case OBJECT_Character:
-                                    Actor::DamageMonsterFromParty(attack.pid, actorID, attVF);
-                                    break;
-                                case OBJECT_Actor:
-                                    if (pSpriteObj && pActors[attackerId].GetActorsRelation(&pActors[actorID]) != HOSTILITY_FRIENDLY) {
-                                        Actor::ActorDamageFromMonster(attack.pid, actorID, attVF, pSpriteObj->spellCasterAbility);
-                                    }
-                                    break;
-                                case OBJECT_Sprite:
-                                    ItemDamageFromActor(attack.pid, actorID, attVF);
-                                    break;
-                                default:
-                                    assert(false);
-                                    break;
-                            }
+            auto damageActor = [&](int actorID) {
+                if (!pActors[actorID].CanAct())
+                    return;
+
+                Vec3f distanceVec = pActors[actorID].pos + Vec3f(0, 0, pActors[actorID].height / 2) - attack.pos;
+                float distanceSq = distanceVec.lengthSqr();
+                float attackRange = attack.attackRange + pActors[actorID].radius;
+                float attackRangeSq = attackRange * attackRange;
+
+                // check range
+                if (!(distanceSq < attackRangeSq))
+                    return;
+
+                // check line of sight
+                if (!checkActorLineOfSight(actorID, attack.pos))
+                    return;
+
+                // TODO: using absolute Z here is BS, it's used as speed in ItemDamageFromActor
+                Vec3f attVF = Vec3f(distanceVec.x, distanceVec.y, pActors[actorID].pos.z);
+                attVF.normalize();
+
+                switch (attackerType) {
+                    case OBJECT_Character:
+                        Actor::DamageMonsterFromParty(attack.pid, actorID, attVF);
+                        break;
+                    case OBJECT_Actor:
+                        if (pSpriteObj && pActors[attackerId].GetActorsRelation(&pActors[actorID]) != HOSTILITY_FRIENDLY) {
+                            Actor::ActorDamageFromMonster(attack.pid, actorID, attVF, pSpriteObj->spellCasterAbility);
                         }
-                    }
+                        break;
+                    case OBJECT_Sprite:
+                        ItemDamageFromActor(attack.pid, actorID, attVF);
+                        break;
+                    default:
+                        assert(false);
+                        break;
                 }
+            };
+
+            if (!actorGridBuilt) {
+                actorPositions.clear();
+                for (const Actor &actor : pActors) {
+                    actorPositions.push_back(actor.pos);
+                    maxActorRadius = std::max(maxActorRadius, static_cast<float>(actor.radius));
+                }
+                actorGrid.build(actorPositions);
+                actorGridBuilt = true;
             }
+
+            // Query returns actor ids in ascending order, so damage is dealt in the same order as with a full scan.
+            // Actors spawned after the grid was built are checked separately.
+            for (int actorID : actorGrid.query(BBoxf::cubic(attack.pos, attack.attackRange + maxActorRadius + 1)))
+                damageActor(actorID);
+            for (int actorID = actorGrid.size(); actorID < pActors.size(); ++actorID)
+                damageActor(actorID);
         }
     }
     attackList.clear();
@@ -18,6 +18,7 @@
 #include "ActorEnums.h"
 
 class Actor;
+class ObjectGrid;
 class Vis;
 struct SpawnPoint;
 struct MapInfo;
@@ -85,8 +86,15 @@ class Actor {
         return attributes & ACTOR_NEARBY;
     }
 
+    /**
+     * @param uActorID                  Actor to select target for.
+     * @param[out] OutTargetPID         Selected target.
+     * @param can_target_party          Whether the party can be selected as a target.
+     * @param actorGrid                 Optional grid built from the current actor positions, used to skip the actors
+     *                                  that are out of range. Doesn't affect the result.
+     */
     static void _SelectTarget(unsigned int uActorID, Pid *OutTargetPID,
-                              bool can_target_party);
+                              bool can_target_party, ObjectGrid *actorGrid = nullptr);
     static void AI_Pursue3(unsigned int uActorID, Pid a2,
                            Duration uActionLength, AIDirection *a4);
     static void AI_Pursue2(unsigned int uActorID, Pid a2,
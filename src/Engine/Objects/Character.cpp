@@ -728,6 +728,11 @@ int Character::GetActualLuck() const {
 
 //----- (new function) --------------------------------------------------------
 int Character::GetActualStat(Attribute stat) const {
+    return characterStatsCache.get(&_cachedActualValues[stat], "GetActualStat", std::to_underlying(stat),
+                                   [&] { return calculateActualStat(stat); });
+}
+
+int Character::calculateActualStat(Attribute stat) const {
     int attrValue = _stats[stat];
     int attrBonus = _statBonuses[stat];
 
@@ -767,6 +772,11 @@ int Character::GetActualStat(Attribute stat) const {
 
 //----- (0048CCF5) --------------------------------------------------------
 int Character::GetActualAttack(bool onlyMainHandDmg) const {
+    return characterStatsCache.get(&_cachedActualAttack[onlyMainHandDmg], "GetActualAttack", onlyMainHandDmg,
+                                   [&] { return calculateActualAttack(onlyMainHandDmg); });
+}
+
+int Character::calculateActualAttack(bool onlyMainHandDmg) const {
     int parbonus = GetParameterBonus(
         GetActualAccuracy());  // bonus points for steps of accuracy level
     int atkskillbonus = GetSkillBonus(
@@ -1868,6 +1878,11 @@ int Character::GetBaseAC() const {
 
 //----- (0048E68F) --------------------------------------------------------
 int Character::GetActualAC() const {
+    return characterStatsCache.get(&_cachedActualValues[ATTRIBUTE_AC_BONUS], "GetActualAC", 0,
+                                   [&] { return calculateActualAC(); });
+}
+
+int Character::calculateActualAC() const {
     int spd = GetActualSpeed();
     int spdbonus = GetParameterBonus(spd);
     int itembonus = GetItemsBonus(ATTRIBUTE_AC_BONUS) + spdbonus;
@@ -1938,6 +1953,11 @@ int Character::GetBaseResistance(Attribute a2) const {
 
 //----- (0048E7D0) --------------------------------------------------------
 int Character::GetActualResistance(Attribute resistance) const {
+    return characterStatsCache.get(&_cachedActualValues[resistance], "GetActualResistance",
+                                   std::to_underlying(resistance), [&] { return calculateActualResistance(resistance); });
+}
+
+int Character::calculateActualResistance(Attribute resistance) const {
     signed int v10 = 0;  // [sp+14h] [bp-4h]@1
     const int16_t *resStat;
     int result;
@@ -2062,6 +2082,11 @@ int Character::GetSpecialItemBonus(ItemEnchantment enchantment) const {
 
 //----- (0048EAAE) --------------------------------------------------------
 int Character::GetItemsBonus(Attribute attr, bool getOnlyMainHandDmg /*= false*/) const {
+    return characterStatsCache.get(&_cachedItemsBonus[attr][getOnlyMainHandDmg], "GetItemsBonus",
+                                   std::to_underlying(attr), [&] { return calculateItemsBonus(attr, getOnlyMainHandDmg); });
+}
+
+int Character::calculateItemsBonus(Attribute attr, bool getOnlyMainHandDmg) const {
     int v5;                     // edi@1
     int v14;                    // ecx@58
     int v15;                    // eax@58
@@ -6493,6 +6518,7 @@ CombinedSkillValue Character::getSkillValue(Skill skill) const {
 
 void Character::setSkillValue(Skill skill, const CombinedSkillValue &value) {
     pActiveSkills[skill] = value;
+    characterStatsCache.invalidate();
 }
 
 void Character::setXP(int xp) {
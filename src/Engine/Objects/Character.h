@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -29,6 +30,7 @@
 
 #include "TalkAnimation.h"
 #include "CharacterConditions.h"
+#include "CharacterStatsCache.h"
 
 class Actor;
 class GraphicsImage;
@@ -351,6 +353,20 @@ class Character {
     char uNumDivineInterventionCastsThisDay;
     char uNumArmageddonCasts;
     char uNumFireSpikeCasts;
+
+ private:
+    int calculateActualStat(Attribute stat) const;
+    int calculateActualAttack(bool onlyMainHandDmg) const;
+    int calculateActualAC() const;
+    int calculateActualResistance(Attribute resistance) const;
+    int calculateItemsBonus(Attribute attr, bool getOnlyMainHandDmg) const;
+
+ private:
+    // Values memoized by `characterStatsCache`. Actual stats, resistances & AC share a single array indexed by
+    // attribute, items bonuses & attack are also indexed by the `onlyMainHandDmg` flag.
+    mutable IndexedArray<CachedCharacterStat, ATTRIBUTE_MIGHT, ATTRIBUTE_SKILL_LEARNING> _cachedActualValues;
+    mutable std::array<CachedCharacterStat, 2> _cachedActualAttack;
+    mutable IndexedArray<std::array<CachedCharacterStat, 2>, ATTRIBUTE_MIGHT, ATTRIBUTE_SKILL_LEARNING> _cachedItemsBonus;
 };
 
 void DamageCharacterFromMonster(Pid uObjID, ActorAbility dmgSource, signed int a4);
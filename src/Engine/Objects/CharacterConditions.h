@@ -7,6 +7,7 @@
 #include "Utility/IndexedArray.h"
 
 #include "CharacterEnums.h"
+#include "CharacterStatsCache.h"
 
 struct CharacterConditions_MM7;
 
@@ -29,15 +30,18 @@ class CharacterConditions {
 
     void reset(Condition condition) {
         _times[condition] = Time();
+        characterStatsCache.invalidate();
     }
 
     void resetAll() {
         for (Time &time : _times)
             time = Time();
+        characterStatsCache.invalidate();
     }
 
     void set(Condition condition, Time time) {
         _times[condition] = time;
+        characterStatsCache.invalidate();
     }
 
     [[nodiscard]] Time get(Condition condition) const {
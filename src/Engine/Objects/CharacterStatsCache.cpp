@@ -0,0 +1,28 @@
+#include "CharacterStatsCache.h"
+
+#include "Engine/Engine.h"
+
+#include "Library/Logger/Logger.h"
+
+CharacterStatsCache characterStatsCache;
+
+CharacterStatsCache::Scope::Scope() {
+    if (characterStatsCache._depth++ == 0)
+        characterStatsCache._verify = engine->config->debug.VerifyCharacterStatsCache.value();
+}
+
+CharacterStatsCache::Scope::~Scope() {
+    if (--characterStatsCache._depth == 0)
+        characterStatsCache.invalidate();
+}
+
+void CharacterStatsCache::resetStats() {
+    _hits = 0;
+    _misses = 0;
+    _mismatches = 0;
+}
+
+void CharacterStatsCache::reportMismatch(std::string_view name, int param, int cachedValue, int actualValue) {
+    _mismatches++;
+    logger->warning("Character stats cache mismatch in {}({}): cached {}, actual {}.", name, param, cachedValue, actualValue);
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Single memoized value of a derived character stat, see `CharacterStatsCache`.
+ */
+struct CachedCharacterStat {
+    uint64_t epoch = 0; // Epoch this value was computed in, 0 means never.
+    int value = 0;
+};
+
+/**
+ * Memoization for derived character stats, i.e. `Character::GetActualStat`, `GetActualResistance`, `GetActualAC`,
+ * `GetActualAttack` and `GetItemsBonus`. Computing these means walking conditions, the ageing table, buffs, hired NPCs
+ * and enchantments of all equipped items, and UI code calls them dozens of times per frame.
+ *
+ * Caching is only active inside a `Scope`, and these are placed around read-only UI drawing code. All cached values
+ * are dropped when the outermost scope is left, and also whenever equipment, buffs, conditions or skills change, so
+ * game logic always sees exactly what the uncached code would have returned.
+ *
+ * When `debug.verify_character_stats_cache` is set, cache hits are recomputed and mismatches are logged. Recomputed
+ * values are then returned, so the cache becomes transparent.
+ */
+class CharacterStatsCache {
+ public:
+    class Scope {
+     public:
+        Scope();
+        ~Scope();
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+    };
+
+    /**
+     * @param slot                      Cache slot for the value.
+     * @param name                      Name of the value, for logging.
+     * @param param                     Parameter of the value (e.g. attribute), for logging.
+     * @param compute                   Function that computes the value.
+     * @return                          Cached or computed value.
+     */
+    template<class Callable>
+    int get(CachedCharacterStat *slot, std::string_view name, int param, Callable &&compute) {
+        if (_depth == 0)
+            return compute();
+
+        if (slot->epoch != _epoch) {
+            _misses++;
+            slot->value = compute();
+            slot->epoch = _epoch;
+            return slot->value;
+        }
+
+        _hits++;
+        if (!_verify)
+            return slot->value;
+
+        int value = compute();
+        if (value != slot->value)
+            reportMismatch(name, param, slot->value, value);
+        return value;
+    }
+
+    /**
+     * Drops all cached values. Should be called whenever an input of a derived stat changes.
+     */
+    void invalidate() {
+        _epoch++;
+    }
+
+    void resetStats();
+
+    [[nodiscard]] bool isActive() const {
+        return _depth > 0;
+    }
+
+    [[nodiscard]] size_t hits() const {
+        return _hits;
+    }
+
+    [[nodiscard]] size_t misses() const {
+        return _misses;
+    }
+
+    [[nodiscard]] size_t mismatches() const {
+        return _mismatches;
+    }
+
+ private:
+    void reportMismatch(std::string_view name, int param, int cachedValue, int actualValue);
+
+ private:
+    uint64_t _epoch = 1;
+    int _depth = 0;
+    bool _verify = false;
+    size_t _hits = 0;
+    size_t _misses = 0;
+    size_t _mismatches = 0;
+};
+
+extern CharacterStatsCache characterStatsCache;
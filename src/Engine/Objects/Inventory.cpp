@@ -4,6 +4,7 @@
 
 #include "Engine/Snapshots/EntitySnapshots.h"
 #include "Library/Snapshots/CommonSnapshots.h"
+#include "Engine/Objects/CharacterStatsCache.h"
 #include "Engine/Tables/ChestTable.h"
 #include "Library/Logger/Logger.h"
 
@@ -144,6 +145,7 @@ Item Inventory::take(InventoryEntry entry) {
                 _grid[xy] = 0;
     } else if (entry.zone() == INVENTORY_ZONE_EQUIPMENT) {
         _equipment[entry.slot()] = 0;
+        characterStatsCache.invalidate();
     }
 
     Item result = *entry;
@@ -183,6 +185,7 @@ void Inventory::clear() {
     _records.fill(InventoryRecord());
     _grid.fill(0);
     _equipment.fill(0);
+    characterStatsCache.invalidate();
     checkInvariants();
 }
 
@@ -228,6 +231,7 @@ InventoryEntry Inventory::equipAt(ItemSlot slot, const Item &item, int index) {
     record.position = Pointi();
     record.slot = slot;
     _size++;
+    characterStatsCache.invalidate();
 
     checkInvariants();
     return InventoryEntry(this, index);
@@ -1,13 +1,15 @@
 #include "Monsters.h"
 
-#include <cstring>
+#include <algorithm>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include "Engine/Tables/FrameTableInc.h"
 
 #include "Library/Logger/Logger.h"
 #include "Library/Serialization/Serialization.h"
+#include "Library/Tsv/TsvReader.h"
 
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Ascii.h"
@@ -17,10 +19,10 @@
 MonsterStats *pMonsterStats;
 MonsterList *pMonsterList;
 
-void ParseDamage(char *damage_str, uint8_t *dice_rolls,
+void ParseDamage(std::string_view damage_str, uint8_t *dice_rolls,
                  uint8_t *dice_sides, uint8_t *dmg_bonus);
-MonsterProjectile ParseMissleAttackType(const char *missle_attack_str);
-MonsterSpecialAttack ParseSpecialAttack(const char *spec_att_str);
+MonsterProjectile ParseMissleAttackType(std::string_view missle_attack_str);
+MonsterSpecialAttack ParseSpecialAttack(std::string_view spec_att_str);
 
 //----- (004548E2) --------------------------------------------------------
 SpellId ParseSpellType(FrameTableTxtLine *tbl, int *next_token) {
@@ -146,9 +148,28 @@ CombinedSkillValue ParseSkillValue(std::string_view skillString, std::string_vie
     return CombinedSkillValue(skill, mastery);
 }
 
+static char charAt(std::string_view str, size_t index) {
+    return index < str.size() ? str[index] : '\0';
+}
+
+/**
+ * @param str                           Number to parse, can be quoted and can contain a thousands separator, e.g.
+ *                                      `"1,500"`.
+ * @return                              Parsed number.
+ */
+static int parseThousands(std::string_view str) {
+    if (str.starts_with('"'))
+        str.remove_prefix(1);
+
+    size_t pos = str.find(',');
+    if (pos == std::string_view::npos)
+        return TsvReader::toInt(str);
+    return 1000 * TsvReader::toInt(str.substr(0, pos)) + TsvReader::toInt(str.substr(pos + 1));
+}
+
 //----- (00454CB4) --------------------------------------------------------
-static DamageType ParseAttackType(const char *damage_type_str) {
-    switch (tolower(*damage_type_str)) {
+static DamageType ParseAttackType(std::string_view damage_type_str) {
+    switch (tolower(charAt(damage_type_str, 0))) {
         case 'f':
             return DAMAGE_FIRE;  // fire
         case 'a':
@@ -174,39 +195,34 @@ static DamageType ParseAttackType(const char *damage_type_str) {
 }
 
 //----- (00454D7D) --------------------------------------------------------
-void ParseDamage(char *damage_str, uint8_t *dice_rolls,
+void ParseDamage(std::string_view damage_str, uint8_t *dice_rolls,
                  uint8_t *dice_sides, uint8_t *dmg_bonus) {
-    int str_len = 0;
-    int str_pos = 0;
     bool dice_flag = false;
 
     *dice_rolls = 0;
     *dice_sides = 1;
     *dmg_bonus = 0;
 
-    str_len = strlen(damage_str);
-    if (str_len <= 0) return;
-    for (str_pos = 0; str_pos < str_len; ++str_pos) {
+    if (damage_str.empty()) return;
+    for (size_t str_pos = 0; str_pos < damage_str.size(); ++str_pos) {
         if (tolower(damage_str[str_pos]) == 'd') {
-            damage_str[str_pos] = '\0';
-            *dice_rolls = atoi(damage_str);
-            *dice_sides = atoi(&damage_str[str_pos + 1]);
+            *dice_rolls = TsvReader::toInt(damage_str.substr(0, str_pos));
+            *dice_sides = TsvReader::toInt(damage_str.substr(str_pos + 1));
             dice_flag = true;
-            damage_str[str_pos] = 'd';
-        } else if (tolower(damage_str[str_pos]) == '+') {
-            *dmg_bonus = atoi(&damage_str[str_pos + 1]);
+        } else if (damage_str[str_pos] == '+') {
+            *dmg_bonus = TsvReader::toInt(damage_str.substr(str_pos + 1));
         }
     }
     if (!dice_flag) {
-        if ((*damage_str >= '0') && (*damage_str <= '9')) {
-            *dice_rolls = atoi(damage_str);
+        if ((damage_str[0] >= '0') && (damage_str[0] <= '9')) {
+            *dice_rolls = TsvReader::toInt(damage_str);
             *dice_sides = 1;
         }
     }
 }
 
 //----- (00454E3A) --------------------------------------------------------
-MonsterProjectile ParseMissleAttackType(const char *missle_attack_str) {
+MonsterProjectile ParseMissleAttackType(std::string_view missle_attack_str) {
     // TODO(captainurist): this is broken, we get "FireAr" for flaming arrow here.
 
     if (ascii::noCaseEquals(missle_attack_str, "ARROW"))
@@ -237,7 +253,7 @@ MonsterProjectile ParseMissleAttackType(const char *missle_attack_str) {
         return MONSTER_PROJECTILE_NONE;
 }
 
-MonsterSpecialAttack ParseSpecialAttack(char *spec_att_str) {
+MonsterSpecialAttack ParseSpecialAttack(std::string_view spec_att_str) {
     std::string tmp = ascii::toLower(spec_att_str);
 
     if (tmp.starts_with("curse"))
@@ -305,669 +321,555 @@ MonsterId MonsterStats::FindMonsterByTextureName(std::string_view monster_textr_
 
 //----- (00454F4E) --------------------------------------------------------
 void MonsterStats::InitializePlacements(const Blob &placements) {
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-    //  int item_counter;
-
-    std::string txtRaw(placements.string_view());
-    strtok(txtRaw.data(), "\r");
-    for (i = 1; i < 31; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if (decode_step == 1)
-                    uniqueNames[i] = removeQuotes(test_string);
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 3) && !break_loop);
+    TsvReader tsv(placements);
+    tsv.skipLines(1);
+    for (int i = 1; i < 31; ++i) {
+        tsv.readLine();
+        if (tsv.leadingFieldCount(2) > 1)
+            uniqueNames[i] = removeQuotes(tsv.field(1));
     }
 }
 
 //----- (0045501E) --------------------------------------------------------
 void MonsterStats::Initialize(const Blob &monsters) {
-    int i;  // ,j;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-    //    int item_counter;
-    MonsterId curr_rec_num;
+    MonsterId curr_rec_num = MONSTER_INVALID;
     char parse_str[64];
-    // char Src[120];
     FrameTableTxtLine parsed_field;
     std::string str;
 
-    std::string txtRaw(monsters.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-    curr_rec_num = MONSTER_INVALID;
-    for (i = 0; i < 264; ++i) { // TODO(captainurist): get rid of magic numbers in txt deserialization.
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                switch (decode_step) {
-                    case 0:
-                        curr_rec_num = static_cast<MonsterId>(atoi(test_string));
-                        infos[curr_rec_num].id = curr_rec_num;
-                        break;
-                    case 1:
-                        infos[curr_rec_num].name = removeQuotes(test_string);
-                        break;
-                    case 2:
-                        infos[curr_rec_num].textureName = removeQuotes(test_string);
-                        break;
-                    case 3:
-                        infos[curr_rec_num].level = atoi(test_string);
-                        break;
-                    case 4: {
-                        int str_len = 0;
-                        int str_pos = 0;
-                        infos[curr_rec_num].hp = 0;
-                        if (test_string[0] == '"') test_string[0] = ' ';
-                        str_len = strlen(test_string);
-                        if (str_len == 0) break;
-                        while ((test_string[str_pos] != ',') &&
-                               (str_pos < str_len))
-                            ++str_pos;
-                        if (str_len == str_pos) {
-                            infos[curr_rec_num].hp = atoi(test_string);
-                        } else {
-                            test_string[str_pos] = '\0';
-                            infos[curr_rec_num].hp = 1000 * atoi(test_string);
-                            infos[curr_rec_num].hp +=
-                                atoi(&test_string[str_pos + 1]);
-                            test_string[str_pos] = ',';
-                        }
-                    } break;
-                    case 5:
-                        infos[curr_rec_num].ac = atoi(test_string);
-                        break;
-                    case 6: {
-                        int str_len = 0;
-                        int str_pos = 0;
-                        infos[curr_rec_num].exp = 0;
-                        if (test_string[0] == '"') test_string[0] = ' ';
-                        str_len = strlen(test_string);
-                        if (str_len == 0) break;
-                        while ((test_string[str_pos] != ',') &&
-                               (str_pos < str_len))
-                            ++str_pos;
-                        if (str_len == str_pos) {
-                            infos[curr_rec_num].exp = atoi(test_string);
-                        } else {
-                            test_string[str_pos] = '\0';
-                            infos[curr_rec_num].exp =
-                                1000 * atoi(test_string);
-                            infos[curr_rec_num].exp +=
-                                atoi(&test_string[str_pos + 1]);
-                            test_string[str_pos] = ',';
+    TsvReader tsv(monsters);
+
+    // Subfields are parsed from a copy with the surrounding quotes blanked out.
+    auto parseSubfields = [&](size_t column, std::string_view field) {
+        if (field.size() >= sizeof(parse_str))
+            tsv.throwError(column, "field is too long, expected at most {} characters", sizeof(parse_str) - 1);
+        field.copy(parse_str, field.size());
+        parse_str[field.size()] = '\0';
+        parse_str[0] = ' ';
+        parse_str[field.size() - 1] = ' ';
+        frame_table_txt_parser(parse_str, &parsed_field);
+    };
+
+    tsv.skipLines(4);
+    for (int i = 0; i < 264; ++i) { // TODO(captainurist): get rid of magic numbers in txt deserialization.
+        tsv.readLine();
+        for (size_t column = 0, count = tsv.leadingFieldCount(39); column < count; ++column) {
+            std::string_view field = tsv.field(column);
+            switch (column) {
+                case 0:
+                    curr_rec_num = static_cast<MonsterId>(TsvReader::toInt(field));
+                    infos[curr_rec_num].id = curr_rec_num;
+                    break;
+                case 1:
+                    infos[curr_rec_num].name = removeQuotes(field);
+                    break;
+                case 2:
+                    infos[curr_rec_num].textureName = removeQuotes(field);
+                    break;
+                case 3:
+                    infos[curr_rec_num].level = TsvReader::toInt(field);
+                    break;
+                case 4:
+                    infos[curr_rec_num].hp = parseThousands(field);
+                    break;
+                case 5:
+                    infos[curr_rec_num].ac = TsvReader::toInt(field);
+                    break;
+                case 6:
+                    infos[curr_rec_num].exp = parseThousands(field);
+                    break;
+                case 7: {
+                    bool chance_flag = false;
+                    bool dice_flag = false;
+                    bool item_type_flag = false;
+                    infos[curr_rec_num].treasureDropChance = 0;
+                    infos[curr_rec_num].goldDiceRolls = 0;
+                    infos[curr_rec_num].goldDiceSides = 0;
+                    infos[curr_rec_num].treasureType = RANDOM_ITEM_ANY;
+                    infos[curr_rec_num].treasureLevel = ITEM_TREASURE_LEVEL_INVALID;
+                    if (field.starts_with('"'))
+                        field.remove_prefix(1);
+                    for (char c : field) {
+                        switch (tolower(c)) {
+                            case '%':
+                                chance_flag = true;
+                                break;
+                            case 'd':
+                                dice_flag = true;
+                                break;
+                            case 'l':
+                                item_type_flag = true;
+                                break;
                         }
-                    } break;
-                    case 7: {
-                        int str_len = 0;
-                        int str_pos = 0;
-                        bool chance_flag = false;
-                        bool dice_flag = false;
-                        bool item_type_flag = false;
-                        char *item_name;
-                        infos[curr_rec_num].treasureDropChance = 0;
-                        infos[curr_rec_num].goldDiceRolls = 0;
-                        infos[curr_rec_num].goldDiceSides = 0;
-                        infos[curr_rec_num].treasureType = RANDOM_ITEM_ANY;
-                        infos[curr_rec_num].treasureLevel = ITEM_TREASURE_LEVEL_INVALID;
-                        if (test_string[0] == '"') test_string[0] = ' ';
-                        str_len = strlen(test_string);
-                        do {
-                            switch (tolower(test_string[str_pos])) {
+                    }
+                    if (chance_flag) {
+                        infos[curr_rec_num].treasureDropChance =
+                            TsvReader::toInt(field);
+                    } else {
+                        if ((!dice_flag) && (!item_type_flag)) break;
+                        infos[curr_rec_num].treasureDropChance = 100;
+                    }
+                    if (dice_flag) {
+                        dice_flag = false;
+                        for (size_t str_pos = 0; str_pos < field.size(); ++str_pos) {
+                            switch (tolower(field[str_pos])) {
                                 case '%':
-                                    chance_flag = true;
-                                    break;
-                                case 'd':
+                                    infos[curr_rec_num]
+                                        .goldDiceRolls =
+                                        TsvReader::toInt(field.substr(str_pos + 1));
                                     dice_flag = true;
                                     break;
-                                case 'l':
-                                    item_type_flag = true;
-                                    break;
-                            }
-                            ++str_pos;
-                        } while (str_pos < str_len);
-                        if (chance_flag) {
-                            infos[curr_rec_num].treasureDropChance =
-                                atoi(test_string);
-                        } else {
-                            if ((!dice_flag) && (!item_type_flag)) break;
-                            infos[curr_rec_num].treasureDropChance = 100;
-                        }
-                        if (dice_flag) {
-                            str_pos = 0;
-                            dice_flag = false;
-                            do {
-                                switch (tolower(test_string[str_pos])) {
-                                    case '%':
+                                case 'd':
+                                    if (!dice_flag)
                                         infos[curr_rec_num]
                                             .goldDiceRolls =
-                                            atoi(&test_string[str_pos + 1]);
-                                        dice_flag = true;
-                                        break;
-                                    case 'd':
-                                        if (!dice_flag)
-                                            infos[curr_rec_num]
-                                                .goldDiceRolls =
-                                                atoi(test_string);
-                                        infos[curr_rec_num]
-                                            .goldDiceSides =
-                                            atoi(&test_string[str_pos + 1]);
-                                        str_pos = str_len;
-                                        break;
-                                }
-                                ++str_pos;
-                            } while (str_pos < str_len);
-                        }
-                        if (item_type_flag) {
-                            str_pos = 0;
-                            do {
-                                if (tolower(test_string[str_pos]) == 'l') break;
-                                ++str_pos;
-                            } while (str_pos < str_len);
-
-                            infos[curr_rec_num].treasureLevel =
-                                ItemTreasureLevel(test_string[str_pos + 1] - '0');
-                            item_name = &test_string[str_pos + 2];
-                            if (*item_name) {
-                                if (ascii::noCaseEquals(item_name, "WEAPON"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_WEAPON;
-                                else if (ascii::noCaseEquals(item_name, "ARMOR"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_ARMOR;
-                                else if (ascii::noCaseEquals(item_name, "MISC"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_MICS;
-                                else if (ascii::noCaseEquals(item_name, "SWORD"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_SWORD;
-                                else if (ascii::noCaseEquals(item_name, "DAGGER"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_DAGGER;
-                                else if (ascii::noCaseEquals(item_name, "AXE"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_AXE;
-                                else if (ascii::noCaseEquals(item_name, "SPEAR"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_SPEAR;
-                                else if (ascii::noCaseEquals(item_name, "BOW"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_BOW;
-                                else if (ascii::noCaseEquals(item_name, "MACE"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_MACE;
-                                else if (ascii::noCaseEquals(item_name, "CLUB"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_CLUB;
-                                else if (ascii::noCaseEquals(item_name, "STAFF"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_STAFF;
-                                else if (ascii::noCaseEquals(item_name, "LEATHER"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_LEATHER_ARMOR;
-                                else if (ascii::noCaseEquals(item_name, "CHAIN"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_CHAIN_ARMOR;
-                                else if (ascii::noCaseEquals(item_name, "PLATE"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_PLATE_ARMOR;
-                                else if (ascii::noCaseEquals(item_name, "SHIELD"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_SHIELD;
-                                else if (ascii::noCaseEquals(item_name, "HELM"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_HELMET;
-                                else if (ascii::noCaseEquals(item_name, "BELT"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_BELT;
-                                else if (ascii::noCaseEquals(item_name, "CAPE"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_CLOAK;
-                                else if (ascii::noCaseEquals(item_name, "GAUNTLETS"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_GAUNTLETS;
-                                else if (ascii::noCaseEquals(item_name, "BOOTS"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_BOOTS;
-                                else if (ascii::noCaseEquals(item_name, "RING"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_RING;
-                                else if (ascii::noCaseEquals(item_name, "AMULET"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_AMULET;
-                                else if (ascii::noCaseEquals(item_name, "WAND"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_WAND;
-                                else if (ascii::noCaseEquals(item_name, "SCROLL"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_SPELL_SCROLL;
-                                else if (ascii::noCaseEquals(item_name, "GEM"))
-                                    infos[curr_rec_num].treasureType = RANDOM_ITEM_GEM;
+                                            TsvReader::toInt(field);
+                                    infos[curr_rec_num]
+                                        .goldDiceSides =
+                                        TsvReader::toInt(field.substr(str_pos + 1));
+                                    str_pos = field.size();
+                                    break;
                             }
                         }
-                    } break;
-                    case 8: {
-                        infos[curr_rec_num].bloodSplatOnDeath = false;
-                        if (atoi(test_string))
-                            infos[curr_rec_num].bloodSplatOnDeath = true;
-                    } break;
-                    case 9: {
-                        infos[curr_rec_num].flying = false;
-                        if (!ascii::noCaseEquals(test_string, "n")) // "Y"/"N"
-                            infos[curr_rec_num].flying = true;
-                    } break;
-                    case 10: {
-                        switch (tolower(test_string[0])) {
-                            case 's':
-                                infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_SHORT;  // short
-                                if (tolower(test_string[1]) != 'h')
-                                    infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_STATIONARY;  // stationary
-                                break;  // short
-                            case 'l':
-                                infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_LONG;
-                                break;  // long
-                            case 'm':
-                                infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_MEDIUM;
-                                break;  // med
-                            case 'g':
-                                infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_GLOBAL;
-                                break;  // global?
-                            default:
-                                infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_FREE;  // free
+                    }
+                    if (item_type_flag) {
+                        size_t str_pos = field.find_first_of("lL");
+
+                        infos[curr_rec_num].treasureLevel =
+                            ItemTreasureLevel(charAt(field, str_pos + 1) - '0');
+                        std::string_view item_name = field.substr(std::min(str_pos + 2, field.size()));
+                        if (!item_name.empty()) {
+                            if (ascii::noCaseEquals(item_name, "WEAPON"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_WEAPON;
+                            else if (ascii::noCaseEquals(item_name, "ARMOR"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_ARMOR;
+                            else if (ascii::noCaseEquals(item_name, "MISC"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_MICS;
+                            else if (ascii::noCaseEquals(item_name, "SWORD"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_SWORD;
+                            else if (ascii::noCaseEquals(item_name, "DAGGER"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_DAGGER;
+                            else if (ascii::noCaseEquals(item_name, "AXE"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_AXE;
+                            else if (ascii::noCaseEquals(item_name, "SPEAR"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_SPEAR;
+                            else if (ascii::noCaseEquals(item_name, "BOW"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_BOW;
+                            else if (ascii::noCaseEquals(item_name, "MACE"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_MACE;
+                            else if (ascii::noCaseEquals(item_name, "CLUB"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_CLUB;
+                            else if (ascii::noCaseEquals(item_name, "STAFF"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_STAFF;
+                            else if (ascii::noCaseEquals(item_name, "LEATHER"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_LEATHER_ARMOR;
+                            else if (ascii::noCaseEquals(item_name, "CHAIN"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_CHAIN_ARMOR;
+                            else if (ascii::noCaseEquals(item_name, "PLATE"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_PLATE_ARMOR;
+                            else if (ascii::noCaseEquals(item_name, "SHIELD"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_SHIELD;
+                            else if (ascii::noCaseEquals(item_name, "HELM"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_HELMET;
+                            else if (ascii::noCaseEquals(item_name, "BELT"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_BELT;
+                            else if (ascii::noCaseEquals(item_name, "CAPE"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_CLOAK;
+                            else if (ascii::noCaseEquals(item_name, "GAUNTLETS"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_GAUNTLETS;
+                            else if (ascii::noCaseEquals(item_name, "BOOTS"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_BOOTS;
+                            else if (ascii::noCaseEquals(item_name, "RING"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_RING;
+                            else if (ascii::noCaseEquals(item_name, "AMULET"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_AMULET;
+                            else if (ascii::noCaseEquals(item_name, "WAND"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_WAND;
+                            else if (ascii::noCaseEquals(item_name, "SCROLL"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_SPELL_SCROLL;
+                            else if (ascii::noCaseEquals(item_name, "GEM"))
+                                infos[curr_rec_num].treasureType = RANDOM_ITEM_GEM;
                         }
-                    } break;
-                    case 11: {
-                        switch (tolower(test_string[0])) {
+                    }
+                } break;
+                case 8: {
+                    infos[curr_rec_num].bloodSplatOnDeath = false;
+                    if (TsvReader::toInt(field))
+                        infos[curr_rec_num].bloodSplatOnDeath = true;
+                } break;
+                case 9: {
+                    infos[curr_rec_num].flying = false;
+                    if (!ascii::noCaseEquals(field, "n")) // "Y"/"N"
+                        infos[curr_rec_num].flying = true;
+                } break;
+                case 10: {
+                    switch (tolower(charAt(field, 0))) {
+                        case 's':
+                            infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_SHORT;  // short
+                            if (tolower(charAt(field, 1)) != 'h')
+                                infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_STATIONARY;  // stationary
+                            break;  // short
+                        case 'l':
+                            infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_LONG;
+                            break;  // long
+                        case 'm':
+                            infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_MEDIUM;
+                            break;  // med
+                        case 'g':
+                            infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_GLOBAL;
+                            break;  // global?
+                        default:
+                            infos[curr_rec_num].movementType = MONSTER_MOVEMENT_TYPE_FREE;  // free
+                    }
+                } break;
+                case 11: {
+                    switch (tolower(charAt(field, 0))) {
+                        case 's':
+                            infos[curr_rec_num].aiType = MONSTER_AI_SUICIDE;
+                            break;
+                        case 'w':
+                            infos[curr_rec_num].aiType = MONSTER_AI_WIMP;
+                            break;
+                        case 'n':
+                            infos[curr_rec_num].aiType = MONSTER_AI_NORMAL;
+                            break;
+                        default:
+                            infos[curr_rec_num].aiType = MONSTER_AI_AGGRESSIVE;
+                    }
+                } break;
+                case 12:
+                    infos[curr_rec_num].hostilityType =
+                        (MonsterHostility)TsvReader::toInt(field);
+                    break;
+                case 13:
+                    infos[curr_rec_num].baseSpeed = TsvReader::toInt(field);
+                    break;
+                case 14:
+                    infos[curr_rec_num].recoveryTime = Duration::fromTicks(TsvReader::toInt(field));
+                    break;
+                case 15: {
+                    infos[curr_rec_num].attackPreferences = 0;
+                    infos[curr_rec_num]
+                        .numCharactersAttackedPerSpecialAbility = 0;
+                    for (char c : field) {
+                        switch (tolower(c)) {
+                            case '0':
+                                // TODO(captainurist): '0' means archer? Why???
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_ARCHER;
+                                break;
+                            case '2':
+                                infos[curr_rec_num]
+                                    .numCharactersAttackedPerSpecialAbility =
+                                    2;
+                                break;
+                            case '3':
+                                infos[curr_rec_num]
+                                    .numCharactersAttackedPerSpecialAbility =
+                                    3;
+                                break;
+                            case '4':
+                                infos[curr_rec_num]
+                                    .numCharactersAttackedPerSpecialAbility =
+                                    4;
+                                break;
+                            case 'c':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_CLERIC;
+                                break;
+                            case 'd':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_DRUID;
+                                break;
+                            case 'e':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_ELF;
+                                break;
+                            case 'f':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_FEMALE;
+                                break;
+                            case 'h':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_HUMAN;
+                                break;
+                            case 'k':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_KNIGHT;
+                                break;
+                            case 'm':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_MONK;
+                                break;
+                            case 'o':
+                                // TODO(captainurist): both 'f' and 'o' are ATTACK_PREFERENCE_FEMALE?
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_FEMALE;
+                                break;
+                            case 'p':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_PALADIN;
+                                break;
+                            case 'r':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_RANGER;
+                                break;
                             case 's':
-                                infos[curr_rec_num].aiType = MONSTER_AI_SUICIDE;
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_SORCERER;
+                                break;
+                            case 't':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_THIEF;
                                 break;
                             case 'w':
-                                infos[curr_rec_num].aiType = MONSTER_AI_WIMP;
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_DWARF;
                                 break;
-                            case 'n':
-                                infos[curr_rec_num].aiType = MONSTER_AI_NORMAL;
+                            case 'x':
+                                infos[curr_rec_num].attackPreferences |=
+                                    ATTACK_PREFERENCE_MALE;
                                 break;
-                            default:
-                                infos[curr_rec_num].aiType = MONSTER_AI_AGGRESSIVE;
                         }
-                    } break;
-                    case 12:
-                        infos[curr_rec_num].hostilityType =
-                            (MonsterHostility)atoi(test_string);
-                        break;
-                    case 13:
-                        infos[curr_rec_num].baseSpeed = atoi(test_string);
-                        break;
-                    case 14:
-                        infos[curr_rec_num].recoveryTime = Duration::fromTicks(atoi(test_string));
-                        break;
-                    case 15: {
-                        int str_len = 0;
-                        int str_pos = 0;
-                        infos[curr_rec_num].attackPreferences = 0;
-                        infos[curr_rec_num]
-                            .numCharactersAttackedPerSpecialAbility = 0;
-                        str_len = strlen(test_string);
-                        for (str_pos = 0; str_pos < str_len; ++str_pos) {
-                            switch (tolower(test_string[str_pos])) {
-                                case '0':
-                                    // TODO(captainurist): '0' means archer? Why???
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_ARCHER;
-                                    break;
-                                case '2':
-                                    infos[curr_rec_num]
-                                        .numCharactersAttackedPerSpecialAbility =
-                                        2;
-                                    break;
-                                case '3':
-                                    infos[curr_rec_num]
-                                        .numCharactersAttackedPerSpecialAbility =
-                                        3;
-                                    break;
-                                case '4':
-                                    infos[curr_rec_num]
-                                        .numCharactersAttackedPerSpecialAbility =
-                                        4;
-                                    break;
-                                case 'c':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_CLERIC;
-                                    break;
-                                case 'd':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_DRUID;
-                                    break;
-                                case 'e':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_ELF;
-                                    break;
-                                case 'f':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_FEMALE;
-                                    break;
-                                case 'h':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_HUMAN;
-                                    break;
-                                case 'k':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_KNIGHT;
-                                    break;
-                                case 'm':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_MONK;
-                                    break;
-                                case 'o':
-                                    // TODO(captainurist): both 'f' and 'o' are ATTACK_PREFERENCE_FEMALE?
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_FEMALE;
-                                    break;
-                                case 'p':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_PALADIN;
-                                    break;
-                                case 'r':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_RANGER;
-                                    break;
-                                case 's':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_SORCERER;
-                                    break;
-                                case 't':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_THIEF;
-                                    break;
-                                case 'w':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_DWARF;
-                                    break;
-                                case 'x':
-                                    infos[curr_rec_num].attackPreferences |=
-                                        ATTACK_PREFERENCE_MALE;
-                                    break;
-                            }
-                        }
-                    } break;
-                    case 16: {
-                        int str_len = 0;
-                        int str_pos = 0;
-                        infos[curr_rec_num].specialAttackLevel = 1;
-                        infos[curr_rec_num].specialAttackType = SPECIAL_ATTACK_NONE;
-                        str_len = strlen(test_string);
-                        if (str_len > 1) {
-                            for (str_pos = 0; str_pos < str_len; ++str_pos) {
-                                if (tolower(test_string[str_pos]) == 'x') {
-                                    test_string[str_pos] = '\0';
-                                    infos[curr_rec_num].specialAttackLevel =
-                                        atoi(&test_string[str_pos + 1]);
-                                    test_string[str_pos] = 'x';
-                                    break;
-                                }
-                            }
-                            infos[curr_rec_num].specialAttackType = ParseSpecialAttack(test_string);
-                        }
-                    } break;
-                    case 17:
-                        infos[curr_rec_num].attack1Type = ParseAttackType(test_string);
-                        break;
-                    case 18: {
-                        ParseDamage(
-                            test_string,
-                            &infos[curr_rec_num].attack1DamageDiceRolls,
-                            &infos[curr_rec_num].attack1DamageDiceSides,
-                            &infos[curr_rec_num].attack1DamageBonus);
-                    } break;
-                    case 19:
-                        infos[curr_rec_num].attack1MissileType =
-                            ParseMissleAttackType(test_string);
-                        break;
-                    case 20:
-                        infos[curr_rec_num].attack2Chance = atoi(test_string);
-                        break;
-                    case 21:
-                        infos[curr_rec_num].attack2Type =
-                            ParseAttackType(test_string);
-                        break;
-                    case 22: {
-                        ParseDamage(
-                            test_string,
-                            &infos[curr_rec_num].attack2DamageDiceRolls,
-                            &infos[curr_rec_num].attack2DamageDiceSides,
-                            &infos[curr_rec_num].attack2DamageBonus);
-                    } break;
-                    case 23:
-                        infos[curr_rec_num].attack2MissileType =
-                            ParseMissleAttackType(test_string);
-                        break;
-                    case 24:
-                        infos[curr_rec_num].spell1UseChance =
-                            atoi(test_string);
-                        break;
-                    case 25: {
-                        int param_num;
-                        strcpy(parse_str, test_string);
-                        parse_str[0] = ' ';
-                        parse_str[strlen(parse_str) - 1] = ' ';
-                        frame_table_txt_parser(parse_str, &parsed_field);
-                        if (parsed_field.uPropCount > 2) {
-                            param_num = 1;
-                            infos[curr_rec_num].spell1Id =
-                                ParseSpellType(&parsed_field, &param_num);
-                            infos[curr_rec_num].spell1SkillMastery =
-                                ParseSkillValue(parsed_field.pProperties[param_num + 1], parsed_field.pProperties[param_num]);
-                        } else {
-                            infos[curr_rec_num].spell1Id = SPELL_NONE;
-                            infos[curr_rec_num].spell1SkillMastery = CombinedSkillValue::none();
-                        }
-                    } break;
-                    case 26:
-                        infos[curr_rec_num].spell2UseChance =
-                            atoi(test_string);
-                        break;
-                    case 27: {
-                        int param_num;
-                        strcpy(parse_str, test_string);
-                        parse_str[0] = ' ';
-                        parse_str[strlen(parse_str) - 1] = ' ';
-                        frame_table_txt_parser(parse_str, &parsed_field);
-                        if (parsed_field.uPropCount > 2) {
-                            param_num = 1;
-                            infos[curr_rec_num].spell2Id =
-                                ParseSpellType(&parsed_field, &param_num);
-                            infos[curr_rec_num].spell2SkillMastery =
-                                ParseSkillValue(parsed_field.pProperties[param_num + 1], parsed_field.pProperties[param_num]);
-                        } else {
-                            infos[curr_rec_num].spell2Id = SPELL_NONE;
-                            infos[curr_rec_num].spell2SkillMastery = CombinedSkillValue::none();
-                        }
-                    } break;
-                    case 28: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resFire = 200;
-                        else
-                            infos[curr_rec_num].resFire = atoi(test_string);
-                    } break;
-                    case 29: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resAir = 200;
-                        else
-                            infos[curr_rec_num].resAir = atoi(test_string);
-                    } break;
-                    case 30: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resWater = 200;
-                        else
-                            infos[curr_rec_num].resWater = atoi(test_string);
-                    } break;
-                    case 31: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resEarth = 200;
-                        else
-                            infos[curr_rec_num].resEarth = atoi(test_string);
-                    } break;
-                    case 32: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resMind = 200;
-                        else
-                            infos[curr_rec_num].resMind = atoi(test_string);
-                    } break;
-                    case 33: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resSpirit = 200;
-                        else
-                            infos[curr_rec_num].resSpirit = atoi(test_string);
-                    } break;
-                    case 34: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resBody = 200;
-                        else
-                            infos[curr_rec_num].resBody = atoi(test_string);
-                    } break;
-                    case 35: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resLight = 200;
-                        else
-                            infos[curr_rec_num].resLight = atoi(test_string);
-                    } break;
-                    case 36: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resDark = 200;
-                        else
-                            infos[curr_rec_num].resDark = atoi(test_string);
-                    } break;
-                    case 37: {
-                        if (tolower(test_string[0]) == 'i')
-                            infos[curr_rec_num].resPhysical = 200;
-                        else
-                            infos[curr_rec_num].resPhysical =
-                                atoi(test_string);
-                    } break;
-                    case 38: {
-                        //                    int param_num;
-                        //                    char type_flag;
-                        infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_NONE;
-                        infos[curr_rec_num].specialAbilityDamageDiceBonus = 0;
-                        strcpy(parse_str, test_string);
-                        parse_str[0] = ' ';
-                        parse_str[strlen(parse_str) - 1] = ' ';
-                        frame_table_txt_parser(parse_str, &parsed_field);
-                        if (parsed_field.uPropCount) {
-                            //      v74 = v94.field_0;
-                            if (parsed_field.uPropCount < 10) {
-                                if (ascii::noCaseEquals(parsed_field.pProperties[0], "shot")) {
-                                    infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_MULTI_SHOT;
-                                    infos[curr_rec_num]
-                                        .specialAbilityDamageDiceBonus = atoi(
-                                        (char *)(parsed_field.pProperties[1] +
-                                                 1));
-                                } else if (ascii::noCaseEquals(parsed_field.pProperties[0], "summon")) {
-                                    infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_SUMMON;
-                                    if (parsed_field.uPropCount > 1) {
-                                        str = parsed_field.pProperties[2];
-                                        if (parsed_field.uPropCount > 2) {
-                                            int prop_cnt = 3;
-                                            if (parsed_field.uPropCount > 3) {
-                                                do {
-                                                    str += " ";
-                                                    char test_char =
-                                                        parsed_field.pProperties
-                                                            [prop_cnt][0];
-                                                    str +=
-                                                        parsed_field.pProperties
-                                                            [prop_cnt];
-                                                    if (prop_cnt ==
-                                                        (parsed_field
-                                                             .uPropCount -
-                                                         1)) {
-                                                        switch (tolower(
-                                                            test_char)) {
-                                                            case 'a':
-                                                                infos[curr_rec_num]
-                                                                    .specialAbilityDamageDiceRolls =
-                                                                    1;
-                                                                break;
-                                                            case 'b':
-                                                                infos[curr_rec_num]
-                                                                    .specialAbilityDamageDiceRolls =
-                                                                    2;
-                                                                break;
-                                                            case 'c':
-                                                                infos[curr_rec_num]
-                                                                    .specialAbilityDamageDiceRolls =
-                                                                    3;
-                                                                break;
-                                                            default:
-                                                                infos[curr_rec_num]
-                                                                    .specialAbilityDamageDiceRolls =
-                                                                    0;
-                                                        }
+                    }
+                } break;
+                case 16: {
+                    infos[curr_rec_num].specialAttackLevel = 1;
+                    infos[curr_rec_num].specialAttackType = SPECIAL_ATTACK_NONE;
+                    if (field.size() > 1) {
+                        size_t str_pos = field.find_first_of("xX");
+                        if (str_pos != std::string_view::npos)
+                            infos[curr_rec_num].specialAttackLevel = TsvReader::toInt(field.substr(str_pos + 1));
+                        infos[curr_rec_num].specialAttackType = ParseSpecialAttack(field);
+                    }
+                } break;
+                case 17:
+                    infos[curr_rec_num].attack1Type = ParseAttackType(field);
+                    break;
+                case 18: {
+                    ParseDamage(
+                        field,
+                        &infos[curr_rec_num].attack1DamageDiceRolls,
+                        &infos[curr_rec_num].attack1DamageDiceSides,
+                        &infos[curr_rec_num].attack1DamageBonus);
+                } break;
+                case 19:
+                    infos[curr_rec_num].attack1MissileType =
+                        ParseMissleAttackType(field);
+                    break;
+                case 20:
+                    infos[curr_rec_num].attack2Chance = TsvReader::toInt(field);
+                    break;
+                case 21:
+                    infos[curr_rec_num].attack2Type =
+                        ParseAttackType(field);
+                    break;
+                case 22: {
+                    ParseDamage(
+                        field,
+                        &infos[curr_rec_num].attack2DamageDiceRolls,
+                        &infos[curr_rec_num].attack2DamageDiceSides,
+                        &infos[curr_rec_num].attack2DamageBonus);
+                } break;
+                case 23:
+                    infos[curr_rec_num].attack2MissileType =
+                        ParseMissleAttackType(field);
+                    break;
+                case 24:
+                    infos[curr_rec_num].spell1UseChance =
+                        TsvReader::toInt(field);
+                    break;
+                case 25: {
+                    int param_num;
+                    parseSubfields(column, field);
+                    if (parsed_field.uPropCount > 2) {
+                        param_num = 1;
+                        infos[curr_rec_num].spell1Id =
+                            ParseSpellType(&parsed_field, &param_num);
+                        infos[curr_rec_num].spell1SkillMastery =
+                            ParseSkillValue(parsed_field.pProperties[param_num + 1], parsed_field.pProperties[param_num]);
+                    } else {
+                        infos[curr_rec_num].spell1Id = SPELL_NONE;
+                        infos[curr_rec_num].spell1SkillMastery = CombinedSkillValue::none();
+                    }
+                } break;
+                case 26:
+                    infos[curr_rec_num].spell2UseChance =
+                        TsvReader::toInt(field);
+                    break;
+                case 27: {
+                    int param_num;
+                    parseSubfields(column, field);
+                    if (parsed_field.uPropCount > 2) {
+                        param_num = 1;
+                        infos[curr_rec_num].spell2Id =
+                            ParseSpellType(&parsed_field, &param_num);
+                        infos[curr_rec_num].spell2SkillMastery =
+                            ParseSkillValue(parsed_field.pProperties[param_num + 1], parsed_field.pProperties[param_num]);
+                    } else {
+                        infos[curr_rec_num].spell2Id = SPELL_NONE;
+                        infos[curr_rec_num].spell2SkillMastery = CombinedSkillValue::none();
+                    }
+                } break;
+                case 28: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resFire = 200;
+                    else
+                        infos[curr_rec_num].resFire = TsvReader::toInt(field);
+                } break;
+                case 29: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resAir = 200;
+                    else
+                        infos[curr_rec_num].resAir = TsvReader::toInt(field);
+                } break;
+                case 30: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resWater = 200;
+                    else
+                        infos[curr_rec_num].resWater = TsvReader::toInt(field);
+                } break;
+                case 31: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resEarth = 200;
+                    else
+                        infos[curr_rec_num].resEarth = TsvReader::toInt(field);
+                } break;
+                case 32: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resMind = 200;
+                    else
+                        infos[curr_rec_num].resMind = TsvReader::toInt(field);
+                } break;
+                case 33: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resSpirit = 200;
+                    else
+                        infos[curr_rec_num].resSpirit = TsvReader::toInt(field);
+                } break;
+                case 34: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resBody = 200;
+                    else
+                        infos[curr_rec_num].resBody = TsvReader::toInt(field);
+                } break;
+                case 35: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resLight = 200;
+                    else
+                        infos[curr_rec_num].resLight = TsvReader::toInt(field);
+                } break;
+                case 36: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resDark = 200;
+                    else
+                        infos[curr_rec_num].resDark = TsvReader::toInt(field);
+                } break;
+                case 37: {
+                    if (tolower(charAt(field, 0)) == 'i')
+                        infos[curr_rec_num].resPhysical = 200;
+                    else
+                        infos[curr_rec_num].resPhysical =
+                            TsvReader::toInt(field);
+                } break;
+                case 38: {
+                    infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_NONE;
+                    infos[curr_rec_num].specialAbilityDamageDiceBonus = 0;
+                    parseSubfields(column, field);
+                    if (parsed_field.uPropCount) {
+                        //      v74 = v94.field_0;
+                        if (parsed_field.uPropCount < 10) {
+                            if (ascii::noCaseEquals(parsed_field.pProperties[0], "shot")) {
+                                infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_MULTI_SHOT;
+                                infos[curr_rec_num]
+                                    .specialAbilityDamageDiceBonus =
+                                    TsvReader::toInt(parsed_field.pProperties[1] + 1);
+                            } else if (ascii::noCaseEquals(parsed_field.pProperties[0], "summon")) {
+                                infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_SUMMON;
+                                if (parsed_field.uPropCount > 1) {
+                                    str = parsed_field.pProperties[2];
+                                    if (parsed_field.uPropCount > 2) {
+                                        int prop_cnt = 3;
+                                        if (parsed_field.uPropCount > 3) {
+                                            do {
+                                                str += " ";
+                                                char test_char =
+                                                    parsed_field.pProperties
+                                                        [prop_cnt][0];
+                                                str +=
+                                                    parsed_field.pProperties
+                                                        [prop_cnt];
+                                                if (prop_cnt ==
+                                                    (parsed_field
+                                                         .uPropCount -
+                                                     1)) {
+                                                    switch (tolower(
+                                                        test_char)) {
+                                                        case 'a':
+                                                            infos[curr_rec_num]
+                                                                .specialAbilityDamageDiceRolls =
+                                                                1;
+                                                            break;
+                                                        case 'b':
+                                                            infos[curr_rec_num]
+                                                                .specialAbilityDamageDiceRolls =
+                                                                2;
+                                                            break;
+                                                        case 'c':
+                                                            infos[curr_rec_num]
+                                                                .specialAbilityDamageDiceRolls =
+                                                                3;
+                                                            break;
+                                                        default:
+                                                            infos[curr_rec_num]
+                                                                .specialAbilityDamageDiceRolls =
+                                                                0;
                                                     }
-                                                    ++prop_cnt;
-                                                } while (
-                                                    prop_cnt <
-                                                    parsed_field.uPropCount);
-                                            }
-                                        } else {
-                                            infos[curr_rec_num]
-                                                .specialAbilityDamageDiceRolls =
-                                                0;
-                                        }
-                                        if (!pMonsterList->monsters.empty()) {
-                                            infos[curr_rec_num].field_3C_some_special_attack =
-                                                std::to_underlying(pMonsterList->GetMonsterIDByName(str));
+                                                }
+                                                ++prop_cnt;
+                                            } while (
+                                                prop_cnt <
+                                                parsed_field.uPropCount);
                                         }
+                                    } else {
                                         infos[curr_rec_num]
-                                            .specialAbilityDamageDiceSides = 0;
-                                        if (ascii::noCaseEquals(parsed_field.pProperties[1], "ground"))
-                                            infos[curr_rec_num]
-                                                .specialAbilityDamageDiceSides =
-                                                1;
-                                        if (infos[curr_rec_num]
-                                                .field_3C_some_special_attack ==
-                                            -1)
-                                            infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_NONE;
+                                            .specialAbilityDamageDiceRolls =
+                                            0;
+                                    }
+                                    if (!pMonsterList->monsters.empty()) {
+                                        infos[curr_rec_num].field_3C_some_special_attack =
+                                            std::to_underlying(pMonsterList->GetMonsterIDByName(str));
                                     }
-                                } else if (ascii::noCaseEquals(parsed_field.pProperties[0], "explode")) {
-                                    infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_EXPLODE;
-                                    ParseDamage(
-                                        (char *)parsed_field.pProperties[1],
-                                        &infos[curr_rec_num]
-                                             .specialAbilityDamageDiceRolls,
-                                        &infos[curr_rec_num]
-                                             .specialAbilityDamageDiceSides,
-                                        &infos[curr_rec_num]
-                                             .specialAbilityDamageDiceBonus);
                                     infos[curr_rec_num]
-                                        .field_3C_some_special_attack =
-                                        std::to_underlying(ParseAttackType(test_string));
+                                        .specialAbilityDamageDiceSides = 0;
+                                    if (ascii::noCaseEquals(parsed_field.pProperties[1], "ground"))
+                                        infos[curr_rec_num]
+                                            .specialAbilityDamageDiceSides =
+                                            1;
+                                    if (infos[curr_rec_num]
+                                            .field_3C_some_special_attack ==
+                                        -1)
+                                        infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_NONE;
                                 }
+                            } else if (ascii::noCaseEquals(parsed_field.pProperties[0], "explode")) {
+                                infos[curr_rec_num].specialAbilityType = MONSTER_SPECIAL_ABILITY_EXPLODE;
+                                ParseDamage(
+                                    parsed_field.pProperties[1],
+                                    &infos[curr_rec_num]
+                                         .specialAbilityDamageDiceRolls,
+                                    &infos[curr_rec_num]
+                                         .specialAbilityDamageDiceSides,
+                                    &infos[curr_rec_num]
+                                         .specialAbilityDamageDiceBonus);
+                                infos[curr_rec_num]
+                                    .field_3C_some_special_attack =
+                                    std::to_underlying(ParseAttackType(field));
                             }
                         }
-                    } break;
-                }
-            } else {
-                break_loop = true;
+                    }
+                } break;
             }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 39) && !break_loop);
+        }
     }
 }
 
@@ -0,0 +1,88 @@
+#include "ObjectGrid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+static constexpr int GRID_EXTENT = 65536;
+
+ObjectGrid::ObjectGrid(int cellSize) : _cellSize(cellSize), _gridSize(GRID_EXTENT / cellSize) {
+    assert(cellSize > 0 && GRID_EXTENT % cellSize == 0);
+}
+
+void ObjectGrid::build(std::span<const Vec3f> positions) {
+    buildInternal(positions.size(), [&](size_t index, auto &&callback) {
+        callback(cellCoord(positions[index].y) * _gridSize + cellCoord(positions[index].x));
+    });
+}
+
+void ObjectGrid::build(std::span<const BBoxf> boxes) {
+    buildInternal(boxes.size(), [&](size_t index, auto &&callback) {
+        const BBoxf &box = boxes[index];
+        int x1 = cellCoord(box.x1), x2 = cellCoord(box.x2);
+        int y1 = cellCoord(box.y1), y2 = cellCoord(box.y2);
+        for (int y = y1; y <= y2; y++)
+            for (int x = x1; x <= x2; x++)
+                callback(y * _gridSize + x);
+    });
+}
+
+template<class CellEnumerator>
+void ObjectGrid::buildInternal(size_t size, CellEnumerator &&forEachCell) {
+    _size = size;
+    _cellOffsets.assign(_gridSize * _gridSize + 1, 0);
+
+    // Counting sort by cell. Objects are visited in order, so each cell ends up sorted.
+    for (size_t i = 0; i < size; i++)
+        forEachCell(i, [&](int cell) { _cellOffsets[cell + 1]++; });
+    for (size_t i = 1; i < _cellOffsets.size(); i++)
+        _cellOffsets[i] += _cellOffsets[i - 1];
+
+    _cellObjects.resize(_cellOffsets.back());
+    std::vector<int> insertPositions(_cellOffsets.begin(), _cellOffsets.end() - 1);
+    for (size_t i = 0; i < size; i++)
+        forEachCell(i, [&](int cell) { _cellObjects[insertPositions[cell]++] = i; });
+}
+
+void ObjectGrid::clear() {
+    _size = 0;
+    _cellOffsets.clear();
+    _cellObjects.clear();
+    _queryBuffer.clear();
+}
+
+std::span<const int> ObjectGrid::query(float x, float y) const {
+    if (_cellOffsets.empty())
+        return {};
+
+    int cell = cellCoord(y) * _gridSize + cellCoord(x);
+    return std::span(_cellObjects).subspan(_cellOffsets[cell], _cellOffsets[cell + 1] - _cellOffsets[cell]);
+}
+
+std::span<const int> ObjectGrid::query(const BBoxf &box) {
+    _queryBuffer.clear();
+    if (_cellOffsets.empty())
+        return _queryBuffer;
+
+    int x1 = cellCoord(box.x1), x2 = cellCoord(box.x2);
+    int y1 = cellCoord(box.y1), y2 = cellCoord(box.y2);
+    for (int y = y1; y <= y2; y++) {
+        int rowBegin = _cellOffsets[y * _gridSize + x1];
+        int rowEnd = _cellOffsets[y * _gridSize + x2 + 1];
+        _queryBuffer.insert(_queryBuffer.end(), _cellObjects.begin() + rowBegin, _cellObjects.begin() + rowEnd);
+    }
+
+    // Objects built from boxes can be present in several cells, so we might need to drop duplicates.
+    if (x1 != x2 || y1 != y2) {
+        std::sort(_queryBuffer.begin(), _queryBuffer.end());
+        _queryBuffer.erase(std::unique(_queryBuffer.begin(), _queryBuffer.end()), _queryBuffer.end());
+    }
+    return _queryBuffer;
+}
+
+int ObjectGrid::cellCoord(float v) const {
+    float cell = std::floor(v / _cellSize) + _gridSize / 2;
+    if (!(cell >= 0))
+        return 0; // Also catches NaNs.
+    return static_cast<int>(std::min(cell, _gridSize - 1.0f));
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Library/Geometry/BBox.h"
+#include "Library/Geometry/Vec.h"
+
+/**
+ * Uniform 2D grid over object positions (actors, decorations, etc) or bounding boxes (sectors), used to speed up
+ * neighbour queries.
+ *
+ * The grid covers the whole playable area, `[-32768, 32768)` on both axes. Objects outside of that range are stored
+ * in the border cells, so queries stay conservative. Objects built from bounding boxes are stored in all the cells
+ * that their boxes overlap.
+ *
+ * Objects are identified by their indices in the array that was passed to `build`. Queries return indices in
+ * ascending order, so code that iterates over the result visits objects in the same order as a loop over the whole
+ * array would, which is important for determinism.
+ */
+class ObjectGrid {
+ public:
+    /**
+     * @param cellSize                  Size of a grid cell, must divide 65536.
+     */
+    explicit ObjectGrid(int cellSize = 2048);
+
+    /**
+     * @param positions                 Object positions, only x & y are used.
+     */
+    void build(std::span<const Vec3f> positions);
+
+    /**
+     * @param boxes                     Object bounding boxes, z coordinates are ignored.
+     */
+    void build(std::span<const BBoxf> boxes);
+
+    void clear();
+
+    /**
+     * @return                          Number of objects in the grid, i.e. the size of the array that was passed to
+     *                                  `build`. Objects added to the source array after `build` should be checked
+     *                                  separately.
+     */
+    [[nodiscard]] size_t size() const {
+        return _size;
+    }
+
+    /**
+     * @param box                       World-space box, z coordinates are ignored.
+     * @return                          Sorted indices of the objects that might lie inside the provided box. Returned
+     *                                  span is valid until the next call to any of the non-const methods.
+     */
+    [[nodiscard]] std::span<const int> query(const BBoxf &box);
+
+    /**
+     * @param x                         World x coordinate.
+     * @param y                         World y coordinate.
+     * @return                          Sorted indices of the objects that might contain the provided point. Returned
+     *                                  span is valid until the next call to `build` or `clear`.
+     */
+    [[nodiscard]] std::span<const int> query(float x, float y) const;
+
+ private:
+    template<class CellEnumerator>
+    void buildInternal(size_t size, CellEnumerator &&forEachCell);
+
+    [[nodiscard]] int cellCoord(float v) const;
+
+ private:
+    int _cellSize = 0;
+    int _gridSize = 0;
+    size_t _size = 0;
+    std::vector<int> _cellOffsets; // _gridSize * _gridSize + 1 offsets into `_cellObjects`, CSR-style.
+    std::vector<int> _cellObjects;
+    std::vector<int> _queryBuffer;
+};
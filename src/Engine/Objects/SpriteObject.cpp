@@ -41,6 +41,7 @@ static SpellFxRenderer *spell_fx_renderer = EngineIocContainer::ResolveSpellFxRe
 static std::shared_ptr<ParticleEngine> particle_engine = EngineIocContainer::ResolveParticleEngine();
 
 std::vector<SpriteObject> pSpriteObjects;
+SpriteObjectSlots spriteObjectSlots;
 
 int SpriteObject::Create(int yaw, int pitch, int speed, int which_char) {
     // check for valid sprite object
@@ -50,23 +51,12 @@ int SpriteObject::Create(int yaw, int pitch, int speed, int which_char) {
 
     // TODO(pskelton): refactor this so check isnt needed
     // To prevent memory corruption this function should never be called for any item in pSpriteObjects
-    for (SpriteObject &ref : pSpriteObjects) {
-        assert(&ref != this);
-    }
+    assert(this < pSpriteObjects.data() || this >= pSpriteObjects.data() + pSpriteObjects.size());
 
     // find free sprite slot
-    int sprite_slot = -1;
-    for (unsigned int i = 0; i < pSpriteObjects.size(); ++i) {
-        if (!pSpriteObjects[i].uObjectDescID) {
-            sprite_slot = i;
-            break;
-        }
-    }
-
-    if (sprite_slot == -1) {
-        sprite_slot = pSpriteObjects.size();
+    int sprite_slot = spriteObjectSlots.allocate(pSpriteObjects);
+    if (sprite_slot == pSpriteObjects.size())
         pSpriteObjects.emplace_back();
-    }
 
     // set initial position
     initialPosition = vPosition;
@@ -105,9 +95,6 @@ int SpriteObject::Create(int yaw, int pitch, int speed, int which_char) {
     }
 
     // copy sprite object into slot
-    if (sprite_slot >= (int)pSpriteObjects.size()) {
-        pSpriteObjects.resize(sprite_slot + 1);
-    }
     pSpriteObjects[sprite_slot] = *this;
     return sprite_slot;
 }
@@ -581,6 +568,7 @@ Color SpriteObject::GetParticleTrailColor() {
 
 void SpriteObject::OnInteraction(unsigned int uLayingItemID) {
     pSpriteObjects[uLayingItemID].uObjectDescID = 0;
+    spriteObjectSlots.setLive(uLayingItemID, false);
     if (pParty->bTurnBasedModeOn) {
         if (pSpriteObjects[uLayingItemID].uAttributes & SPRITE_HALT_TURN_BASED) {
             pSpriteObjects[uLayingItemID].uAttributes &= ~SPRITE_HALT_TURN_BASED;
@@ -603,6 +591,7 @@ void CompactLayingItemsList() {
     }
 
     pSpriteObjects.resize(new_obj_pos);
+    spriteObjectSlots.rebuild(pSpriteObjects);
 }
 
 void SpriteObject::InitializeSpriteObjects() {
@@ -1267,75 +1256,83 @@ void applySpellSpriteDamage(unsigned int uLayingItemID, Pid pid) {
     }
 }
 
-void UpdateObjects() {
-    for (unsigned i = 0; i < pSpriteObjects.size(); ++i) {
-        if (pSpriteObjects[i].uAttributes & SPRITE_SKIP_A_FRAME) {
-            pSpriteObjects[i].uAttributes &= ~SPRITE_SKIP_A_FRAME;
-        } else {
-            ObjectDesc *object = &pObjectList->pObjects[pSpriteObjects[i].uObjectDescID];
-            if (pSpriteObjects[i].attachedToActor()) {
-                int actorId = pSpriteObjects[i].spell_target_pid.id();
-                if (actorId > pActors.size()) {
-                    continue;
-                }
-                pSpriteObjects[i].vPosition = pActors[actorId].pos + Vec3f(0, 0, pActors[actorId].height);
-                if (!pSpriteObjects[i].uObjectDescID) {
-                    continue;
-                }
-                pSpriteObjects[i].timeSinceCreated += pEventTimer->dt();
-                if (!(object->uFlags & OBJECT_DESC_TEMPORARY)) {
-                    continue;
-                }
-                if (pSpriteObjects[i].timeSinceCreated >= 0_ticks) {
-                    Duration lifetime = object->uLifetime;
-                    if (pSpriteObjects[i].uAttributes & SPRITE_TEMPORARY) {
-                        lifetime = pSpriteObjects[i].tempLifetime;
-                    }
-                    if (pSpriteObjects[i].timeSinceCreated < lifetime) {
-                        continue;
-                    }
-                }
+static void updateSpriteObject(int i) {
+    if (pSpriteObjects[i].uAttributes & SPRITE_SKIP_A_FRAME) {
+        pSpriteObjects[i].uAttributes &= ~SPRITE_SKIP_A_FRAME;
+        return;
+    }
+
+    ObjectDesc *object = &pObjectList->pObjects[pSpriteObjects[i].uObjectDescID];
+    if (pSpriteObjects[i].attachedToActor()) {
+        int actorId = pSpriteObjects[i].spell_target_pid.id();
+        if (actorId > pActors.size()) {
+            return;
+        }
+        pSpriteObjects[i].vPosition = pActors[actorId].pos + Vec3f(0, 0, pActors[actorId].height);
+        if (!pSpriteObjects[i].uObjectDescID) {
+            return;
+        }
+        pSpriteObjects[i].timeSinceCreated += pEventTimer->dt();
+        if (!(object->uFlags & OBJECT_DESC_TEMPORARY)) {
+            return;
+        }
+        if (pSpriteObjects[i].timeSinceCreated >= 0_ticks) {
+            Duration lifetime = object->uLifetime;
+            if (pSpriteObjects[i].uAttributes & SPRITE_TEMPORARY) {
+                lifetime = pSpriteObjects[i].tempLifetime;
+            }
+            if (pSpriteObjects[i].timeSinceCreated < lifetime) {
+                return;
+            }
+        }
+        SpriteObject::OnInteraction(i);
+        return;
+    }
+    if (pSpriteObjects[i].uObjectDescID) {
+        Duration lifetime;
+        pSpriteObjects[i].timeSinceCreated += pEventTimer->dt();
+        if (object->uFlags & OBJECT_DESC_TEMPORARY) {
+            if (pSpriteObjects[i].timeSinceCreated < 0_ticks) {
                 SpriteObject::OnInteraction(i);
-                continue;
+                return;
             }
-            if (pSpriteObjects[i].uObjectDescID) {
-                Duration lifetime;
-                pSpriteObjects[i].timeSinceCreated += pEventTimer->dt();
-                if (object->uFlags & OBJECT_DESC_TEMPORARY) {
-                    if (pSpriteObjects[i].timeSinceCreated < 0_ticks) {
-                        SpriteObject::OnInteraction(i);
-                        continue;
-                    }
-                    lifetime = object->uLifetime;
-                    if (pSpriteObjects[i].uAttributes & SPRITE_TEMPORARY) {
-                        lifetime = pSpriteObjects[i].tempLifetime;
-                    }
-                }
-                if (!(object->uFlags & OBJECT_DESC_TEMPORARY) ||
-                    pSpriteObjects[i].timeSinceCreated < lifetime) {
-                    if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
-                        SpriteObject::updateObjectBLV(i);
-                    } else {
-                        SpriteObject::updateObjectODM(i);
-                    }
-                    if (!pParty->bTurnBasedModeOn || !(object->uFlags & OBJECT_DESC_TEMPORARY)) {
-                        continue;
-                    }
-                    if ((pParty->pos - pSpriteObjects[i].vPosition).length() <= 5120) {
-                        continue;
-                    }
-                    // Temporary object in turn based mode that gets too far from party
-                    SpriteObject::OnInteraction(i);
-                    continue;
-                }
-                // Lifetime expired
-                if (!(object->uFlags & OBJECT_DESC_INTERACTABLE)) {
-                    SpriteObject::OnInteraction(i);
-                    continue;
-                }
-                processSpellImpact(i, Pid(OBJECT_Sprite, i));
+            lifetime = object->uLifetime;
+            if (pSpriteObjects[i].uAttributes & SPRITE_TEMPORARY) {
+                lifetime = pSpriteObjects[i].tempLifetime;
+            }
+        }
+        if (!(object->uFlags & OBJECT_DESC_TEMPORARY) ||
+            pSpriteObjects[i].timeSinceCreated < lifetime) {
+            if (uCurrentlyLoadedLevelType == LEVEL_INDOOR) {
+                SpriteObject::updateObjectBLV(i);
+            } else {
+                SpriteObject::updateObjectODM(i);
+            }
+            if (!pParty->bTurnBasedModeOn || !(object->uFlags & OBJECT_DESC_TEMPORARY)) {
+                return;
             }
+            if ((pParty->pos - pSpriteObjects[i].vPosition).length() <= 5120) {
+                return;
+            }
+            // Temporary object in turn based mode that gets too far from party
+            SpriteObject::OnInteraction(i);
+            return;
         }
+        // Lifetime expired
+        if (!(object->uFlags & OBJECT_DESC_INTERACTABLE)) {
+            SpriteObject::OnInteraction(i);
+            return;
+        }
+        processSpellImpact(i, Pid(OBJECT_Sprite, i));
+    }
+}
+
+void UpdateObjects() {
+    for (int i = spriteObjectSlots.nextLive(0); i < spriteObjectSlots.size(); i = spriteObjectSlots.nextLive(i + 1)) {
+        updateSpriteObject(i);
+
+        // Impacts might turn a just removed object into an explosion in the same slot, so re-sync the slot.
+        spriteObjectSlots.setLive(i, pSpriteObjects[i].uObjectDescID != 0);
     }
 }
 
@@ -1343,6 +1340,7 @@ unsigned int collideWithActor(unsigned int uLayingItemID, Pid pid) {
     unsigned int result = uLayingItemID;
     if (pObjectList->pObjects[pSpriteObjects[uLayingItemID].uObjectDescID].uFlags & OBJECT_DESC_UNPICKABLE) {
         result = processSpellImpact(uLayingItemID, pid);
+        spriteObjectSlots.setLive(uLayingItemID, pSpriteObjects[uLayingItemID].uObjectDescID != 0);
     }
     return result;
 }
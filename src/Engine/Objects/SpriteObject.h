@@ -4,6 +4,7 @@
 
 #include "Engine/Objects/Item.h"
 #include "Engine/Objects/SpriteEnums.h"
+#include "Engine/Objects/SpriteObjectSlots.h"
 #include "Engine/Objects/ActorEnums.h"
 #include "Engine/Spells/SpellEnums.h"
 #include "Engine/Pid.h"
@@ -94,6 +95,7 @@ struct SpriteObject {
 void CompactLayingItemsList();
 
 extern std::vector<SpriteObject> pSpriteObjects;
+extern SpriteObjectSlots spriteObjectSlots; // Occupancy of `pSpriteObjects`, see `SpriteObjectSlots`.
 
 /**
  * @offset 0x46BFFA
@@ -0,0 +1,72 @@
+#include "SpriteObjectSlots.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+#include "SpriteObject.h"
+
+void SpriteObjectSlots::rebuild(std::span<const SpriteObject> objects) {
+    clear();
+
+    _size = objects.size();
+    _live.resize((_size + 63) / 64);
+    for (int i = 0; i < _size; i++)
+        if (objects[i].uObjectDescID)
+            setLive(i, true);
+}
+
+void SpriteObjectSlots::clear() {
+    _size = 0;
+    _liveCount = 0;
+    _live.clear();
+}
+
+int SpriteObjectSlots::allocate(std::span<const SpriteObject> objects) {
+    assert(objects.size() == _size);
+
+    int slot = _size;
+    for (size_t i = 0; i < _live.size() && slot == _size; i++) {
+        while (~_live[i]) {
+            int candidate = std::min<int>(i * 64 + std::countr_zero(~_live[i]), _size);
+            if (candidate == _size || !objects[candidate].uObjectDescID) {
+                slot = candidate;
+                break;
+            }
+            setLive(candidate, true);
+        }
+    }
+
+    if (slot == _size) {
+        _size++;
+        _live.resize((_size + 63) / 64);
+    }
+
+    setLive(slot, true);
+    return slot;
+}
+
+void SpriteObjectSlots::setLive(int slot, bool live) {
+    assert(slot >= 0 && slot < _size);
+
+    if (isLive(slot) == live)
+        return;
+
+    _live[slot / 64] ^= uint64_t(1) << (slot % 64);
+    _liveCount += live ? 1 : -1;
+}
+
+int SpriteObjectSlots::nextLive(int slot) const {
+    if (slot >= _size)
+        return _size;
+
+    size_t word = slot / 64;
+    uint64_t bits = _live[word] & (~uint64_t(0) << (slot % 64));
+    while (!bits) {
+        if (++word == _live.size())
+            return _size;
+        bits = _live[word];
+    }
+
+    return word * 64 + std::countr_zero(bits);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+struct SpriteObject;
+
+/**
+ * Tracks which slots in `pSpriteObjects` are occupied, so that per-frame code doesn't have to wade through dead
+ * objects, and so that new objects don't have to scan the whole array for a free slot.
+ *
+ * Slot indices double as `Pid` ids and end up in saves, so objects never move between slots. Free slots are reused
+ * lowest-first, exactly like the original linear scan did, which keeps the slot assignment (and thus retraces)
+ * unchanged.
+ *
+ * Occupancy is stored as a bitmap, so both finding the next live slot and finding the lowest free slot boil down to
+ * a scan over 64-bit words.
+ */
+class SpriteObjectSlots {
+ public:
+    /**
+     * Rebuilds slot occupancy from scratch. Should be called every time `pSpriteObjects` is replaced wholesale.
+     *
+     * @param objects                   Sprite objects, slots with zero `uObjectDescID` are considered free.
+     */
+    void rebuild(std::span<const SpriteObject> objects);
+
+    void clear();
+
+    /**
+     * Marks the lowest free slot as live.
+     *
+     * Spell impacts can turn a just removed object into an explosion in the same slot without going through this
+     * class, so free slots are double-checked against the provided objects, and the ones that came back to life are
+     * skipped.
+     *
+     * @param objects                   Sprite objects, size must match `size()`.
+     * @return                          Allocated slot. Might be equal to the previous value of `size()`, in which case
+     *                                  the caller is expected to grow the storage.
+     */
+    [[nodiscard]] int allocate(std::span<const SpriteObject> objects);
+
+    /**
+     * Marks the provided slot as live or free. Does nothing if the slot is already in the requested state.
+     *
+     * @param slot                      Slot to update, must be less than `size()`.
+     * @param live                      Whether the slot is occupied.
+     */
+    void setLive(int slot, bool live);
+
+    [[nodiscard]] bool isLive(int slot) const {
+        return slot < _size && (_live[slot / 64] >> (slot % 64)) & 1;
+    }
+
+    /**
+     * @param slot                      Slot to start from.
+     * @return                          First live slot that's not less than `slot`, or `size()` if there is none.
+     */
+    [[nodiscard]] int nextLive(int slot) const;
+
+    /**
+     * @return                          Total number of slots, live or free.
+     */
+    [[nodiscard]] int size() const {
+        return _size;
+    }
+
+    [[nodiscard]] int liveCount() const {
+        return _liveCount;
+    }
+
+ private:
+    int _size = 0;
+    int _liveCount = 0;
+    std::vector<uint64_t> _live;
+};
@@ -0,0 +1,27 @@
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/ObjectGrid.h"
+#include "Engine/MapEnums.h"
+
+GAME_TEST(Actor, SelectTargetWithGrid) {
+    game.startNewGame();
+    game.teleportTo(MAP_HARMONDALE, Vec3f(-18000, 12500, 480), 0);
+    ASSERT_FALSE(pActors.empty());
+
+    std::vector<Vec3f> positions;
+    for (const Actor &actor : pActors)
+        positions.push_back(actor.pos);
+    ObjectGrid grid;
+    grid.build(positions);
+
+    // Grid is only an acceleration structure, selected targets must be the same as with a full scan.
+    for (int i = 0; i < pActors.size(); i++) {
+        Pid bruteForce, gridded;
+        Actor::_SelectTarget(i, &bruteForce, true);
+        Actor::_SelectTarget(i, &gridded, true, &grid);
+        EXPECT_EQ(gridded, bruteForce) << i;
+    }
+}
@@ -0,0 +1,76 @@
+#include <cstdint>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Objects/CharacterEnumFunctions.h"
+#include "Engine/Objects/CharacterStatsCache.h"
+#include "Engine/Engine.h"
+#include "Engine/EngineGlobals.h"
+#include "Engine/Party.h"
+
+#include "GUI/UI/UIPopup.h"
+#include "GUI/GUIWindow.h"
+
+static int64_t queryStats() {
+    int64_t sum = 0;
+    for (const Character &character : pParty->pCharacters) {
+        for (Attribute attr : allStatAttributes())
+            sum += character.GetActualStat(attr);
+        for (Attribute attr : {ATTRIBUTE_RESIST_FIRE, ATTRIBUTE_RESIST_AIR, ATTRIBUTE_RESIST_WATER,
+                               ATTRIBUTE_RESIST_EARTH, ATTRIBUTE_RESIST_MIND, ATTRIBUTE_RESIST_BODY})
+            sum += character.GetActualResistance(attr);
+        sum += character.GetActualAC() + character.GetActualAttack(false) + character.GetActualAttack(true);
+    }
+    return sum;
+}
+
+GAME_TEST(CharacterStatsCache, MatchesUncached) {
+    game.startNewGame();
+    if (pParty->activeCharacterIndex() != 1) {
+        game.pressGuiButton("Game_Character1");
+        game.tick(1);
+    }
+    game.pressGuiButton("Game_Character1"); // Opens up the character screen.
+    game.tick(1);
+    ASSERT_EQ(current_screen_type, SCREEN_CHARACTERS);
+
+    // Give everyone some buffs so that the stat getters have something to chew through.
+    Time expireTime = pParty->GetPlayingTime() + Duration::fromHours(1);
+    for (Character &character : pParty->pCharacters) {
+        character.pCharacterBuffs[CHARACTER_BUFF_BLESS].Apply(expireTime, MASTERY_MASTER, 5, 0, 0);
+        character.pCharacterBuffs[CHARACTER_BUFF_HEROISM].Apply(expireTime, MASTERY_MASTER, 5, 0, 0);
+        character.pCharacterBuffs[CHARACTER_BUFF_RESIST_FIRE].Apply(expireTime, MASTERY_MASTER, 5, 0, 0);
+    }
+
+    // In verify mode every cache hit is checked against the uncached value.
+    engine->config->debug.VerifyCharacterStatsCache.setValue(true);
+    characterStatsCache.resetStats();
+    pGUIWindow_CurrentMenu->Update();
+    GUIWindow popupWindow;
+    popupWindow.uFrameWidth = 400;
+    popupWindow.uFrameHeight = 200;
+    popupWindow.uFrameX = 38;
+    popupWindow.uFrameY = 60;
+    for (int i = 0; i < pParty->pCharacters.size(); i++)
+        GameUI_CharacterQuickRecord_Draw(&popupWindow, i);
+    EXPECT_GT(characterStatsCache.hits(), 0);
+    EXPECT_EQ(characterStatsCache.mismatches(), 0);
+    engine->config->debug.VerifyCharacterStatsCache.setValue(false);
+
+    // Caching is only active inside drawing scopes.
+    EXPECT_FALSE(characterStatsCache.isActive());
+    characterStatsCache.resetStats();
+    int64_t expectedSum = queryStats();
+    EXPECT_EQ(characterStatsCache.hits() + characterStatsCache.misses(), 0);
+
+    {
+        CharacterStatsCache::Scope statsScope;
+        EXPECT_TRUE(characterStatsCache.isActive());
+        EXPECT_EQ(queryStats(), expectedSum);
+        size_t misses = characterStatsCache.misses();
+        EXPECT_EQ(queryStats(), expectedSum);
+        EXPECT_EQ(characterStatsCache.misses(), misses); // Second sweep comes from the cache.
+        EXPECT_GT(characterStatsCache.hits(), 0);
+    }
+    EXPECT_FALSE(characterStatsCache.isActive());
+}
@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Objects/ObjectGrid.h"
+
+GAME_TEST(ObjectGrid, MatchesBruteForce) {
+    std::mt19937 gen(777);
+    std::uniform_real_distribution<float> coord(-40000.0f, 40000.0f); // Some objects are outside the grid.
+    std::uniform_real_distribution<float> size(0.0f, 12000.0f);
+
+    std::vector<Vec3f> positions;
+    for (int i = 0; i < 500; i++)
+        positions.push_back(Vec3f(coord(gen), coord(gen), coord(gen)));
+
+    ObjectGrid grid;
+    EXPECT_TRUE(grid.query(BBoxf::cubic(Vec3f(0, 0, 0), 100)).empty());
+    grid.build(positions);
+    EXPECT_EQ(grid.size(), positions.size());
+
+    for (int i = 0; i < 200; i++) {
+        BBoxf box = BBoxf::cubic(Vec3f(coord(gen), coord(gen), 0), size(gen));
+        std::span<const int> result = grid.query(box);
+        EXPECT_TRUE(std::is_sorted(result.begin(), result.end()));
+
+        for (int j = 0; j < positions.size(); j++)
+            if (box.containsXY(positions[j].x, positions[j].y))
+                EXPECT_TRUE(std::binary_search(result.begin(), result.end(), j));
+    }
+}
+
+GAME_TEST(ObjectGrid, BoxesMatchBruteForce) {
+    std::mt19937 gen(778);
+    std::uniform_real_distribution<float> coord(-40000.0f, 40000.0f);
+    std::uniform_real_distribution<float> size(0.0f, 3000.0f);
+
+    std::vector<BBoxf> boxes;
+    for (int i = 0; i < 500; i++)
+        boxes.push_back(BBoxf::cubic(Vec3f(coord(gen), coord(gen), 0), size(gen)));
+
+    ObjectGrid grid(512);
+    EXPECT_TRUE(grid.query(0, 0).empty());
+    grid.build(boxes);
+    EXPECT_EQ(grid.size(), boxes.size());
+
+    for (int i = 0; i < 200; i++) {
+        float x = coord(gen), y = coord(gen);
+        std::span<const int> points = grid.query(x, y);
+        EXPECT_TRUE(std::is_sorted(points.begin(), points.end()));
+
+        BBoxf box = BBoxf::cubic(Vec3f(x, y, 0), size(gen));
+        std::span<const int> result = grid.query(box);
+        EXPECT_TRUE(std::is_sorted(result.begin(), result.end()));
+        EXPECT_TRUE(std::adjacent_find(result.begin(), result.end()) == result.end());
+
+        for (int j = 0; j < boxes.size(); j++) {
+            if (boxes[j].containsXY(x, y))
+                EXPECT_TRUE(std::binary_search(points.begin(), points.end(), j));
+            if (box.intersects(boxes[j]))
+                EXPECT_TRUE(std::binary_search(result.begin(), result.end(), j));
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Objects/SpriteObject.h"
+#include "Engine/Objects/SpriteObjectSlots.h"
+
+GAME_TEST(SpriteObjectSlots, Allocate) {
+    std::vector<SpriteObject> objects;
+    SpriteObjectSlots slots;
+
+    // Slots are handed out lowest-first, and new ones are appended at the end.
+    for (int i = 0; i < 130; i++) {
+        EXPECT_EQ(slots.allocate(objects), i);
+        objects.emplace_back().uObjectDescID = 1;
+    }
+    EXPECT_EQ(slots.size(), 130);
+    EXPECT_EQ(slots.liveCount(), 130);
+
+    for (int slot : {100, 5, 70}) {
+        objects[slot].uObjectDescID = 0;
+        slots.setLive(slot, false);
+    }
+    EXPECT_EQ(slots.liveCount(), 127);
+    EXPECT_FALSE(slots.isLive(5));
+    EXPECT_EQ(slots.allocate(objects), 5);
+    objects[5].uObjectDescID = 1;
+
+    // Slot 70 was brought back to life behind our back, so it should be skipped.
+    objects[70].uObjectDescID = 1;
+    EXPECT_EQ(slots.allocate(objects), 100);
+    EXPECT_TRUE(slots.isLive(70));
+    EXPECT_EQ(slots.allocate(objects), 130);
+    EXPECT_EQ(slots.size(), 131);
+    EXPECT_EQ(slots.liveCount(), 131);
+}
+
+GAME_TEST(SpriteObjectSlots, Iterate) {
+    std::vector<SpriteObject> objects(200);
+    for (int slot : {0, 3, 63, 64, 65, 199})
+        objects[slot].uObjectDescID = 1;
+
+    SpriteObjectSlots slots;
+    slots.rebuild(objects);
+    EXPECT_EQ(slots.size(), 200);
+    EXPECT_EQ(slots.liveCount(), 6);
+
+    std::vector<int> live;
+    for (int i = slots.nextLive(0); i < slots.size(); i = slots.nextLive(i + 1))
+        live.push_back(i);
+    EXPECT_EQ(live, std::vector<int>({0, 3, 63, 64, 65, 199}));
+    EXPECT_EQ(slots.nextLive(66), 199);
+    EXPECT_EQ(slots.nextLive(200), 200);
+
+    slots.setLive(199, false);
+    EXPECT_EQ(slots.nextLive(66), 200);
+
+    slots.clear();
+    EXPECT_EQ(slots.size(), 0);
+    EXPECT_EQ(slots.nextLive(0), 0);
+}
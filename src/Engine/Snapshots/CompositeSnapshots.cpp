@@ -251,6 +251,7 @@ void reconstruct(const IndoorDelta_MM7 &src, IndoorLocation *dst) {
             pSpriteObjects[i].uObjectDescID = pObjectList->ObjectIDByItemID(pSpriteObjects[i].uType);
         }
     }
+    spriteObjectSlots.rebuild(pSpriteObjects);
 
     vChests.resize(src.chests.size());
     for (size_t i = 0; i < src.chests.size(); ++i)
@@ -562,6 +563,7 @@ void reconstruct(const OutdoorDelta_MM7 &src, OutdoorLocation *dst) {
         pActors[i].id = i;
 
     reconstruct(src.spriteObjects, &pSpriteObjects);
+    spriteObjectSlots.rebuild(pSpriteObjects);
 
     vChests.resize(src.chests.size());
     for (size_t i = 0; i < src.chests.size(); ++i)
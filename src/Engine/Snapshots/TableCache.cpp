@@ -0,0 +1,309 @@
+#include "TableCache.h"
+
+#include <cassert>
+#include <array>
+#include <exception>
+#include <memory>
+#include <ranges>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "Engine/Objects/Monsters.h"
+#include "Engine/Spells/Spells.h"
+#include "Engine/Tables/ItemTable.h"
+#include "Engine/Tables/NPCTable.h"
+#include "Engine/MapInfo.h"
+
+#include "Library/Binary/BinarySerialization.h"
+#include "Library/FileSystem/Interface/FileSystem.h"
+#include "Library/Logger/Logger.h"
+
+#include "Utility/Streams/BlobOutputStream.h"
+#include "Utility/Streams/MemoryInputStream.h"
+#include "Utility/String/Format.h"
+
+namespace {
+
+struct TableCacheHeader {
+    std::array<char, 8> signature;
+    uint32_t sourceHash;
+    uint32_t tableSize; // sizeof() of the cached type, catches most of the layout changes.
+};
+static_assert(sizeof(TableCacheHeader) == 16);
+
+// Bump the version when changing the format or the set of serialized fields.
+constexpr std::array<char, 8> SIGNATURE = {{'O', 'E', 'T', 'B', 'L', 'C', '0', '2'}};
+
+} // namespace
+
+MM_DECLARE_MEMCOPY_SERIALIZABLE(TableCacheHeader)
+
+namespace {
+
+//
+// Table fields.
+//
+// Tables are written field by field, and the fields are listed below. Strings are written with a size prefix,
+// trivially copyable fields (including arrays of trivially copyable types) are written with a single `memcpy`, and
+// the rest is handled recursively. Functions are templated on constness so that the same list is used for both
+// reading & writing.
+//
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, MonsterInfo>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.name, src.textureName, src.level, src.treasureDropChance, src.treasureLevel, src.treasureType,
+             src.goldDiceRolls, src.goldDiceSides, src.flying, src.movementType, src.aiType, src.hostilityType,
+             src.specialAttackType, src.specialAttackLevel, src.attack1Type, src.attack1DamageDiceRolls,
+             src.attack1DamageDiceSides, src.attack1DamageBonus, src.attack1MissileType, src.attack2Chance,
+             src.attack2Type, src.attack2DamageDiceRolls, src.attack2DamageDiceSides, src.attack2DamageBonus,
+             src.attack2MissileType, src.spell1UseChance, src.spell1Id, src.spell1SkillMastery, src.spell2UseChance,
+             src.spell2Id, src.spell2SkillMastery, src.resFire, src.resAir, src.resWater, src.resEarth, src.resMind,
+             src.resSpirit, src.resBody, src.resLight, src.resDark, src.resPhysical, src.specialAbilityType,
+             src.specialAbilityDamageDiceRolls, src.specialAbilityDamageDiceSides, src.specialAbilityDamageDiceBonus,
+             src.numCharactersAttackedPerSpecialAbility, src.id, src.bloodSplatOnDeath,
+             src.field_3C_some_special_attack, src.field_3E, src.hp, src.ac, src.exp, src.baseSpeed,
+             src.recoveryTime, src.attackPreferences);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, MonsterStats>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.infos, src.uniqueNames);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, SpellInfo>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.name, src.pShortName, src.pDescription, src.pBasicSkillDesc, src.pExpertSkillDesc,
+             src.pMasterSkillDesc, src.pGrandmasterSkillDesc, src.damageType, src.field_20, src.flags);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, SpellStats>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.pInfos);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, MapInfo>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.name, src.fileName, src.encounter1MonsterTexture, src.encounter2MonsterTexture,
+             src.encounter3MonsterTexture, src.numResets, src.firstVisitedAt, src.respawnIntervalDays, src.alertDays,
+             src.baseStealingFine, src.perceptionDifficulty, src.field_2C, src.disarmDifficulty,
+             src.trapDamageD20DiceCount, src.mapTreasureLevel, src.encounterChance, src.encounter1Chance,
+             src.encounter2Chance, src.encounter3Chance, src.Dif_M1, src.encounter1MinCount, src.encounter1MaxCount,
+             src.Dif_M2, src.encounter2MinCount, src.encounter2MaxCount, src.Dif_M3, src.encounter3MinCount,
+             src.encounter3MaxCount, src.field_3D, src.field_3E, src.field_3F, src.musicId, src.uEAXEnv, src.field_42,
+             src.field_43);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, MapStats>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.pInfos);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, ItemData>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.iconName, src.name, src.unidentifiedName, src.description, src.baseValue, src.spriteId,
+             src.paperdollAnchorOffset, src.type, src.skill, src.damageDice, src.damageRoll, src.damageMod,
+             src.reagentPower, src.rarity, src.specialEnchantment, src.standardEnchantment,
+             src.standardEnchantmentStrength, src.uChanceByTreasureLvl, src.identifyAndRepairDifficulty);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, StandardEnchantmentData>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.attributeName, src.itemSuffix, src.chanceByItemType);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, SpecialEnchantmentData>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.description, src.itemSuffixOrPrefix, src.chanceByItemType, src.additionalValue, src.iTreasureLevel);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, ItemTable>
+void forEachField(T &src, Callback &&callback) {
+    // Item sizes are not here as these are loaded separately, from icons.lod.
+    callback(src.items, src.standardEnchantments, src.specialEnchantments, src.potionCombination, src.potionNotes,
+             src.itemChanceSumByTreasureLevel, src.standardEnchantmentChanceForEquipment,
+             src.specialEnchantmentChanceForEquipment, src.specialEnchantmentChanceForWeapons,
+             src.standardEnchantmentChanceSumByItemType, src.standardEnchantmentRangeByTreasureLevel);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, NPCData>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.name, src.uPortraitID, src.uFlags, src.fame, src.rep, src.Location2D, src.profession, src.greet,
+             src.is_joinable, src.field_24, src.dialogue_1_evt_id, src.dialogue_2_evt_id, src.dialogue_3_evt_id,
+             src.dialogue_4_evt_id, src.dialogue_5_evt_id, src.dialogue_6_evt_id, src.uSex, src.bHasUsedTheAbility,
+             src.news_topic);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, NPCProfession>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.uHirePrice, src.pBenefits, src.pActionText, src.pJoinText, src.pDismissText);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, NPCGreeting>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.pGreeting1, src.pGreeting2);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, NPCTopic>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.pTopic, src.pText);
+}
+
+template<class T, class Callback> requires std::same_as<std::remove_const_t<T>, NPCStats>
+void forEachField(T &src, Callback &&callback) {
+    callback(src.pOriginalNPCData, src.pNPCData, src.pNPCNames, src.pProfessions, src.pAdditionalNPC,
+             src.pCatchPhrases, src.pNPCUnicNames, src.pProfessionChance, src.field_17884, src.field_17888,
+             src.pNPCGreetings, src.pOriginalGroups, src.pGroups, src.uNewlNPCBufPos, src.uNumNewNPCs,
+             src.field_17FC8, src.uNumNPCProfessions, src.uNumNPCNames);
+}
+
+//
+// Serialization.
+//
+
+template<class T>
+void writeField(const T &src, OutputStream *dst) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        dst->write(&src, sizeof(T));
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        serialize(src, dst);
+    } else if constexpr (std::ranges::range<T>) {
+        for (const auto &element : src)
+            writeField(element, dst);
+    } else {
+        forEachField(src, [&](const auto &... fields) { (writeField(fields, dst), ...); });
+    }
+}
+
+template<class T>
+void readField(InputStream &src, T *dst) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        size_t bytes = src.read(dst, sizeof(T));
+        if (bytes != sizeof(T))
+            throwBinarySerializationNoMoreDataError(bytes, sizeof(T), typeid(T).name());
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        deserialize(src, dst);
+    } else if constexpr (std::ranges::range<T>) {
+        for (auto &element : *dst)
+            readField(src, &element);
+    } else {
+        forEachField(*dst, [&](auto &... fields) { (readField(src, &fields), ...); });
+    }
+}
+
+} // namespace
+
+TableCache::TableCache(FileSystem *fs, uint32_t sourceHash, std::string_view root) : _fs(fs), _sourceHash(sourceHash), _root(root) {
+    assert(fs);
+}
+
+TableCache::~TableCache() = default;
+
+void TableCache::readEntries() {
+    _entries.clear();
+
+    try {
+        if (!_fs->exists(_root))
+            return;
+
+        for (const DirectoryEntry &entry : _fs->ls(_root)) {
+            if (entry.type != FILE_REGULAR || !entry.name.ends_with(".bin"))
+                continue;
+
+            std::string name = entry.name.substr(0, entry.name.size() - 4);
+            try {
+                _entries[name] = _fs->read(makePath(name));
+            } catch (const std::exception &e) {
+                logger->warning("Could not read table cache entry '{}': {}", makePath(name), e.what());
+            }
+        }
+    } catch (const std::exception &e) {
+        logger->warning("Could not list table cache folder '{}': {}", _root, e.what());
+    }
+}
+
+void TableCache::flush() {
+    std::unordered_map<std::string, Blob> pendingEntries;
+    {
+        std::lock_guard lock(_pendingMutex);
+        pendingEntries = std::move(_pendingEntries);
+        _pendingEntries.clear();
+    }
+
+    for (const auto &[name, data] : pendingEntries) {
+        std::string path = makePath(name);
+        try {
+            _fs->write(path, data);
+        } catch (const std::exception &e) {
+            logger->warning("Could not write table cache entry '{}': {}", path, e.what());
+        }
+    }
+}
+
+template<class T>
+bool TableCache::load(std::string_view name, T *table) {
+    std::string path = makePath(name);
+
+    try {
+        auto pos = _entries.find(std::string(name));
+        if (pos == _entries.end()) {
+            _misses++;
+            return false;
+        }
+        const Blob &data = pos->second;
+
+        MemoryInputStream stream(data.data(), data.size());
+        TableCacheHeader header;
+        deserialize(stream, &header);
+        if (header.signature != SIGNATURE || header.sourceHash != _sourceHash || header.tableSize != sizeof(T)) {
+            _misses++;
+            return false;
+        }
+
+        // Read into a temporary so that the output is left untouched if the entry turns out to be truncated.
+        std::unique_ptr<T> result = std::make_unique<T>();
+        readField(stream, result.get());
+        *table = std::move(*result);
+        _hits++;
+        return true;
+    } catch (const std::exception &e) {
+        logger->warning("Could not read table cache entry '{}': {}", path, e.what());
+        _misses++;
+        return false;
+    }
+}
+
+template<class T>
+void TableCache::store(std::string_view name, const T &table) {
+    TableCacheHeader header;
+    header.signature = SIGNATURE;
+    header.sourceHash = _sourceHash;
+    header.tableSize = sizeof(T);
+
+    Blob data;
+    BlobOutputStream stream(&data);
+    serialize(header, &stream);
+    writeField(table, &stream);
+    stream.close();
+
+    std::lock_guard lock(_pendingMutex);
+    _pendingEntries[std::string(name)] = std::move(data);
+}
+
+std::string TableCache::makePath(std::string_view name) const {
+    return fmt::format("{}/{}.bin", _root, name);
+}
+
+template bool TableCache::load(std::string_view, MonsterStats *);
+template bool TableCache::load(std::string_view, SpellStats *);
+template bool TableCache::load(std::string_view, MapStats *);
+template bool TableCache::load(std::string_view, ItemTable *);
+template bool TableCache::load(std::string_view, NPCStats *);
+template bool TableCache::load(std::string_view, std::array<NPCTopic, 789> *);
+template void TableCache::store(std::string_view, const MonsterStats &);
+template void TableCache::store(std::string_view, const SpellStats &);
+template void TableCache::store(std::string_view, const MapStats &);
+template void TableCache::store(std::string_view, const ItemTable &);
+template void TableCache::store(std::string_view, const NPCStats &);
+template void TableCache::store(std::string_view, const std::array<NPCTopic, 789> &);
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Utility/Memory/Blob.h"
+
+class FileSystem;
+struct ItemTable;
+struct MapStats;
+struct MonsterStats;
+struct NPCStats;
+struct NPCTopic;
+struct SpellStats;
+
+/**
+ * Persistent cache of fully constructed data tables, stored in a file system (normally `ufs`).
+ *
+ * Text tables from `events.lod` are parsed on every startup, and parsing them takes a noticeable share of the startup
+ * time. This class stores the parsed tables in a binary form that can be read back with a handful of `memcpy` calls.
+ *
+ * All entries are keyed by the CRC-32 of the source LOD, so the whole cache is invalidated automatically when the LOD
+ * changes. Each entry also stores the in-memory size of the cached type, which catches most of the layout changes,
+ * but the version in the signature still has to be bumped when the set of cached fields changes.
+ *
+ * File system access is split from (de)serialization so that the former can stay on the main thread. `readEntries` and
+ * `flush` are the only methods that touch the file system. `load` and `store` work in memory and can be called from
+ * several threads concurrently, but not concurrently with `readEntries` or `flush`.
+ */
+class TableCache {
+ public:
+    /**
+     * @param fs                        File system to store the cache in.
+     * @param sourceHash                Hash of the source data for all of the cached tables, e.g. CRC-32 of the LOD
+     *                                  file that the tables are read from.
+     * @param root                      Root folder for the cache files inside `fs`.
+     */
+    TableCache(FileSystem *fs, uint32_t sourceHash, std::string_view root = "cache/tables");
+    ~TableCache();
+
+    /**
+     * Reads all cache entries from the file system into memory. Errors are logged and otherwise ignored.
+     */
+    void readEntries();
+
+    /**
+     * Writes all the entries added with `store` since the last call to the file system. Errors are logged and
+     * otherwise ignored.
+     */
+    void flush();
+
+    /**
+     * @param name                      Name of the cache entry, e.g. `"monsters"`.
+     * @param[out] table                Table to load. Left untouched if `false` is returned.
+     * @return                          Whether the cache entry was read by `readEntries` & is up to date.
+     */
+    template<class T>
+    bool load(std::string_view name, T *table);
+
+    /**
+     * Serializes the provided table. The entry is written to the file system on the next call to `flush`.
+     *
+     * @param name                      Name of the cache entry.
+     * @param table                     Table to store.
+     */
+    template<class T>
+    void store(std::string_view name, const T &table);
+
+    /**
+     * @return                          Number of entries read by `readEntries`.
+     */
+    [[nodiscard]] size_t size() const {
+        return _entries.size();
+    }
+
+    [[nodiscard]] size_t hits() const {
+        return _hits;
+    }
+
+    [[nodiscard]] size_t misses() const {
+        return _misses;
+    }
+
+ private:
+    [[nodiscard]] std::string makePath(std::string_view name) const;
+
+ private:
+    FileSystem *_fs = nullptr;
+    uint32_t _sourceHash = 0;
+    std::string _root;
+    std::unordered_map<std::string, Blob> _entries; // Read by readEntries, only read from after that.
+    std::mutex _pendingMutex;
+    std::unordered_map<std::string, Blob> _pendingEntries; // Added by store, written by flush.
+    std::atomic<size_t> _hits = 0;
+    std::atomic<size_t> _misses = 0;
+};
+
+// Only these are supported.
+extern template bool TableCache::load(std::string_view, MonsterStats *);
+extern template bool TableCache::load(std::string_view, SpellStats *);
+extern template bool TableCache::load(std::string_view, MapStats *);
+extern template bool TableCache::load(std::string_view, ItemTable *);
+extern template bool TableCache::load(std::string_view, NPCStats *);
+extern template bool TableCache::load(std::string_view, std::array<NPCTopic, 789> *);
+extern template void TableCache::store(std::string_view, const MonsterStats &);
+extern template void TableCache::store(std::string_view, const SpellStats &);
+extern template void TableCache::store(std::string_view, const MapStats &);
+extern template void TableCache::store(std::string_view, const ItemTable &);
+extern template void TableCache::store(std::string_view, const NPCStats &);
+extern template void TableCache::store(std::string_view, const std::array<NPCTopic, 789> &);
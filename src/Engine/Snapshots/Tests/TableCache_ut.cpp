@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Objects/Monsters.h"
+#include "Engine/Snapshots/TableCache.h"
+#include "Engine/Spells/Spells.h"
+#include "Engine/Tables/ItemTable.h"
+#include "Engine/Tables/NPCTable.h"
+#include "Engine/Engine.h"
+#include "Engine/MapInfo.h"
+
+#include "Library/FileSystem/Memory/MemoryFileSystem.h"
+
+GAME_TEST(TableCache, RoundTrip) {
+    MemoryFileSystem fs("memfs");
+    TableCache cache(&fs, 0x12345678);
+
+    auto monsterStats = std::make_unique<MonsterStats>();
+    EXPECT_FALSE(cache.load("monsters", monsterStats.get()));
+    EXPECT_EQ(cache.misses(), 1);
+
+    // Stored entries are only visible after a flush & re-read.
+    cache.store("monsters", *pMonsterStats);
+    cache.store("items", *pItemTable);
+    cache.store("npcs", *pNPCStats);
+    cache.store("spells", *pSpellStats);
+    cache.store("mapstats", *pMapStats);
+    EXPECT_FALSE(cache.load("monsters", monsterStats.get()));
+    EXPECT_FALSE(fs.exists("cache/tables/monsters.bin"));
+    cache.flush();
+    EXPECT_TRUE(fs.exists("cache/tables/monsters.bin"));
+    cache.readEntries();
+
+    EXPECT_TRUE(cache.load("monsters", monsterStats.get()));
+    EXPECT_EQ(cache.hits(), 1);
+    for (MonsterId id : pMonsterStats->infos.indices()) {
+        const MonsterInfo &l = monsterStats->infos[id];
+        const MonsterInfo &r = pMonsterStats->infos[id];
+        EXPECT_EQ(l.name, r.name);
+        EXPECT_EQ(l.textureName, r.textureName);
+        EXPECT_EQ(l.hp, r.hp);
+        EXPECT_EQ(l.treasureType, r.treasureType);
+        EXPECT_EQ(l.spell2SkillMastery, r.spell2SkillMastery);
+        EXPECT_EQ(l.recoveryTime, r.recoveryTime);
+        EXPECT_EQ(l.attackPreferences, r.attackPreferences);
+    }
+    EXPECT_EQ(monsterStats->uniqueNames, pMonsterStats->uniqueNames);
+
+    auto itemTable = std::make_unique<ItemTable>();
+    EXPECT_TRUE(cache.load("items", itemTable.get()));
+    for (ItemId id : pItemTable->items.indices()) {
+        EXPECT_EQ(itemTable->items[id].name, pItemTable->items[id].name);
+        EXPECT_EQ(itemTable->items[id].standardEnchantment, pItemTable->items[id].standardEnchantment);
+        EXPECT_EQ(itemTable->items[id].uChanceByTreasureLvl, pItemTable->items[id].uChanceByTreasureLvl);
+    }
+    EXPECT_EQ(itemTable->potionCombination, pItemTable->potionCombination);
+
+    auto npcStats = std::make_unique<NPCStats>();
+    EXPECT_TRUE(cache.load("npcs", npcStats.get()));
+    for (size_t i = 0; i < pNPCStats->pOriginalNPCData.size(); i++) {
+        EXPECT_EQ(npcStats->pOriginalNPCData[i].name, pNPCStats->pOriginalNPCData[i].name);
+        EXPECT_EQ(npcStats->pOriginalNPCData[i].profession, pNPCStats->pOriginalNPCData[i].profession);
+    }
+    EXPECT_EQ(npcStats->pNPCNames, pNPCStats->pNPCNames);
+    EXPECT_EQ(npcStats->uNumNPCNames, pNPCStats->uNumNPCNames);
+
+    auto spellStats = std::make_unique<SpellStats>();
+    EXPECT_TRUE(cache.load("spells", spellStats.get()));
+    for (SpellId id : pSpellStats->pInfos.indices())
+        EXPECT_EQ(spellStats->pInfos[id].pDescription, pSpellStats->pInfos[id].pDescription);
+
+    auto mapStats = std::make_unique<MapStats>();
+    EXPECT_TRUE(cache.load("mapstats", mapStats.get()));
+    for (MapId id : pMapStats->pInfos.indices()) {
+        EXPECT_EQ(mapStats->pInfos[id].fileName, pMapStats->pInfos[id].fileName);
+        EXPECT_EQ(mapStats->pInfos[id].encounter3MaxCount, pMapStats->pInfos[id].encounter3MaxCount);
+    }
+}
+
+GAME_TEST(TableCache, Invalidation) {
+    MemoryFileSystem fs("memfs");
+    TableCache cache(&fs, 0x12345678);
+    cache.store("spells", *pSpellStats);
+    cache.flush();
+    cache.readEntries();
+
+    // Different source hash invalidates the whole cache.
+    auto spellStats = std::make_unique<SpellStats>();
+    TableCache otherCache(&fs, 0x87654321);
+    otherCache.readEntries();
+    EXPECT_FALSE(otherCache.load("spells", spellStats.get()));
+
+    // Entries are typed.
+    auto mapStats = std::make_unique<MapStats>();
+    EXPECT_FALSE(cache.load("spells", mapStats.get()));
+
+    // Truncated entries are not loaded, and the output is left untouched.
+    Blob data = fs.read("cache/tables/spells.bin");
+    fs.write("cache/tables/spells.bin", data.subBlob(0, data.size() / 2));
+    cache.readEntries();
+    EXPECT_FALSE(cache.load("spells", spellStats.get()));
+    EXPECT_TRUE(spellStats->pInfos[SPELL_FIRE_FIREBALL].name.empty());
+    EXPECT_EQ(cache.hits(), 0);
+    EXPECT_EQ(cache.misses(), 2);
+}
+
+GAME_TEST(TableCache, SpellFlags) {
+    MemoryFileSystem fs("memfs");
+    TableCache cache(&fs, 0x12345678);
+    cache.store("spells", *pSpellStats);
+    cache.flush();
+    cache.readEntries();
+
+    // Flags in spells.txt are not all empty, so there is something to check.
+    EXPECT_TRUE(std::ranges::any_of(pSpellDatas, [](const SpellData &data) { return data.flags != SpellFlags(); }));
+
+    // Simulate a cold start that takes the cache hit path, i.e. flags in pSpellDatas are not initialized.
+    auto savedSpellDatas = pSpellDatas;
+    for (SpellData &data : pSpellDatas)
+        data.flags = SpellFlags();
+
+    auto spellStats = std::make_unique<SpellStats>();
+    EXPECT_TRUE(cache.load("spells", spellStats.get()));
+    spellStats->applySpellDataFlags();
+
+    for (SpellId id : pSpellDatas.indices())
+        EXPECT_EQ(pSpellDatas[id].flags, savedSpellDatas[id].flags);
+    pSpellDatas = std::move(savedSpellDatas);
+}
+
+// Run by the Run_GameTest_TableCache target, which starts the game test twice with an empty table cache folder.
+GAME_TEST(TableCache, DISABLED_Startup) {
+    const TableCacheStats &stats = engine->_tableCacheStats;
+    ASSERT_GT(stats.hits + stats.misses, 0) << "Table cache is disabled, pass --table-cache-path to enable it.";
+
+    if (stats.entries == 0) {
+        EXPECT_EQ(stats.hits, 0); // First start, all tables are parsed & stored.
+    } else {
+        EXPECT_EQ(stats.misses, 0); // Second start, all tables come from the cache.
+        EXPECT_EQ(stats.hits, stats.entries);
+    }
+}
@@ -1,15 +1,16 @@
 #include "Engine/Spells/Spells.h"
 
-#include <cstring>
 #include <algorithm>
 #include <map>
 #include <string>
+#include <string_view>
 
 #include "Engine/Party.h"
 #include "Engine/Graphics/Indoor.h"
 #include "Engine/Graphics/Overlays.h"
 #include "Engine/Random/Random.h"
 #include "Engine/Objects/Actor.h"
+#include "Engine/Objects/CharacterStatsCache.h"
 #include "Engine/Objects/ObjectList.h"
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/SpellFxRenderer.h"
@@ -18,9 +19,10 @@
 
 #include "Media/Audio/AudioPlayer.h"
 
+#include "Library/Tsv/TsvReader.h"
+
 #include "Utility/Math/TrigLut.h"
 #include "Utility/String/Ascii.h"
-#include "Utility/String/Split.h"
 #include "Utility/String/Transformations.h"
 #include "Utility/MapAccess.h"
 
@@ -439,6 +441,7 @@ void SpellBuff::Reset() {
     expireTime = Time();
     caster = 0;
     isGMBuff = false;
+    characterStatsCache.invalidate();
     if (overlayID) {
         pActiveOverlayList->pOverlays[overlayID - 1].Reset();
         overlayID = 0;
@@ -451,6 +454,7 @@ bool SpellBuff::IsBuffExpiredToTime(Time time) {
         power = 0;
         skillMastery = MASTERY_NONE;
         overlayID = 0;
+        characterStatsCache.invalidate();
         return true;
     }
     return false;
@@ -475,6 +479,7 @@ bool SpellBuff::Apply(Time expire_time, Mastery uSkillMastery,
     }
     this->overlayID = uOverlayID;
     this->caster = caster;
+    characterStatsCache.invalidate();
 
     return true;
 }
@@ -492,34 +497,38 @@ void SpellStats::Initialize(const Blob &spells) {
     spellSchoolMaps["dark"] = DAMAGE_DARK;
     spellSchoolMaps["magic"] = DAMAGE_MAGIC;
 
-    char *test_string;
-
-    std::string txtRaw(spells.string_view());
-
-    strtok(txtRaw.data(), "\r");
+    TsvReader tsv(spells);
+    tsv.skipLines(1);
     for (SpellId uSpellID : allRegularSpells()) {
         if (((std::to_underlying(uSpellID) % 11) - 1) == 0) {
-            strtok(NULL, "\r");
+            tsv.skipLines(1);
         }
-        test_string = strtok(NULL, "\r") + 1;
-
-        auto tokens = tokenize(test_string, '\t');
-
-        pInfos[uSpellID].name = removeQuotes(tokens[2]);
-        pInfos[uSpellID].damageType = valueOr(spellSchoolMaps, tokens[3], DAMAGE_PHYSICAL);
-        pInfos[uSpellID].pShortName = removeQuotes(tokens[4]);
-        pInfos[uSpellID].pDescription = removeQuotes(tokens[5]);
-        pInfos[uSpellID].pBasicSkillDesc = removeQuotes(tokens[6]);
-        pInfos[uSpellID].pExpertSkillDesc = removeQuotes(tokens[7]);
-        pInfos[uSpellID].pMasterSkillDesc = removeQuotes(tokens[8]);
-        pInfos[uSpellID].pGrandmasterSkillDesc = removeQuotes(tokens[9]);
-        pSpellDatas[uSpellID].flags |= strchr(tokens[10], 'm') || strchr(tokens[10], 'M') ? SPELL_CASTABLE_BY_MONSTER : SpellFlag();
-        pSpellDatas[uSpellID].flags |= strchr(tokens[10], 'e') || strchr(tokens[10], 'E') ? SPELL_CASTABLE_BY_EVENT : SpellFlag();
-        pSpellDatas[uSpellID].flags |= strchr(tokens[10], 'c') || strchr(tokens[10], 'C') ? SPELL_SHIFT_CLICK_CASTABLE : SpellFlag();
-        pSpellDatas[uSpellID].flags |= strchr(tokens[10], 'x') || strchr(tokens[10], 'X') ? SPELL_FLAG_8 : SpellFlag();
+        tsv.readLine();
+
+        pInfos[uSpellID].name = removeQuotes(tsv.field(2));
+        pInfos[uSpellID].damageType = valueOr(spellSchoolMaps, tsv.field(3), DAMAGE_PHYSICAL);
+        pInfos[uSpellID].pShortName = removeQuotes(tsv.field(4));
+        pInfos[uSpellID].pDescription = removeQuotes(tsv.field(5));
+        pInfos[uSpellID].pBasicSkillDesc = removeQuotes(tsv.field(6));
+        pInfos[uSpellID].pExpertSkillDesc = removeQuotes(tsv.field(7));
+        pInfos[uSpellID].pMasterSkillDesc = removeQuotes(tsv.field(8));
+        pInfos[uSpellID].pGrandmasterSkillDesc = removeQuotes(tsv.field(9));
+
+        std::string_view flagString = tsv.field(10);
+        auto hasFlag = [&](std::string_view chars) { return flagString.find_first_of(chars) != std::string_view::npos; };
+        pInfos[uSpellID].flags = SpellFlags();
+        pInfos[uSpellID].flags |= hasFlag("mM") ? SPELL_CASTABLE_BY_MONSTER : SpellFlag();
+        pInfos[uSpellID].flags |= hasFlag("eE") ? SPELL_CASTABLE_BY_EVENT : SpellFlag();
+        pInfos[uSpellID].flags |= hasFlag("cC") ? SPELL_SHIFT_CLICK_CASTABLE : SpellFlag();
+        pInfos[uSpellID].flags |= hasFlag("xX") ? SPELL_FLAG_8 : SpellFlag();
     }
 }
 
+void SpellStats::applySpellDataFlags() const {
+    for (SpellId uSpellID : allRegularSpells())
+        pSpellDatas[uSpellID].flags |= pInfos[uSpellID].flags;
+}
+
 void eventCastSpell(SpellId uSpellID, Mastery skillMastery, int skillLevel, Vec3f from, Vec3f to) {
     // For bug catching
     assert(skillMastery >= MASTERY_NOVICE && skillMastery <= MASTERY_GRANDMASTER);
@@ -26,6 +26,7 @@ struct SpellInfo {
     std::string pGrandmasterSkillDesc;
     DamageType damageType;
     int field_20;
+    SpellFlags flags; // Flags from spells.txt, applied to `pSpellDatas` by `SpellStats::applySpellDataFlags`.
 };
 
 struct SpellStats {
@@ -34,6 +35,12 @@ struct SpellStats {
      */
     void Initialize(const Blob &spells);
 
+    /**
+     * Merges the flags loaded from `spells.txt` into the global `pSpellDatas`. Should be called once the table is
+     * loaded, whether it was parsed or read from the table cache.
+     */
+    void applySpellDataFlags() const;
+
     IndexedArray<SpellInfo, SPELL_FIRST_REGULAR, SPELL_LAST_REGULAR> pInfos;
 };
 
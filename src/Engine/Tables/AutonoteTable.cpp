@@ -1,7 +1,9 @@
 #include "AutonoteTable.h"
 
-#include <cstring>
 #include <string>
+#include <string_view>
+
+#include "Library/Tsv/TsvReader.h"
 
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Ascii.h"
@@ -9,67 +11,30 @@
 
 std::array<AutonoteData, 196> pAutonoteTxt;
 
-void initializeAutonotes(const Blob &autonotes) {
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+static AutonoteType parseAutonoteType(std::string_view type) {
+    if (ascii::noCaseEquals(type, "potion"))
+        return AUTONOTE_POTION_RECIPE;
+    if (ascii::noCaseEquals(type, "stat"))
+        return AUTONOTE_STAT_HINT;
+    if (ascii::noCaseEquals(type, "seer"))
+        return AUTONOTE_SEER;
+    if (ascii::noCaseEquals(type, "obelisk"))
+        return AUTONOTE_OBELISK;
+    if (ascii::noCaseEquals(type, "teacher"))
+        return AUTONOTE_TEACHER;
+    return AUTONOTE_MISC;
+}
 
-    std::string txtRaw(autonotes.string_view());
-    strtok(txtRaw.data(), "\r");
+void initializeAutonotes(const Blob &autonotes) {
+    TsvReader tsv(autonotes);
+    tsv.skipLines(1);
 
     for (int i = 1; i < pAutonoteTxt.size(); ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                switch (decode_step) {
-                    case 1:
-                        pAutonoteTxt[i].pText = removeQuotes(test_string);
-                        break;
-                    case 2: {
-                        if (ascii::noCaseEquals(test_string, "potion")) {
-                            pAutonoteTxt[i].eType = AUTONOTE_POTION_RECIPE;
-                            break;
-                        }
-                        if (ascii::noCaseEquals(test_string, "stat")) {
-                            pAutonoteTxt[i].eType = AUTONOTE_STAT_HINT;
-                            break;
-                        }
-                        if (ascii::noCaseEquals(test_string, "seer")) {
-                            pAutonoteTxt[i].eType = AUTONOTE_SEER;
-                            break;
-                        }
-                        if (ascii::noCaseEquals(test_string, "obelisk")) {
-                            pAutonoteTxt[i].eType = AUTONOTE_OBELISK;
-                            break;
-                        }
-                        if (ascii::noCaseEquals(test_string, "teacher")) {
-                            pAutonoteTxt[i].eType = AUTONOTE_TEACHER;
-                            break;
-                        }
-                        pAutonoteTxt[i].eType = AUTONOTE_MISC;
-                        break;
-                    }
-                }
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 3) && !break_loop);
+        tsv.readLine();
+        size_t fieldCount = tsv.leadingFieldCount(3);
+        if (fieldCount > 1)
+            pAutonoteTxt[i].pText = removeQuotes(tsv.field(1));
+        if (fieldCount > 2)
+            pAutonoteTxt[i].eType = parseAutonoteType(tsv.field(2));
     }
 }
-
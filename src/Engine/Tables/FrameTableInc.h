@@ -1,12 +1,22 @@
 #pragma once
 
 struct FrameTableTxtLine {  // 7C
-    int uPropCount;
-    const char *pProperties[30];
-};
+    FrameTableTxtLine() = default;
+    FrameTableTxtLine(const FrameTableTxtLine &) = delete; // Properties point into the buffer below.
+    FrameTableTxtLine &operator=(const FrameTableTxtLine &) = delete;
 
-FrameTableTxtLine *txt_file_frametable_parser(const char *str_to_parse,
-                                              FrameTableTxtLine *tokens_table);
+    int uPropCount = 0;
+    const char *pProperties[30] = {};
+    char buffer[1000] = {};
+};
 
-FrameTableTxtLine *frame_table_txt_parser(const char *pString,
-                                          FrameTableTxtLine *a2);
+/**
+ * Splits the provided string into words separated by spaces, commas or tabs. Words can be grouped with double quotes.
+ *
+ * This function is reentrant, parsed words are stored in the provided `FrameTableTxtLine`.
+ *
+ * @param str_to_parse                  String to parse.
+ * @param tokens_table                  Output table.
+ * @return                              `tokens_table`.
+ */
+FrameTableTxtLine *frame_table_txt_parser(const char *str_to_parse, FrameTableTxtLine *tokens_table);
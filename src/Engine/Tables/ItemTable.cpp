@@ -1,9 +1,9 @@
 #include "ItemTable.h"
 
-#include <cstring>
+#include <algorithm>
 #include <map>
-#include <vector>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include "Engine/Random/Random.h"
@@ -18,16 +18,24 @@
 
 #include "Library/LodFormats/LodFormats.h"
 #include "Library/Logger/Logger.h"
+#include "Library/Tsv/TsvReader.h"
 
 #include "Utility/String/Ascii.h"
 #include "Utility/MapAccess.h"
 #include "Utility/String/Transformations.h"
-#include "Utility/String/Split.h"
 
-static void strtokSkipLines(int n) {
-    for (int i = 0; i < n; ++i) {
-        (void)strtok(NULL, "\r");
-    }
+static char firstChar(std::string_view s) {
+    return s.empty() ? '\0' : s[0];
+}
+
+/**
+ * Positions the reader at the first line of the potion table, which starts with potion id 222.
+ */
+static bool skipToPotionTable(TsvReader *tsv) {
+    while (tsv->tryReadLine())
+        if (tsv->field(0) == "222")
+            return true;
+    return false;
 }
 
 //----- (00456D84) --------------------------------------------------------
@@ -77,96 +85,88 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
     materialMap["relic"] = RARITY_RELIC;
     materialMap["special"] = RARITY_SPECIAL;
 
-    char *lineContent;
-
     LoadPotions(resourceManager->getEventsFile("potion.txt"));
     LoadPotionNotes(resourceManager->getEventsFile("potnotes.txt"));
 
-    std::string txtRaw;
-
-    txtRaw = resourceManager->getEventsFile("stditems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
-    strtokSkipLines(3);
+    Blob stdItemsTxt = resourceManager->getEventsFile("stditems.txt");
+    TsvReader tsv(stdItemsTxt);
+    tsv.skipLines(4);
     // Standard Bonuses by Group
     standardEnchantmentChanceSumByItemType.fill(0);
+    standardEnchantmentChanceSumByItemType.fill(0);
     for (Attribute i : allEnchantableAttributes()) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
-        standardEnchantments[i].attributeName = removeQuotes(tokens[0]);
-        standardEnchantments[i].itemSuffix = removeQuotes(tokens[1]);
+        tsv.readLine();
+        standardEnchantments[i].attributeName = removeQuotes(tsv.field(0));
+        standardEnchantments[i].itemSuffix = removeQuotes(tsv.field(1));
 
         int k = 2;
         for (ItemType equipType : standardEnchantments[i].chanceByItemType.indices()) {
-            standardEnchantments[i].chanceByItemType[equipType] = atoi(tokens[k++]);
+            standardEnchantments[i].chanceByItemType[equipType] = tsv.intField(k++);
             standardEnchantmentChanceSumByItemType[equipType] += standardEnchantments[i].chanceByItemType[equipType];
         }
     }
 
     // Bonus range for Standard by Level
-    strtokSkipLines(5);
+    tsv.skipLines(5);
     for (ItemTreasureLevel i : standardEnchantmentRangeByTreasureLevel.indices()) {  // counted from 1
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
-        assert(tokens.size() == 4 && "Invalid number of tokens");
-        standardEnchantmentRangeByTreasureLevel[i] = Segment(atoi(tokens[2]), atoi(tokens[3]));
+        tsv.readLine();
+        assert(tsv.fieldCount() == 4 && "Invalid number of tokens");
+        standardEnchantmentRangeByTreasureLevel[i] = Segment(tsv.intField(2), tsv.intField(3));
     }
 
-    txtRaw = resourceManager->getEventsFile("spcitems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
-    strtokSkipLines(3);
+    Blob spcItemsTxt = resourceManager->getEventsFile("spcitems.txt");
+    tsv = TsvReader(spcItemsTxt);
+    tsv.skipLines(4);
     for (ItemEnchantment i : specialEnchantments.indices()) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
-        assert(tokens.size() >= 17 && "Invalid number of tokens");
-        specialEnchantments[i].description = removeQuotes(tokens[0]);
-        specialEnchantments[i].itemSuffixOrPrefix = removeQuotes(tokens[1]);
+        tsv.readLine();
+        specialEnchantments[i].description = removeQuotes(tsv.field(0));
+        specialEnchantments[i].itemSuffixOrPrefix = removeQuotes(tsv.field(1));
 
         int k = 2;
         for (ItemType j : specialEnchantments[i].chanceByItemType.indices())
-            specialEnchantments[i].chanceByItemType[j] = atoi(tokens[k++]);
+            specialEnchantments[i].chanceByItemType[j] = tsv.intField(k++);
 
-        int res = atoi(tokens[14]);
+        std::string_view value = tsv.field(14);
+        int res = TsvReader::toInt(value);
         int mask = 0;
         if (!res) {
-            ++tokens[14];
-            while (*tokens[14] == ' ')  // fix X 2 case
-                ++tokens[14];
-            res = atoi(tokens[14]);
+            res = TsvReader::toInt(value.substr(std::min<size_t>(value.size(), 1)));  // fix X 2 case
             mask = 4;  // bit encode for when we need to multiply value
         }
         specialEnchantments[i].additionalValue = res;
-        specialEnchantments[i].iTreasureLevel = (tolower(tokens[15][0]) - 'a') | mask;
+        specialEnchantments[i].iTreasureLevel = (tolower(firstChar(tsv.field(15))) - 'a') | mask;
     }
 
-    txtRaw = resourceManager->getEventsFile("items.txt").string_view();
-    strtok(txtRaw.data(), "\r");
-    strtokSkipLines(1);
+    Blob itemsTxt = resourceManager->getEventsFile("items.txt");
+    tsv = TsvReader(itemsTxt);
+    tsv.skipLines(2);
     for (size_t line = 0; line < 799; line++) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
-
-        ItemId item_counter = ItemId(atoi(tokens[0]));
-        items[item_counter].iconName = removeQuotes(tokens[1]);
-        items[item_counter].name = removeQuotes(tokens[2]);
-        items[item_counter].baseValue = atoi(tokens[3]);
-        items[item_counter].type = valueOr(equipStatMap, tokens[4], ITEM_TYPE_NONE);
-        items[item_counter].skill = valueOr(equipSkillMap, tokens[5], SKILL_MISC);
-        auto diceRollTokens = tokenize(tokens[6], 'd');
-        if (diceRollTokens.size() == 2) {
-            items[item_counter].damageDice = atoi(diceRollTokens[0]);
-            items[item_counter].damageRoll = atoi(diceRollTokens[1]);
-        } else if (tolower(diceRollTokens[0][0]) != 's') {
-            items[item_counter].damageDice = atoi(diceRollTokens[0]);
+        tsv.readLine();
+
+        ItemId item_counter = ItemId(tsv.intField(0));
+        items[item_counter].iconName = removeQuotes(tsv.field(1));
+        items[item_counter].name = removeQuotes(tsv.field(2));
+        items[item_counter].baseValue = tsv.intField(3);
+        items[item_counter].type = valueOr(equipStatMap, tsv.field(4), ITEM_TYPE_NONE);
+        items[item_counter].skill = valueOr(equipSkillMap, tsv.field(5), SKILL_MISC);
+        std::string_view diceRoll = tsv.field(6);
+        size_t diceSeparator = diceRoll.find('d');
+        std::string_view diceCount = diceRoll.substr(0, diceSeparator);
+        if (diceSeparator != std::string_view::npos && diceRoll.find('d', diceSeparator + 1) == std::string_view::npos) {
+            items[item_counter].damageDice = TsvReader::toInt(diceCount);
+            items[item_counter].damageRoll = TsvReader::toInt(diceRoll.substr(diceSeparator + 1));
+        } else if (tolower(firstChar(diceCount)) != 's') {
+            items[item_counter].damageDice = TsvReader::toInt(diceCount);
             items[item_counter].damageRoll = 1;
         } else {
             items[item_counter].damageDice = 0;
             items[item_counter].damageRoll = 0;
         }
-        items[item_counter].damageMod = atoi(tokens[7]);
-        items[item_counter].rarity = valueOr(materialMap, tokens[8], RARITY_COMMON);
-        items[item_counter].identifyAndRepairDifficulty = atoi(tokens[9]);
-        items[item_counter].unidentifiedName = removeQuotes(tokens[10]);
-        items[item_counter].spriteId = static_cast<SpriteId>(atoi(tokens[11]));
+        items[item_counter].damageMod = tsv.intField(7);
+        items[item_counter].rarity = valueOr(materialMap, tsv.field(8), RARITY_COMMON);
+        items[item_counter].identifyAndRepairDifficulty = tsv.intField(9);
+        items[item_counter].unidentifiedName = removeQuotes(tsv.field(10));
+        items[item_counter].spriteId = static_cast<SpriteId>(tsv.intField(11));
 
         if (items[item_counter].type == ITEM_TYPE_REAGENT) {
             items[item_counter].reagentPower = items[item_counter].damageDice;
@@ -177,14 +177,14 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
         items[item_counter].standardEnchantment = {};
         if (items[item_counter].rarity == RARITY_SPECIAL) {
             for (Attribute ii : allEnchantableAttributes()) {
-                if (ascii::noCaseEquals(tokens[12], standardEnchantments[ii].itemSuffix)) { // TODO(captainurist): #unicode this is not ascii
+                if (ascii::noCaseEquals(tsv.field(12), standardEnchantments[ii].itemSuffix)) { // TODO(captainurist): #unicode this is not ascii
                     items[item_counter].standardEnchantment = ii;
                     break;
                 }
             }
             if (!items[item_counter].standardEnchantment) {
                 for (ItemEnchantment ii : specialEnchantments.indices()) {
-                    if (ascii::noCaseEquals(tokens[12], specialEnchantments[ii].itemSuffixOrPrefix)) { // TODO(captainurist): #unicode this is not ascii
+                    if (ascii::noCaseEquals(tsv.field(12), specialEnchantments[ii].itemSuffixOrPrefix)) { // TODO(captainurist): #unicode this is not ascii
                         items[item_counter].specialEnchantment = ii;
                     }
                 }
@@ -193,7 +193,7 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
 
         if ((items[item_counter].rarity == RARITY_SPECIAL) &&
             (items[item_counter].standardEnchantment)) {
-            char b_s = atoi(tokens[13]);
+            char b_s = tsv.intField(13);
             if (b_s)
                 items[item_counter].standardEnchantmentStrength = b_s;
             else
@@ -201,26 +201,24 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
         } else {
             items[item_counter].standardEnchantmentStrength = 0;
         }
-        items[item_counter].paperdollAnchorOffset.x = atoi(tokens[14]);
-        items[item_counter].paperdollAnchorOffset.y = atoi(tokens[15]);
-        items[item_counter].description = removeQuotes(tokens[16]);
+        items[item_counter].paperdollAnchorOffset.x = tsv.intField(14);
+        items[item_counter].paperdollAnchorOffset.y = tsv.intField(15);
+        items[item_counter].description = removeQuotes(tsv.field(16));
     }
 
-    txtRaw = resourceManager->getEventsFile("rnditems.txt").string_view();
-    strtok(txtRaw.data(), "\r");
-    strtokSkipLines(3);
+    Blob rndItemsTxt = resourceManager->getEventsFile("rnditems.txt");
+    tsv = TsvReader(rndItemsTxt);
+    tsv.skipLines(4);
     for(size_t line = 0; line < 618; line++) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
-        assert(tokens.size() > 7 && "Invalid number of tokens");
-
-        ItemId item_counter = ItemId(atoi(tokens[0]));
-        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_1] = atoi(tokens[2]);
-        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_2] = atoi(tokens[3]);
-        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_3] = atoi(tokens[4]);
-        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_4] = atoi(tokens[5]);
-        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_5] = atoi(tokens[6]);
-        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_6] = atoi(tokens[7]);
+        tsv.readLine();
+
+        ItemId item_counter = ItemId(tsv.intField(0));
+        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_1] = tsv.intField(2);
+        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_2] = tsv.intField(3);
+        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_3] = tsv.intField(4);
+        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_4] = tsv.intField(5);
+        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_5] = tsv.intField(6);
+        items[item_counter].uChanceByTreasureLvl[ITEM_TREASURE_LEVEL_6] = tsv.intField(7);
     }
 
     // ChanceByTreasureLvl Summ - to calculate chance
@@ -229,127 +227,92 @@ void ItemTable::Initialize(GameResourceManager *resourceManager) {
         for (ItemId j : items.indices())
             itemChanceSumByTreasureLevel[i] += items[j].uChanceByTreasureLvl[i];
 
-    strtokSkipLines(5);
+    tsv.skipLines(5);
     for (int i = 0; i < 3; ++i) {
-        lineContent = strtok(NULL, "\r") + 1;
-        auto tokens = tokenize(lineContent, '\t');
-        assert(tokens.size() > 7 && "Invalid number of tokens");
+        tsv.readLine();
         switch (i) {
             case 0:
-                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_1] = atoi(tokens[2]);
-                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_2] = atoi(tokens[3]);
-                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_3] = atoi(tokens[4]);
-                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_4] = atoi(tokens[5]);
-                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_5] = atoi(tokens[6]);
-                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_6] = atoi(tokens[7]);
+                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_1] = tsv.intField(2);
+                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_2] = tsv.intField(3);
+                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_3] = tsv.intField(4);
+                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_4] = tsv.intField(5);
+                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_5] = tsv.intField(6);
+                standardEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_6] = tsv.intField(7);
                 break;
             case 1:
-                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_1] = atoi(tokens[2]);
-                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_2] = atoi(tokens[3]);
-                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_3] = atoi(tokens[4]);
-                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_4] = atoi(tokens[5]);
-                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_5] = atoi(tokens[6]);
-                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_6] = atoi(tokens[7]);
+                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_1] = tsv.intField(2);
+                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_2] = tsv.intField(3);
+                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_3] = tsv.intField(4);
+                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_4] = tsv.intField(5);
+                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_5] = tsv.intField(6);
+                specialEnchantmentChanceForEquipment[ITEM_TREASURE_LEVEL_6] = tsv.intField(7);
                 break;
             case 2:
-                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_1] = atoi(tokens[2]);
-                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_2] = atoi(tokens[3]);
-                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_3] = atoi(tokens[4]);
-                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_4] = atoi(tokens[5]);
-                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_5] = atoi(tokens[6]);
-                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_6] = atoi(tokens[7]);
+                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_1] = tsv.intField(2);
+                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_2] = tsv.intField(3);
+                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_3] = tsv.intField(4);
+                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_4] = tsv.intField(5);
+                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_5] = tsv.intField(6);
+                specialEnchantmentChanceForWeapons[ITEM_TREASURE_LEVEL_6] = tsv.intField(7);
                 break;
         }
     }
 
-    Item::PopulateSpecialBonusMap();
-    Item::PopulateArtifactBonusMap();
-    LoadItemSizes();
-
     // Patch up the data - we want wetsuits to be armor.
     items[ITEM_QUEST_WETSUIT].type = ITEM_TYPE_ARMOUR;
 }
 
 //----- (00453B3C) --------------------------------------------------------
 void ItemTable::LoadPotions(const Blob &potions) {
-    //    char Text[90];
-    char *test_string;
-    ItemId potion_value;
-
-    std::vector<char *> tokens;
-    std::string txtRaw(potions.string_view());
-    test_string = strtok(txtRaw.data(), "\r") + 1;
-    while (test_string) {
-        tokens = tokenize(test_string, '\t');
-        if (!strcmp(tokens[0], "222")) break;
-        test_string = strtok(NULL, "\r") + 1;
-    }
-    if (!test_string) {
+    TsvReader tsv(potions);
+    if (!skipToPotionTable(&tsv)) {
         logger->error("Error Pre-Parsing Potion Table");
         return;
     }
 
     for (ItemId row : Segment(ITEM_FIRST_REAL_POTION, ITEM_LAST_REAL_POTION)) {
-        if (tokens.size() < 50) {
-            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), tokens.size());
+        if (row != ITEM_FIRST_REAL_POTION && !tsv.tryReadLine()) {
+            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), 0);
+            return;
+        }
+        if (tsv.fieldCount() < 50) {
+            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), tsv.fieldCount());
             return;
         }
         for (ItemId column : Segment(ITEM_FIRST_REAL_POTION, ITEM_LAST_REAL_POTION)) {
             int flatPotionId = std::to_underlying(column) - std::to_underlying(ITEM_FIRST_REAL_POTION);
-            char *currValue = tokens[flatPotionId + 7];
-            potion_value = static_cast<ItemId>(atoi(currValue));
-            if (potion_value == ITEM_NULL && currValue[0] == 'E') {
+            std::string_view currValue = tsv.field(flatPotionId + 7);
+            ItemId potion_value = static_cast<ItemId>(TsvReader::toInt(currValue));
+            if (potion_value == ITEM_NULL && currValue.starts_with('E')) {
                 // values like "E{x}" represent damage level {x} when using invalid potion combination
-                potion_value = static_cast<ItemId>(atoi(currValue + 1));
+                potion_value = static_cast<ItemId>(TsvReader::toInt(currValue.substr(1)));
             }
             this->potionCombination[row][column] = potion_value;
         }
-
-        test_string = strtok(NULL, "\r") + 1;
-        if (!test_string) {
-            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row), 0);
-            return;
-        }
-        tokens = tokenize(test_string, '\t');
     }
 }
 
 //----- (00453CE5) --------------------------------------------------------
 void ItemTable::LoadPotionNotes(const Blob &potionNotes) {
-    //  char Text[90];
-    char *test_string;
-    uint8_t potion_note;
-
-    std::vector<char *> tokens;
-    std::string txtRaw(potionNotes.string_view());
-    test_string = strtok(txtRaw.data(), "\r") + 1;
-    while (test_string) {
-        tokens = tokenize(test_string, '\t');
-        if (!strcmp(tokens[0], "222")) break;
-        test_string = strtok(NULL, "\r") + 1;
-    }
-    if (!test_string) {
+    TsvReader tsv(potionNotes);
+    if (!skipToPotionTable(&tsv)) {
         logger->error("Error Pre-Parsing Potion Table");
         return;
     }
 
     for (ItemId row : Segment(ITEM_FIRST_REAL_POTION, ITEM_LAST_REAL_POTION)) {
-        if (tokens.size() < 50) {
-            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row), tokens.size());
+        if (row != ITEM_FIRST_REAL_POTION && !tsv.tryReadLine()) {
+            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), 0);
+            return;
+        }
+        if (tsv.fieldCount() < 50) {
+            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row), tsv.fieldCount());
             return;
         }
         for (ItemId column : Segment(ITEM_FIRST_REAL_POTION, ITEM_LAST_REAL_POTION)) {
             int flatPotionId = std::to_underlying(column) - std::to_underlying(ITEM_FIRST_REAL_POTION);
-            char *currValue = tokens[flatPotionId + 7];
-            this->potionNotes[row][column] = atoi(currValue);
-        }
-
-        test_string = strtok(NULL, "\r") + 1;
-        if (!test_string) {
-            logger->error("Error Parsing Potion Table at Row: {} Column: {}", std::to_underlying(row) - std::to_underlying(ITEM_FIRST_REAL_POTION), 0);
-            return;
+            this->potionNotes[row][column] = tsv.intField(flatPotionId + 7);
         }
-        tokens = tokenize(test_string, '\t');
     }
 }
 
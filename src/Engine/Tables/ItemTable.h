@@ -19,7 +19,7 @@ struct ItemTable {
     void Initialize(GameResourceManager *resourceManager);
     void LoadPotions(const Blob &potions);
     void LoadPotionNotes(const Blob &potionNotes);
-    void LoadItemSizes();
+    void LoadItemSizes(); // Reads from `dfs`, so unlike `Initialize` has to be called from the main thread.
 
     /**
      * @offset 0x456620
@@ -1,7 +1,8 @@
 #include "NPCTable.h"
 
-#include <cstring>
+#include <algorithm>
 #include <string>
+#include <string_view>
 
 #include "Engine/Objects/NPC.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
@@ -9,6 +10,8 @@
 #include "Engine/GameResourceManager.h"
 #include "Engine/Random/Random.h"
 
+#include "Library/Tsv/TsvReader.h"
+
 #include "Utility/String/Transformations.h"
 
 std::array<NPCTopic, 789> pNPCTopics;
@@ -19,118 +22,38 @@ int NPCStats::dword_AE3370_LastMispronouncedNameResult = -1;
 
 //----- (00476977) --------------------------------------------------------
 void NPCStats::InitializeNPCText(const Blob &npcText) {
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-
-    std::string txtRaw(npcText.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    for (i = 0; i < 789; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if (decode_step == 1)
-                    pNPCTopics[i].pText = removeQuotes(test_string);
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+    TsvReader tsv(npcText);
+    tsv.skipLines(1);
+
+    for (int i = 0; i < 789; ++i) {
+        tsv.readLine();
+        if (tsv.leadingFieldCount(2) > 1)
+            pNPCTopics[i].pText = removeQuotes(tsv.field(1));
     }
 }
 
 void NPCStats::InitializeNPCTopics(const Blob &npcTopics) {
-    std::string txtRaw(npcTopics.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+    TsvReader tsv(npcTopics);
+    tsv.skipLines(1);
 
     for (int i = 1; i <= 579; ++i) {  // NPC topics count limit
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if (decode_step == 1)
-                    pNPCTopics[i].pTopic = removeQuotes(test_string);
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        tsv.readLine();
+        if (tsv.leadingFieldCount(2) > 1)
+            pNPCTopics[i].pTopic = removeQuotes(tsv.field(1));
     }
 }
 
 void NPCStats::InitializeNPCDist(const Blob &npcDist) {
-    std::string txtRaw(npcDist.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+    TsvReader tsv(npcDist);
+    tsv.skipLines(2);
 
     for (int i = 1; i < 59; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if ((decode_step > 0) && (decode_step < 77)) {
-                    pProfessionChance[decode_step].professionChancePerArea[i] = atoi(test_string);
-                } else if (decode_step == 0) {
-                    pProfessionChance[0].professionChancePerArea[i] = 10;
-                }
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 78) && !break_loop);
+        tsv.readLine();
+        size_t fieldCount = tsv.leadingFieldCount(77);
+        if (fieldCount > 0)
+            pProfessionChance[0].professionChancePerArea[i] = 10;
+        for (size_t column = 1; column < fieldCount; column++)
+            pProfessionChance[column].professionChancePerArea[i] = tsv.intField(column);
     }
 
     for (int i = 0; i < 77; ++i) {
@@ -156,189 +79,93 @@ void NPCStats::setNPCNamesOnLoad() {
 
 //----- (00476CB5) --------------------------------------------------------
 void NPCStats::InitializeNPCData(const Blob &npcData) {
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-
-    std::string txtRaw(npcData.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-
-    for (i = 0; i < 500; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
+    TsvReader tsv(npcData);
+    tsv.skipLines(2);
+
+    for (int i = 0; i < 500; ++i) {
+        tsv.readLine();
+        size_t fieldCount = std::min<size_t>(tsv.fieldCount(), 16);
+        for (size_t column = 0; column < fieldCount; column++) {
+            std::string_view field = tsv.field(column);
+            if (field.empty())
+                continue;
+
+            switch (column) {
+                case 1:
+                    pNPCUnicNames[i] = removeQuotes(field);
+                    pOriginalNPCData[i + 1].name = pNPCUnicNames[i];
+                    break;
+                case 2:
+                    pOriginalNPCData[i + 1].uPortraitID = TsvReader::toInt(field);
+                    break;
+                case 6:
+                    pOriginalNPCData[i + 1].Location2D = static_cast<HouseId>(TsvReader::toInt(field));
+                    break;
+                case 7:
+                    pOriginalNPCData[i + 1].profession = static_cast<NpcProfession>(TsvReader::toInt(field));
+                    break;
+                case 8:
+                    pOriginalNPCData[i + 1].greet = TsvReader::toInt(field);
+                    break;
+                case 9:
+                    pOriginalNPCData[i + 1].is_joinable = (field[0] == 'y') ? 1 : 0;
+                    break;
+                case 10:
+                    pOriginalNPCData[i + 1].dialogue_1_evt_id = TsvReader::toInt(field);
+                    break;
+                case 11:
+                    pOriginalNPCData[i + 1].dialogue_2_evt_id = TsvReader::toInt(field);
+                    break;
+                case 12:
+                    pOriginalNPCData[i + 1].dialogue_3_evt_id = TsvReader::toInt(field);
+                    break;
+                case 13:
+                    pOriginalNPCData[i + 1].dialogue_4_evt_id = TsvReader::toInt(field);
+                    break;
+                case 14:
+                    pOriginalNPCData[i + 1].dialogue_5_evt_id = TsvReader::toInt(field);
+                    break;
+                case 15:
+                    pOriginalNPCData[i + 1].dialogue_6_evt_id = TsvReader::toInt(field);
+                    break;
             }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {  // i+1
-                switch (decode_step) {
-                    case 1:
-                        pNPCUnicNames[i] = removeQuotes(test_string);
-                        pOriginalNPCData[i + 1].name = pNPCUnicNames[i];
-                        break;
-                    case 2:
-                        pOriginalNPCData[i + 1].uPortraitID = atoi(test_string);
-                        break;
-                    case 6:
-                        pOriginalNPCData[i + 1].Location2D = static_cast<HouseId>(atoi(test_string));
-                        break;
-                    case 7:
-                        pOriginalNPCData[i + 1].profession = static_cast<NpcProfession>(atoi(test_string));
-                        break;
-                    case 8:
-                        pOriginalNPCData[i + 1].greet = atoi(test_string);
-                        break;
-                    case 9:
-                        pOriginalNPCData[i + 1].is_joinable = (*test_string == 'y') ? 1 : 0;
-                        break;
-                    case 10:
-                        pOriginalNPCData[i + 1].dialogue_1_evt_id = atoi(test_string);
-                        break;
-                    case 11:
-                        pOriginalNPCData[i + 1].dialogue_2_evt_id = atoi(test_string);
-                        break;
-                    case 12:
-                        pOriginalNPCData[i + 1].dialogue_3_evt_id = atoi(test_string);
-                        break;
-                    case 13:
-                        pOriginalNPCData[i + 1].dialogue_4_evt_id = atoi(test_string);
-                        break;
-                    case 14:
-                        pOriginalNPCData[i + 1].dialogue_5_evt_id = atoi(test_string);
-                        break;
-                    case 15:
-                        pOriginalNPCData[i + 1].dialogue_6_evt_id = atoi(test_string);
-                        break;
-                }
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 16) && !break_loop);
+        }
     }
     uNumNewNPCs = 501;
 }
 
 void NPCStats::InitializeNPCGreets(const Blob &npcGreets) {
-    std::string txtRaw(npcGreets.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+    TsvReader tsv(npcGreets);
+    tsv.skipLines(1);
 
     for (int i = 1; i <= 205; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {  // i+1
-                switch (decode_step) {
-                    case 1:
-                        pNPCGreetings[i].pGreeting1 = removeQuotes(test_string);
-                        break;
-                    case 2:
-                        pNPCGreetings[i].pGreeting2 = removeQuotes(test_string);
-                        break;
-                }
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 3) && !break_loop);
+        tsv.readLine();
+        if (tsv.fieldCount() > 1 && !tsv.field(1).empty())
+            pNPCGreetings[i].pGreeting1 = removeQuotes(tsv.field(1));
+        if (tsv.fieldCount() > 2 && !tsv.field(2).empty())
+            pNPCGreetings[i].pGreeting2 = removeQuotes(tsv.field(2));
     }
 }
 
 void NPCStats::InitializeNPCGroups(const Blob &npcGroups) {
-    std::string txtRaw(npcGroups.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+    TsvReader tsv(npcGroups);
+    tsv.skipLines(1);
 
     for (int i = 0; i < 51; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {  // i+1
-                if (decode_step == 1) {
-                    pOriginalGroups[i] = atoi(test_string);
-                }
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        tsv.readLine();
+        if (tsv.fieldCount() > 1 && !tsv.field(1).empty())
+            pOriginalGroups[i] = tsv.intField(1);
     }
 }
 
 void NPCStats::InitializeNPCNews(const Blob &npcNews) {
-    std::string txtRaw(npcNews.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
+    TsvReader tsv(npcNews);
+    tsv.skipLines(1);
 
     for (int i = 0; i < 51; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {  // i+1
-                if (decode_step == 1)
-                    pCatchPhrases[i] = removeQuotes(test_string);
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        tsv.readLine();
+        if (tsv.fieldCount() > 1 && !tsv.field(1).empty())
+            pCatchPhrases[i] = removeQuotes(tsv.field(1));
     }
 }
 
@@ -357,111 +184,61 @@ void NPCStats::Initialize(GameResourceManager *resourceManager) {
 }
 
 void NPCStats::InitializeNPCNames(const Blob &npcNames) {
-    std::string txtRaw(npcNames.string_view());
-    strtok(txtRaw.data(), "\r");
-
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos = nullptr;
-    int decode_step;
+    TsvReader tsv(npcNames);
+    tsv.skipLines(1);
 
     uNewlNPCBufPos = 0;
 
+    int i;
     for (i = 0; i < 540; ++i) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            if (c == '\t') {
-                if ((decode_step == 1) && (!uNumNPCNames[SEX_FEMALE]))
-                    uNumNPCNames[SEX_FEMALE] = i;
-            } else {
-                while ((c != '\n') && (c != '\t') && (c > 0)) {
-                    ++temp_str_len;
-                    c = test_string[temp_str_len];
-                }
-                tmp_pos = test_string + temp_str_len;
-                if (*tmp_pos == 0) break_loop = true;
-
-                if (temp_str_len) {
-                    *tmp_pos = 0;
-                    if (decode_step == 0)
-                        pNPCNames[i][SEX_MALE] = removeQuotes(test_string);
-                    else if (decode_step == 1)
-                        pNPCNames[i][SEX_FEMALE] = removeQuotes(test_string);
-                } else {
-                    if ((decode_step == 1) && (!uNumNPCNames[SEX_FEMALE]))
-                        uNumNPCNames[SEX_FEMALE] = i;
-                }
+        tsv.readLine();
+        if (!tsv.field(0).empty())
+            pNPCNames[i][SEX_MALE] = removeQuotes(tsv.field(0));
+
+        // Lines w/o a tab don't affect the female name count, this is consistent with the original parser.
+        if (tsv.fieldCount() > 1) {
+            if (!tsv.field(1).empty()) {
+                pNPCNames[i][SEX_FEMALE] = removeQuotes(tsv.field(1));
+            } else if (!uNumNPCNames[SEX_FEMALE]) {
+                uNumNPCNames[SEX_FEMALE] = i;
             }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        }
     }
     uNumNPCNames[SEX_MALE] = i;
 }
 
 void NPCStats::InitializeNPCProfs(const Blob &npcProfs) {
-    std::string txtRaw(npcProfs.string_view());
-    strtok(txtRaw.data(), "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-    strtok(NULL, "\r");
-
-    int i;
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos = nullptr;
-    int decode_step;
+    TsvReader tsv(npcProfs);
+    tsv.skipLines(4);
 
     for (NpcProfession i : Segment(NPC_PROFESSION_FIRST_VALID, NPC_PROFESSION_LAST_VALID)) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            // while (*test_string == '\t')  // some steps are separated by
-            // multiple \t's
-            // ++test_string;
-
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                switch (decode_step) {
-                    case 2:
-                        pProfessions[i].uHirePrice = atoi(test_string);
-                        break;
-                    case 3:
-                        pProfessions[i].pActionText = removeQuotes(test_string);
-                        break;
-                    case 4:
-                        pProfessions[i].pBenefits = removeQuotes(test_string);
-                        break;
-                    case 5:
-                        pProfessions[i].pJoinText = removeQuotes(test_string);
-                        break;
-                    case 6:
-                        pProfessions[i].pDismissText = removeQuotes(test_string);
-                }
-            } else {
-                if (!decode_step) break_loop = true;
+        tsv.readLine();
+        if (tsv.field(0).empty())
+            continue;
+
+        size_t fieldCount = std::min<size_t>(tsv.fieldCount(), 7);
+        for (size_t column = 1; column < fieldCount; column++) {
+            std::string_view field = tsv.field(column);
+            if (field.empty())
+                continue;
+
+            switch (column) {
+                case 2:
+                    pProfessions[i].uHirePrice = TsvReader::toInt(field);
+                    break;
+                case 3:
+                    pProfessions[i].pActionText = removeQuotes(field);
+                    break;
+                case 4:
+                    pProfessions[i].pBenefits = removeQuotes(field);
+                    break;
+                case 5:
+                    pProfessions[i].pJoinText = removeQuotes(field);
+                    break;
+                case 6:
+                    pProfessions[i].pDismissText = removeQuotes(field);
             }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 7) && !break_loop);
+        }
     }
     uNumNPCProfessions = 59;
 }
@@ -1,47 +1,21 @@
 #include "QuestTable.h"
 
-#include <cstring>
 #include <string>
 
+#include "Library/Tsv/TsvReader.h"
+
 #include "Utility/Memory/Blob.h"
 #include "Utility/String/Transformations.h"
 
 IndexedArray<std::string, QBIT_FIRST, QBIT_LAST> pQuestTable;
 
 void initializeQuests(const Blob &quests) {
-    char *test_string;
-    unsigned char c;
-    bool break_loop;
-    unsigned int temp_str_len;
-    char *tmp_pos;
-    int decode_step;
-
-    std::string txtRaw(quests.string_view());
-    strtok(txtRaw.data(), "\r");
-    memset(pQuestTable.data(), 0, sizeof(pQuestTable));
+    TsvReader tsv(quests);
+    tsv.skipLines(1);
+    pQuestTable.fill({});
     for (auto i : pQuestTable.indices()) {
-        test_string = strtok(NULL, "\r") + 1;
-        break_loop = false;
-        decode_step = 0;
-        do {
-            c = *(unsigned char *)test_string;
-            temp_str_len = 0;
-            while ((c != '\t') && (c > 0)) {
-                ++temp_str_len;
-                c = test_string[temp_str_len];
-            }
-            tmp_pos = test_string + temp_str_len;
-            if (*tmp_pos == 0) break_loop = true;
-            *tmp_pos = 0;
-            if (temp_str_len) {
-                if (decode_step == 1)
-                    pQuestTable[i] = removeQuotes(test_string);
-            } else {
-                break_loop = true;
-            }
-            ++decode_step;
-            test_string = tmp_pos + 1;
-        } while ((decode_step < 2) && !break_loop);
+        tsv.readLine();
+        if (tsv.leadingFieldCount(2) > 1)
+            pQuestTable[i] = removeQuotes(tsv.field(1));
     }
 }
-
@@ -0,0 +1,136 @@
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Objects/Monsters.h"
+#include "Engine/Tables/ItemTable.h"
+#include "Engine/Engine.h"
+#include "Engine/GameResourceManager.h"
+#include "Engine/MapInfo.h"
+
+#include "Utility/String/Ascii.h"
+#include "Utility/String/Split.h"
+#include "Utility/String/Transformations.h"
+
+// These tests check the tables loaded on startup against the vanilla data. Where the expected values are not spelled
+// out, they are read from the raw table text with a naive splitter that has nothing in common with TsvReader.
+
+// EAX presets, in order. Vanilla code never matches the last one, PSYCHOTIC, so it's not listed.
+static const std::string_view eaxEnvironments[] = {
+    "GENERIC", "PADDEDCELL", "ROOM", "BATHROOM", "LIVINGROOM", "STONEROOM", "AUDITORIUM", "CONCERTHALL", "CAVE",
+    "ARENA", "HANGAR", "CARPETEDHALLWAY", "HALLWAY", "STONECORRIDOR", "ALLEY", "FOREST", "CITY", "MOUNTAIN", "QUARRY",
+    "PLAINS", "PARKINGLOT", "SEWERPIPE", "UNDERWATER", "DRUGGED", "DIZZY"
+};
+
+/**
+ * @param table                         Raw table text.
+ * @param keyColumn                     Column to look up the row by.
+ * @param key                           Value to look for, compared case-insensitively & w/o quotes.
+ * @return                              Fields of the first matching row, or an empty vector if there is no such row.
+ */
+static std::vector<std::string_view> rawRow(std::string_view table, size_t keyColumn, std::string_view key) {
+    for (std::string_view line : split(table, '\n')) {
+        if (line.ends_with('\r'))
+            line.remove_suffix(1);
+
+        std::vector<std::string_view> fields;
+        for (std::string_view field : split(line, '\t'))
+            fields.push_back(field);
+        if (fields.size() > keyColumn && ascii::noCaseEquals(removeQuotes(fields[keyColumn]), key))
+            return fields;
+    }
+    return {};
+}
+
+static int rawInt(std::string_view field) {
+    std::string digits;
+    for (char c : field)
+        if (c != ',' && c != '"')
+            digits += c; // Vanilla tables use thousands separators in some of the numbers.
+    return std::atoi(digits.c_str());
+}
+
+GAME_TEST(TextTables, Monsters) {
+    EXPECT_EQ(pMonsterStats->infos[MONSTER_ANGEL_A].name, "Angel");
+    EXPECT_EQ(pMonsterStats->infos[MONSTER_ANGEL_C].name, "Archangel");
+    EXPECT_EQ(pMonsterStats->infos[MONSTER_BAT_C].name, "Inferno Bat");
+    EXPECT_EQ(pMonsterStats->infos[MONSTER_BEHOLDER_B].name, "Gazer");
+
+    Blob monsters = engine->_gameResourceManager->getEventsFile("monsters.txt");
+    for (MonsterId id : {MONSTER_ANGEL_A, MONSTER_ANGEL_C, MONSTER_BAT_C, MONSTER_BEHEMOTH_C, MONSTER_BEHOLDER_B}) {
+        const MonsterInfo &info = pMonsterStats->infos[id];
+        std::vector<std::string_view> row = rawRow(monsters.string_view(), 1, info.name);
+        ASSERT_GT(row.size(), 6) << info.name;
+        EXPECT_EQ(rawInt(row[0]), std::to_underlying(id)) << info.name;
+        EXPECT_EQ(info.textureName, removeQuotes(row[2])) << info.name;
+        EXPECT_EQ(info.level, rawInt(row[3])) << info.name;
+        EXPECT_EQ(static_cast<int>(info.hp), rawInt(row[4])) << info.name;
+        EXPECT_EQ(static_cast<int>(info.ac), rawInt(row[5])) << info.name;
+        EXPECT_EQ(static_cast<int>(info.exp), rawInt(row[6])) << info.name;
+        EXPECT_GT(info.hp, 0u) << info.name;
+    }
+}
+
+GAME_TEST(TextTables, Items) {
+    EXPECT_TRUE(ascii::noCaseEquals(pItemTable->items[ITEM_CRUDE_LONGSWORD].name, "Crude Longsword"));
+    EXPECT_TRUE(ascii::noCaseEquals(pItemTable->items[ITEM_ELVEN_SABER].name, "Elven Saber"));
+    EXPECT_EQ(pItemTable->items[ITEM_GOLD_SMALL].description, "A small pile of gold coins.");
+    EXPECT_EQ(pItemTable->items[ITEM_GOLD_SMALL].type, ITEM_TYPE_GOLD);
+
+    Blob items = engine->_gameResourceManager->getEventsFile("items.txt");
+    for (ItemId id : {ITEM_CRUDE_LONGSWORD, ITEM_ELVEN_SABER, ITEM_KEEN_LONGSWORD, ITEM_GOLD_SMALL}) {
+        const ItemData &data = pItemTable->items[id];
+        std::vector<std::string_view> row = rawRow(items.string_view(), 2, data.name);
+        ASSERT_GT(row.size(), 3) << data.name;
+        EXPECT_EQ(rawInt(row[0]), std::to_underlying(id)) << data.name;
+        EXPECT_EQ(data.iconName, removeQuotes(row[1])) << data.name;
+        EXPECT_EQ(data.baseValue, rawInt(row[3])) << data.name;
+    }
+}
+
+GAME_TEST(TextTables, MapStats) {
+    EXPECT_EQ(pMapStats->pInfos[MAP_EMERALD_ISLAND].name, "Emerald Island");
+    EXPECT_EQ(pMapStats->pInfos[MAP_EMERALD_ISLAND].fileName, "out01.odm");
+    EXPECT_EQ(pMapStats->pInfos[MAP_HARMONDALE].name, "Harmondale");
+    EXPECT_EQ(pMapStats->pInfos[MAP_BRACADA_DESERT].fileName, "out06.odm");
+    EXPECT_EQ(pMapStats->pInfos[MAP_CELESTE].fileName, "d25.blv");
+    EXPECT_EQ(pMapStats->pInfos[MAP_CASTLE_HARMONDALE].name, "Castle Harmondale");
+
+    auto expectCount = [](std::string_view field, int minCount, int maxCount, std::string_view name) {
+        size_t separator = field.find('-');
+        int expectedMin = field.empty() ? 1 : rawInt(field.substr(0, separator));
+        int expectedMax = separator == std::string_view::npos ? expectedMin : rawInt(field.substr(separator + 1));
+        EXPECT_EQ(minCount, expectedMin) << name;
+        EXPECT_EQ(maxCount, expectedMax) << name;
+        EXPECT_LE(minCount, maxCount) << name;
+    };
+
+    Blob mapStats = engine->_gameResourceManager->getEventsFile("MapStats.txt");
+    for (MapId id : pMapStats->pInfos.indices()) {
+        const MapInfo &info = pMapStats->pInfos[id];
+        std::vector<std::string_view> row = rawRow(mapStats.string_view(), 2, info.fileName);
+        ASSERT_GT(row.size(), 29) << info.fileName;
+        EXPECT_EQ(info.name, removeQuotes(row[1])) << info.fileName;
+        EXPECT_EQ(static_cast<int>(info.respawnIntervalDays), rawInt(row[6])) << info.fileName;
+        EXPECT_EQ(info.mapTreasureLevel, static_cast<MapTreasureLevel>(rawInt(row[11]))) << info.fileName;
+        EXPECT_EQ(info.encounterChance, rawInt(row[12])) << info.fileName;
+
+        int chanceSum = info.encounter1Chance + info.encounter2Chance + info.encounter3Chance;
+        EXPECT_TRUE(chanceSum == 0 || chanceSum == 100) << info.fileName;
+        expectCount(row[19], info.encounter1MinCount, info.encounter1MaxCount, info.fileName);
+        expectCount(row[23], info.encounter2MinCount, info.encounter2MaxCount, info.fileName);
+        expectCount(row[27], info.encounter3MinCount, info.encounter3MaxCount, info.fileName);
+
+        EXPECT_EQ(info.musicId, static_cast<MusicId>(rawInt(row[28]))) << info.fileName;
+        if (info.uEAXEnv < std::size(eaxEnvironments)) {
+            EXPECT_EQ(eaxEnvironments[info.uEAXEnv], row[29]) << info.fileName;
+        } else {
+            EXPECT_EQ(info.uEAXEnv, 26) << info.fileName; // Unknown environment.
+            EXPECT_EQ(std::ranges::find(eaxEnvironments, row[29]), std::end(eaxEnvironments)) << info.fileName;
+        }
+    }
+}
@@ -3,7 +3,10 @@
 #include <sstream>
 #include <memory>
 #include <algorithm>
+#include <charconv>
+#include <functional>
 #include <ranges>
+#include <span>
 #include <string>
 
 #include "Engine/LodTextureCache.h"
@@ -13,11 +16,39 @@
 
 #include "GUI/GUIWindow.h"
 
-static Color parseColorTag(const char *tag, const Color &defaultColor) {
-    char color_code[20];
-    strncpy(color_code, tag, 5);
-    color_code[5] = 0;
-    int color16 = atoi(color_code);
+#include "Utility/String/Ascii.h"
+#include "Utility/Hash.h"
+
+// Upper bound on the number of cached text layouts per font, cache is just dropped when it's reached.
+static constexpr size_t MAX_CACHED_LAYOUTS = 1024;
+
+/**
+ * Parses a numeric argument of a markup tag the same way `atoi` would, e.g. `"040"` in `"\t040"`.
+ *
+ * @param text                          Text to parse the number from.
+ * @param pos                           Position of the number in `text`.
+ * @param count                         Number of characters reserved for the number.
+ * @return                              Parsed number, or 0 on error.
+ */
+static int parseTagNumber(std::string_view text, size_t pos, size_t count) {
+    if (pos >= text.size())
+        return 0;
+    text = text.substr(pos, count);
+
+    const char *begin = text.data();
+    const char *end = text.data() + text.size();
+    while (begin < end && ascii::isSpace(*begin))
+        begin++;
+    if (begin < end && *begin == '+')
+        begin++;
+
+    int result = 0;
+    std::from_chars(begin, end, result);
+    return result;
+}
+
+static Color parseColorTag(std::string_view text, size_t pos, const Color &defaultColor) {
+    int color16 = parseTagNumber(text, pos, 5);
     if (color16 == 0) {
         return defaultColor; // Back to default color.
     } else {
@@ -195,7 +226,7 @@ Color GUIFont::DrawTextLine(std::string_view text, Color startColor, Color defau
         case '\n': // New line.
             return color;
         case '\f': // Color tag.
-            color = parseColorTag(&text[i + 1], defaultColor);
+            color = parseColorTag(text, i + 1, defaultColor);
             i += 5;
             break;
         case '\t': // Move to next cell, offset from the left border.
@@ -266,7 +297,7 @@ void GUIFont::DrawTextLineToBuff(Color color, Color shadowColor, Color *uX_buff_
                 return;
                 break;
             case '\f':  // Form Feed, page eject  0C 12
-                text_color = parseColorTag(&text[i + 1], color);
+                text_color = parseColorTag(text, i + 1, color);
                 i += 5;
                 break;
             case '\t':  // Horizontal tab 09
@@ -310,14 +341,9 @@ std::string GUIFont::WrapText(std::string_view inString, int width, int uX, bool
         if (IsCharValid(c)) {
             switch (c) {
               case '\t': // Horizontal tab
-                {
-                    char digits[4];
-                    strncpy(digits, &inString[i + 1], 3);
-                    digits[3] = 0;
-                    lineWidth = atoi(digits) + uX;
-                    i += 3;
-                    break;
-                }
+                lineWidth = parseTagNumber(inString, i + 1, 3) + uX;
+                i += 3;
+                break;
               case '\n': // Line Feed
                 lineWidth = uX;
                 newlinePos = -1;
@@ -373,7 +399,6 @@ std::string GUIFont::WrapText(std::string_view inString, int width, int uX, bool
 void GUIFont::DrawText(GUIWindow *window, Pointi position, Color color, std::string_view text, int maxHeight, Color shadowColor) {
     assert(color.a > 0);
 
-    int left_margin = 0;
     if (text.empty()) {
         return;
     }
@@ -383,126 +408,168 @@ void GUIFont::DrawText(GUIWindow *window, Pointi position, Color color, std::str
 
     render->BeginTextNew(_mainTexture, _shadowTexture);
 
-    size_t v30 = text.length();
     if (!position.x) {
         position.x = 12;
     }
 
-    std::string string_begin = std::string(text);
-    if (maxHeight == 0) {
-        string_begin = WrapText(text, window->uFrameWidth, position.x);
-    }
-    auto string_end = string_begin;
-    auto string_base = string_begin;
+    // Text is wrapped only if there is no height limit.
+    const TextLayout &layout = layoutText(text, maxHeight == 0 ? window->uFrameWidth : -1, position.x,
+                                          window->uFrameZ - window->uFrameX);
 
-    int out_x = position.x + window->uFrameX;
+    int out_x = window->uFrameX;
     int out_y = position.y + window->uFrameY;
 
     if (maxHeight != 0 && out_y + _font.height() > maxHeight) {
         return;
     }
 
-    Color draw_color = color;
+    for (size_t i = 0; i < layout.lines.size(); i++) {
+        const TextLine &line = layout.lines[i];
+        if (maxHeight != 0 && i > 0 && _font.height() + out_y + line.y - 3 > maxHeight) {
+            return;
+        }
 
-    char Dest[6] = { 0 };
-    size_t v14 = 0;
-    if (v30 > 0) {
-        do {
-            uint8_t c = string_base[v14];
-            if (_font.supports(c)
-                || c == '\f'
-                || c == '\r'
-                || c == '\t'
-                || c == '\n') {
-                switch (c) {
-                case '\t':
-                    strncpy(Dest, &string_base[v14 + 1], 3);
-                    Dest[3] = 0;
-                    v14 += 3;
-                    left_margin = atoi(Dest);
-                    out_x = position.x + window->uFrameX + left_margin;
-                    break;
-                case '\n':
-                    position.y = position.y + _font.height() - 3;
-                    out_y = position.y + window->uFrameY;
-                    out_x = position.x + window->uFrameX + left_margin;
-                    if (maxHeight != 0) {
-                        if (_font.height() + out_y - 3 > maxHeight) {
-                            return;
-                        }
-                    }
-                    break;
-                case '\f':
-                    draw_color = parseColorTag(&string_base[v14 + 1], color);
-                    v14 += 5;
-                    break;
-                case '\r':
-                    strncpy(Dest, &string_base[v14 + 1], 3);
-                    Dest[3] = 0;
-                    v14 += 3;
-                    left_margin = atoi(Dest);
-                    out_x = window->uFrameZ - GetLineWidth(&string_base[v14]) - left_margin;
-                    out_y = position.y + window->uFrameY;
-                    if (maxHeight != 0) {
-                        if (_font.height() + out_y - 3 > maxHeight) {
-                            return;
-                        }
-                        break;
-                    }
-                    break;
+        size_t end = i + 1 < layout.lines.size() ? layout.lines[i + 1].firstGlyph : layout.glyphs.size();
+        for (const TextGlyph &glyph : std::span(layout.glyphs).subspan(line.firstGlyph, end - line.firstGlyph)) {
+            render->DrawTextNew(out_x + glyph.x, out_y + glyph.y, glyph.width, _font.height(),
+                                glyph.u1, glyph.v1, glyph.u2, glyph.v2, 1, shadowColor);
+            render->DrawTextNew(out_x + glyph.x, out_y + glyph.y, glyph.width, _font.height(),
+                                glyph.u1, glyph.v1, glyph.u2, glyph.v2, 0, glyph.defaultColor ? color : glyph.color);
+        }
+    }
+    // render->EndTextNew();
+}
 
-                default:
-                    if (c == '\"' && string_base[v14 + 1] == '\"') {
-                        ++v14;
-                    }
+const GUIFont::TextLayout &GUIFont::layoutText(std::string_view text, int wrapWidth, int x, int rightBorder) {
+    size_t hash = std::hash<std::string_view>()(text);
+    detail::hashCombine(hash, wrapWidth);
+    detail::hashCombine(hash, x);
+    detail::hashCombine(hash, rightBorder);
+
+    auto pos = _layoutCache.find(hash);
+    if (pos != _layoutCache.end()) {
+        const TextLayout &layout = pos->second;
+        if (layout.text == text && layout.wrapWidth == wrapWidth && layout.x == x && layout.rightBorder == rightBorder) {
+            _layoutCacheHits++;
+            return layout;
+        }
+    }
 
-                    c = (uint8_t)string_base[v14];
-                    if (v14 > 0) {
-                        out_x += _font.metrics(c).leftSpacing;
-                    }
+    _layoutCacheMisses++;
+    if (pos == _layoutCache.end() && _layoutCache.size() >= MAX_CACHED_LAYOUTS)
+        _layoutCache.clear();
+    return _layoutCache.insert_or_assign(hash, buildTextLayout(text, wrapWidth, x, rightBorder)).first->second;
+}
 
-                    int xsq = c % 16;
-                    int ysq = c / 16;
-                    float u1 = (xsq * 32.0f) / 512.0f;
-                    float u2 = (xsq * 32.0f + _font.metrics(c).width) / 512.0f;
-                    float v1 = (ysq * 32.0f) / 512.0f;
-                    float v2 = (ysq * 32.0f + _font.height()) / 512.0f;
+GUIFont::TextLayout GUIFont::buildTextLayout(std::string_view text, int wrapWidth, int x, int rightBorder) {
+    TextLayout result;
+    result.text = text;
+    result.wrapWidth = wrapWidth;
+    result.x = x;
+    result.rightBorder = rightBorder;
+    result.lines.push_back(TextLine());
 
-                    render->DrawTextNew(out_x, out_y, _font.metrics(c).width, _font.height(), u1, v1, u2, v2, 1, shadowColor);
-                    render->DrawTextNew(out_x, out_y, _font.metrics(c).width, _font.height(), u1, v1, u2, v2, 0, draw_color);
+    std::string wrappedText = wrapWidth >= 0 ? WrapText(text, wrapWidth, x) : std::string(text);
+    std::string_view str = wrappedText;
 
-                    out_x += _font.metrics(c).width;
-                    if (v14 < v30) {
-                        out_x += _font.metrics(c).rightSpacing;
-                    }
-                    break;
-                }
-            }
-        } while (++v14 < v30);
+    // Wrapping can insert line breaks, and then the tail of the wrapped text is not drawn. This is how it always worked,
+    // and we're keeping it this way.
+    size_t len = std::min(text.size(), str.size());
+
+    int left_margin = 0;
+    int out_x = x;
+    int out_y = 0;
+    Color color;
+    bool defaultColor = true;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = str[i];
+        switch (c) {
+        case '\t':
+            left_margin = parseTagNumber(str, i + 1, 3);
+            i += 3;
+            out_x = x + left_margin;
+            break;
+        case '\n':
+            out_y += _font.height() - 3;
+            out_x = x + left_margin;
+            result.lines.push_back({out_y, result.glyphs.size()});
+            break;
+        case '\f': {
+            int color16 = parseTagNumber(str, i + 1, 5);
+            defaultColor = color16 == 0;
+            if (!defaultColor)
+                color = Color::fromC16(color16);
+            i += 5;
+            break;
+        }
+        case '\r':
+            left_margin = parseTagNumber(str, i + 1, 3);
+            i += 3;
+            out_x = rightBorder - GetLineWidth(str.substr(std::min(i, str.size()))) - left_margin;
+            result.lines.push_back({out_y, result.glyphs.size()});
+            break;
+        default:
+            if (!_font.supports(c))
+                break;
+
+            if (c == '\"' && i + 1 < str.size() && str[i + 1] == '\"')
+                ++i;
+
+            if (i > 0)
+                out_x += _font.metrics(c).leftSpacing;
+
+            TextGlyph &glyph = result.glyphs.emplace_back();
+            int xsq = c % 16;
+            int ysq = c / 16;
+            glyph.x = out_x;
+            glyph.y = out_y;
+            glyph.width = _font.metrics(c).width;
+            glyph.u1 = (xsq * 32.0f) / 512.0f;
+            glyph.u2 = (xsq * 32.0f + _font.metrics(c).width) / 512.0f;
+            glyph.v1 = (ysq * 32.0f) / 512.0f;
+            glyph.v2 = (ysq * 32.0f + _font.height()) / 512.0f;
+            glyph.color = color;
+            glyph.defaultColor = defaultColor;
+
+            out_x += _font.metrics(c).width;
+            out_x += _font.metrics(c).rightSpacing;
+            break;
+        }
     }
-    // render->EndTextNew();
+
+    return result;
+}
+
+void GUIFont::invalidateLayoutCache() {
+    _layoutCache.clear();
+}
+
+void GUIFont::resetLayoutCacheStats() {
+    _layoutCacheHits = 0;
+    _layoutCacheMisses = 0;
 }
 
 int GUIFont::DrawTextInRect(GUIWindow *window, Pointi position, Color color, std::string_view text, int rect_width, int reverse_text) {
     assert(color.a > 0);
 
-    char buf[4096];
-    assert(text.length() < sizeof(buf));
-    strncpy(buf, text.data(), text.size());
-    buf[text.size()] = '\0';
-
-    size_t pNumLen = strlen(buf);
-    if (pNumLen == 0) return 0;
+    text = text.substr(0, text.find('\0'));
+    if (text.empty()) return 0;
 
-    unsigned int pLineWidth = GetLineWidth(buf);
+    unsigned int pLineWidth = GetLineWidth(text);
     if (pLineWidth < rect_width) {
-        DrawText(window, position, color, buf, 0, colorTable.Black);
+        DrawText(window, position, color, text, 0, colorTable.Black);
         return pLineWidth;
     }
 
     assert(false);
     return 0; // TODO(captainurist): The code below is never called, and it's messed up - \r is used for color tags, \f for right justification.
 
+    char buf[4096];
+    assert(text.length() < sizeof(buf));
+    strncpy(buf, text.data(), text.size());
+    buf[text.size()] = '\0';
+    size_t pNumLen = strlen(buf);
+
     render->BeginTextNew(_mainTexture, _shadowTexture);
 
     unsigned int text_width = 0;
@@ -567,7 +634,7 @@ int GUIFont::DrawTextInRect(GUIWindow *window, Pointi position, Color color, std
                 break;
             }
             case '\r':  // Form Feed, page eject  0C 12
-                draw_color = parseColorTag(&buf[i + 1], color);
+                draw_color = parseColorTag(buf, i + 1, color);
                 i += 5;
                 break;
             case '\f': {  // Carriage Return 0D 13
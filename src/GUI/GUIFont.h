@@ -3,7 +3,9 @@
 #include <array>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <unordered_map>
 
 #include "Library/Color/Color.h"
 #include "Library/Image/Palette.h"
@@ -23,6 +25,8 @@ class GraphicsImage;
  *   right-justified, with the given offset from the right window border. This is used e.g. in the create party screen.
  * - `\fXXXXX`, where `XXXXX` is a decimal color code for 16-bit color to use for the text that follows.
  *
+ * `DrawText` caches text layouts, so drawing the same static text frame after frame doesn't re-wrap & re-parse it.
+ *
  * @see Color::fromC16
  */
 class GUIFont {
@@ -89,6 +93,21 @@ class GUIFont {
 
     std::string WrapText(std::string_view inString, int width, int uX, bool return_on_carriage = false);
 
+    /**
+     * Drops all cached text layouts. Counters are left intact.
+     */
+    void invalidateLayoutCache();
+
+    void resetLayoutCacheStats();
+
+    [[nodiscard]] size_t layoutCacheHits() const {
+        return _layoutCacheHits;
+    }
+
+    [[nodiscard]] size_t layoutCacheMisses() const {
+        return _layoutCacheMisses;
+    }
+
     // TODO: these should take std::string_view
     void DrawCreditsEntry(GUIFont *pSecondFont, int uFrameX, int uFrameY,
                           unsigned int w, unsigned int h, Color firstColor,
@@ -98,6 +117,43 @@ class GUIFont {
                          GUIWindow *pWindow, int startX, int a6);
 
  private:
+    struct TextGlyph {
+        int x = 0; // Relative to the window's left border.
+        int y = 0; // Relative to the text's first line.
+        int width = 0;
+        float u1 = 0, v1 = 0, u2 = 0, v2 = 0;
+        Color color;
+        bool defaultColor = true; // Whether `color` should be ignored in favor of the color passed to `DrawText`.
+    };
+
+    /**
+     * Run of glyphs in a text layout. New runs are started on `\n` and `\r`, and this is where `DrawText` checks
+     * whether the text still fits into the provided max height.
+     */
+    struct TextLine {
+        int y = 0;
+        size_t firstGlyph = 0;
+    };
+
+    struct TextLayout {
+        std::string text;
+        int wrapWidth = -1;
+        int x = 0;
+        int rightBorder = 0;
+        std::vector<TextGlyph> glyphs;
+        std::vector<TextLine> lines;
+    };
+
+    /**
+     * @param text                      Text to lay out.
+     * @param wrapWidth                 Width to wrap the text to, or -1 if the text shouldn't be wrapped.
+     * @param x                         Where does the text start relative to the window's left border?
+     * @param rightBorder               Offset of the window's right border, used for right-justified text.
+     * @return                          Cached layout for the provided text.
+     */
+    const TextLayout &layoutText(std::string_view text, int wrapWidth, int x, int rightBorder);
+    TextLayout buildTextLayout(std::string_view text, int wrapWidth, int x, int rightBorder);
+
     bool IsCharValid(unsigned char c) const;
     std::string FitTwoFontStringINWindow(std::string_view inString, GUIFont *pFontSecond,
                                     GUIWindow *pWindow, int startPixlOff,
@@ -109,5 +165,8 @@ class GUIFont {
     LodFont _font;
     GraphicsImage *_mainTexture = nullptr;
     GraphicsImage *_shadowTexture = nullptr;
+    std::unordered_map<size_t, TextLayout> _layoutCache; // Text & layout parameters hash => layout.
+    size_t _layoutCacheHits = 0;
+    size_t _layoutCacheMisses = 0;
 };
 
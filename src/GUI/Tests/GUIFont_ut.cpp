@@ -0,0 +1,78 @@
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/AssetsManager.h"
+#include "Engine/Party.h"
+
+#include "GUI/UI/UIPopup.h"
+#include "GUI/GUIFont.h"
+#include "GUI/GUIWindow.h"
+
+GAME_TEST(GUIFont, LayoutCache) {
+    game.startNewGame();
+    if (pParty->activeCharacterIndex() != 1) {
+        game.pressGuiButton("Game_Character1");
+        game.tick(1);
+    }
+    game.pressGuiButton("Game_Character1"); // Opens up the character screen.
+    game.tick(1);
+    ASSERT_EQ(current_screen_type, SCREEN_CHARACTERS);
+    GUIWindow *characterScreen = pGUIWindow_CurrentMenu;
+
+    std::vector<Item *> items;
+    for (Character &character : pParty->pCharacters)
+        for (InventoryEntry entry : character.inventory.equipment())
+            items.push_back(entry.get());
+    ASSERT_FALSE(items.empty());
+
+    // Character screen tabs & the popups that can be shown on top of them, this is the text-heaviest UI in the game.
+    auto drawFrame = [&] {
+        for (WindowType tab : {WINDOW_CharacterWindow_Stats, WINDOW_CharacterWindow_Skills, WINDOW_CharacterWindow_Awards}) {
+            current_character_screen_window = tab;
+            characterScreen->Update();
+        }
+        current_character_screen_window = WINDOW_CharacterWindow_Stats;
+
+        GUIWindow popupWindow;
+        popupWindow.uFrameWidth = 400;
+        popupWindow.uFrameHeight = 200;
+        popupWindow.uFrameX = 38;
+        popupWindow.uFrameY = 60;
+        for (int i = 0; i < pParty->pCharacters.size(); i++)
+            GameUI_CharacterQuickRecord_Draw(&popupWindow, i);
+        for (Item *item : items)
+            GameUI_DrawItemInfo(item);
+    };
+
+    std::vector<GUIFont *> fonts = {
+        assets->pFontBookOnlyShadow.get(), assets->pFontBookLloyds.get(), assets->pFontArrus.get(),
+        assets->pFontLucida.get(), assets->pFontBookTitle.get(), assets->pFontBookCalendar.get(),
+        assets->pFontCreate.get(), assets->pFontCChar.get(), assets->pFontComic.get(), assets->pFontSmallnum.get()
+    };
+
+    drawFrame(); // Warm up.
+    for (GUIFont *font : fonts)
+        font->resetLayoutCacheStats();
+    drawFrame();
+
+    // UI is static, so after the warm up everything should come from the cache.
+    size_t hits = 0, misses = 0;
+    for (GUIFont *font : fonts) {
+        hits += font->layoutCacheHits();
+        misses += font->layoutCacheMisses();
+    }
+    EXPECT_GT(hits, 0);
+    EXPECT_EQ(misses, 0);
+
+    // Invalidation drops everything.
+    for (GUIFont *font : fonts) {
+        font->invalidateLayoutCache();
+        font->resetLayoutCacheStats();
+    }
+    drawFrame();
+    misses = 0;
+    for (GUIFont *font : fonts)
+        misses += font->layoutCacheMisses();
+    EXPECT_GT(misses, 0);
+}
@@ -12,6 +12,7 @@
 #include "Engine/EngineGlobals.h"
 #include "Engine/Objects/Character.h"
 #include "Engine/Objects/CharacterEnumFunctions.h"
+#include "Engine/Objects/CharacterStatsCache.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Graphics/Viewport.h"
 #include "Engine/Graphics/Image.h"
@@ -640,6 +641,7 @@ void GUIWindow_CharacterRecord::createAwardsScrollBar() {
 }
 
 void GUIWindow_CharacterRecord::Update() {
+    CharacterStatsCache::Scope statsScope;
     auto player = &pParty->activeCharacter();
 
     render->ClearHitMap();
@@ -18,6 +18,7 @@
 #include "Engine/Objects/SpriteObject.h"
 #include "Engine/Objects/NPC.h"
 #include "Engine/Objects/CharacterEnumFunctions.h"
+#include "Engine/Objects/CharacterStatsCache.h"
 #include "Engine/Objects/MonsterEnumFunctions.h"
 #include "Engine/Random/Random.h"
 #include "Engine/Tables/ItemTable.h"
@@ -412,6 +413,9 @@ void GameUI_DrawItemInfo(Item *inspect_item) {
         }
     }
 
+    // Identify & repair are done, the rest only reads character stats.
+    CharacterStatsCache::Scope statsScope;
+
     if (inspect_item->IsBroken()) {
         iteminfo_window.DrawMessageBox(0);
         render->SetUIClipRect(Recti(
@@ -1144,6 +1148,7 @@ void CharacterUI_SkillsTab_ShowHint() {
 
 //----- (00418083) --------------------------------------------------------
 void CharacterUI_StatsTab_ShowHint() {
+    CharacterStatsCache::Scope statsScope;
     int pStringNum;         // edi@1
     Color pTextColor;  // eax@15
     std::string pHourWord;  // ecx@17
@@ -1703,6 +1708,7 @@ void ShowPopupShopItem() {
 
 //----- (0041D3B7) --------------------------------------------------------
 void GameUI_CharacterQuickRecord_Draw(GUIWindow *window, int characterIndex) {
+    CharacterStatsCache::Scope statsScope;
     GraphicsImage *v13;              // eax@6
     std::string spellName;   // eax@16
     int v36;                 // esi@22
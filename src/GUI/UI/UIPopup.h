@@ -1,9 +1,13 @@
 #pragma once
 #include <string>
 
-void DrawPopupWindow(unsigned int uX, unsigned int uY, unsigned int uWidth, unsigned int uHeight);  // idb
-
 class GraphicsImage;
+class GUIWindow;
+struct Item;
+
+void DrawPopupWindow(unsigned int uX, unsigned int uY, unsigned int uWidth, unsigned int uHeight);  // idb
+void GameUI_DrawItemInfo(Item *inspect_item);
+void GameUI_CharacterQuickRecord_Draw(GUIWindow *window, int characterIndex);
 
 extern GraphicsImage *parchment;
 extern GraphicsImage *messagebox_corner_x;       // 5076AC
@@ -2,6 +2,7 @@
 
 #include "Engine/AssetsManager.h"
 #include "Engine/Objects/CharacterEnumFunctions.h"
+#include "Engine/Objects/CharacterStatsCache.h"
 #include "Engine/Graphics/Renderer/Renderer.h"
 #include "Engine/Spells/Spells.h"
 #include "Engine/Localization.h"
@@ -41,6 +42,7 @@ void GUIWindow_QuickReference::Update() {
     //----- (0041A57E) --------------------------------------------------------
     // void GameUI_QuickRef_Draw()
 
+    CharacterStatsCache::Scope statsScope;
     Color pTextColor;
     int pFontHeight = assets->pFontArrus->GetHeight() + 1;
 
@@ -2,44 +2,151 @@
 
 #include <zlib.h>
 
-#include <cstring>
+#include <cstdlib>
 #include <algorithm>
+#include <limits>
 #include <memory>
+#include <new>
 
 #include "Utility/Memory/FreeDeleter.h"
+#include "Utility/Exception.h"
 
-namespace zlib {
+namespace {
 
-Blob compress(const Blob &source) {
-    uLongf destLen = source.size();
-    std::unique_ptr<void, FreeDeleter> dest;
-    int res = Z_BUF_ERROR;
-    while (res == Z_BUF_ERROR) {
-        if (dest) {
-            dest.reset();
-            destLen *= 2;
+/**
+ * Thin wrapper around zlib's inflate that works with `size_t`-sized buffers. zlib uses `uInt` for buffer sizes,
+ * so larger buffers are fed in chunks.
+ */
+class Inflater {
+ public:
+    explicit Inflater(const Blob &source) : _in(static_cast<const Bytef *>(source.data())), _inSize(source.size()) {
+        _valid = inflateInit(&_stream) == Z_OK;
+    }
+
+    ~Inflater() {
+        if (_valid)
+            inflateEnd(&_stream);
+    }
+
+    /**
+     * @param out                       Output buffer.
+     * @param outSize                   Output buffer size.
+     * @param[out] outWritten           Number of bytes written into the output buffer.
+     * @return                          `Z_STREAM_END` on success, `Z_BUF_ERROR` if the output buffer is full, other
+     *                                  zlib error code on error.
+     */
+    int inflate(Bytef *out, size_t outSize, size_t *outWritten) {
+        *outWritten = 0;
+        if (!_valid)
+            return Z_MEM_ERROR;
+
+        while (true) {
+            if (_stream.avail_in == 0 && _inSize > 0) {
+                size_t chunk = std::min<size_t>(_inSize, std::numeric_limits<uInt>::max());
+                _stream.next_in = const_cast<Bytef *>(_in);
+                _stream.avail_in = chunk;
+                _in += chunk;
+                _inSize -= chunk;
+            }
+
+            size_t chunk = std::min<size_t>(outSize - *outWritten, std::numeric_limits<uInt>::max());
+            _stream.next_out = out + *outWritten;
+            _stream.avail_out = chunk;
+            int status = ::inflate(&_stream, Z_NO_FLUSH);
+            *outWritten += chunk - _stream.avail_out;
+
+            if (status == Z_STREAM_END)
+                return Z_STREAM_END;
+            if (status != Z_OK && status != Z_BUF_ERROR)
+                return status;
+            if (*outWritten == outSize)
+                return Z_BUF_ERROR;
+            if (_stream.avail_in == 0 && _inSize == 0)
+                return Z_DATA_ERROR; // Truncated input.
         }
-        dest.reset(malloc(destLen));
-        res = ::compress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
     }
 
-    return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
+ private:
+    z_stream _stream = {};
+    const Bytef *_in = nullptr;
+    size_t _inSize = 0;
+    bool _valid = false;
+};
+
+void reallocOrThrow(std::unique_ptr<void, FreeDeleter> *memory, size_t size) {
+    void *result = realloc(memory->get(), size);
+    if (!result)
+        throw std::bad_alloc();
+    memory->release();
+    memory->reset(result);
+}
+
+} // namespace
+
+namespace zlib {
+
+Blob compress(const Blob &source) {
+    uLongf destLen = compressBound(source.size());
+    std::unique_ptr<void, FreeDeleter> dest(malloc(destLen));
+    if (!dest)
+        throw std::bad_alloc();
+
+    if (::compress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size()) != Z_OK)
+        return Blob();
+
+    reallocOrThrow(&dest, destLen); // Shrinking, should be done in place.
+    return Blob::fromMalloc(std::move(dest), destLen);
 }
 
 Blob uncompress(const Blob &source, size_t sizeHint) {
-    uLongf destLen = sizeHint > source.size() ? sizeHint : source.size() * 4;
-    std::unique_ptr<void, FreeDeleter> dest;
-    int res = Z_BUF_ERROR;
-    while (res == Z_BUF_ERROR) {
-        if (dest) {
-            dest.reset();
-            destLen *= 2;
-        }
-        dest.reset(malloc(destLen));
-        res = ::uncompress(static_cast<Bytef *>(dest.get()), &destLen, static_cast<const Bytef *>(source.data()), source.size());
+    size_t capacity = std::max<size_t>(sizeHint ? sizeHint : source.size() * 4, 1);
+    std::unique_ptr<void, FreeDeleter> dest(malloc(capacity));
+    if (!dest)
+        throw std::bad_alloc();
+
+    Inflater inflater(source);
+    size_t size = 0;
+    while (true) {
+        size_t written = 0;
+        int status = inflater.inflate(static_cast<Bytef *>(dest.get()) + size, capacity - size, &written);
+        size += written;
+        if (status == Z_STREAM_END)
+            break;
+        if (status != Z_BUF_ERROR)
+            return Blob();
+
+        // Size hint was wrong, grow the buffer. Note that unlike ::uncompress we don't start over here.
+        capacity *= 2;
+        reallocOrThrow(&dest, capacity);
     }
 
-    return res == Z_OK ? Blob::copy(dest.get(), destLen) : Blob();
+    if (size != 0 && size != capacity)
+        reallocOrThrow(&dest, size);
+    return Blob::fromMalloc(std::move(dest), size);
+}
+
+size_t uncompressInto(const Blob &source, void *target, size_t targetSize) {
+    Inflater inflater(source);
+    size_t written = 0;
+    int status = inflater.inflate(static_cast<Bytef *>(target), targetSize, &written);
+    if (status == Z_BUF_ERROR)
+        throw Exception("Failed to decompress '{}': decompressed data doesn't fit into {} bytes", source.displayPath(), targetSize);
+    if (status != Z_STREAM_END)
+        throw Exception("Failed to decompress '{}': {}", source.displayPath(), zError(status));
+    return written;
+}
+
+uint32_t crc32(const Blob &data) {
+    uLong result = ::crc32(0, Z_NULL, 0);
+    const Bytef *pos = static_cast<const Bytef *>(data.data());
+    size_t size = data.size();
+    while (size > 0) {
+        size_t chunk = std::min<size_t>(size, std::numeric_limits<uInt>::max());
+        result = ::crc32(result, pos, chunk);
+        pos += chunk;
+        size -= chunk;
+    }
+    return result;
 }
 
 };  // namespace zlib
@@ -1,8 +1,42 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 #include "Utility/Memory/Blob.h"
 
 namespace zlib {
+/**
+ * @param source                        Data to compress.
+ * @return                              Compressed data, in a buffer that's allocated once using `compressBound`.
+ *                                      Returns an empty blob on error.
+ */
 Blob compress(const Blob &source);
+
+/**
+ * Decompresses the provided data into a newly allocated buffer. If `sizeHint` is correct, the buffer is allocated
+ * exactly once and is never copied.
+ *
+ * @param source                        Data to decompress.
+ * @param sizeHint                      Expected size of the decompressed data, or zero if unknown.
+ * @return                              Decompressed data. Returns an empty blob on error.
+ */
 Blob uncompress(const Blob &source, size_t sizeHint = 0);
+
+/**
+ * Decompresses the provided data straight into a caller-owned buffer, without allocating anything.
+ *
+ * @param source                        Data to decompress.
+ * @param target                        Target buffer.
+ * @param targetSize                    Size of the target buffer.
+ * @return                              Number of bytes written into the target buffer.
+ * @throws Exception                    If the data is corrupted, or if it doesn't fit into the target buffer.
+ */
+size_t uncompressInto(const Blob &source, void *target, size_t targetSize);
+
+/**
+ * @param data                          Data to checksum.
+ * @return                              CRC-32 of the provided data.
+ */
+uint32_t crc32(const Blob &data);
 };  // namespace zlib
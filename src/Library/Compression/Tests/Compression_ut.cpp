@@ -0,0 +1,94 @@
+#include <string>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Compression/Compression.h"
+#include "Library/Compression/ZlibInputStream.h"
+#include "Library/Compression/ZlibOutputStream.h"
+
+#include "Utility/Streams/BlobInputStream.h"
+#include "Utility/Streams/StringOutputStream.h"
+
+static std::string makeTestData(size_t size) {
+    std::string result;
+    result.reserve(size);
+    for (size_t i = 0; i < size; i++)
+        result.push_back(static_cast<char>('a' + (i * i + i / 7) % 26));
+    return result;
+}
+
+UNIT_TEST(Compression, RoundTrip) {
+    for (size_t size : {0, 1, 100, 100000}) {
+        std::string data = makeTestData(size);
+        Blob compressed = zlib::compress(Blob::view(data));
+        EXPECT_FALSE(compressed.empty());
+
+        EXPECT_EQ(zlib::uncompress(compressed).string_view(), data);
+        EXPECT_EQ(zlib::uncompress(compressed, size).string_view(), data);
+        EXPECT_EQ(zlib::uncompress(compressed, 1).string_view(), data); // Wrong hint, buffer should grow.
+        EXPECT_EQ(zlib::uncompress(compressed, size * 3).string_view(), data); // Too large, should shrink.
+    }
+}
+
+UNIT_TEST(Compression, UncompressInto) {
+    std::string data = makeTestData(10000);
+    Blob compressed = zlib::compress(Blob::view(data));
+
+    std::string target(data.size(), '\0');
+    EXPECT_EQ(zlib::uncompressInto(compressed, target.data(), target.size()), data.size());
+    EXPECT_EQ(target, data);
+
+    std::string larger(data.size() + 10, '\0');
+    EXPECT_EQ(zlib::uncompressInto(compressed, larger.data(), larger.size()), data.size());
+    EXPECT_EQ(larger.substr(0, data.size()), data);
+
+    std::string smaller(data.size() - 1, '\0');
+    EXPECT_ANY_THROW((void) zlib::uncompressInto(compressed, smaller.data(), smaller.size()));
+}
+
+UNIT_TEST(Compression, Corrupted) {
+    std::string data = makeTestData(10000);
+    Blob compressed = zlib::compress(Blob::view(data));
+    Blob truncated = compressed.subBlob(0, compressed.size() / 2);
+
+    std::string target(data.size(), '\0');
+    EXPECT_TRUE(zlib::uncompress(truncated, data.size()).empty());
+    EXPECT_ANY_THROW((void) zlib::uncompressInto(truncated, target.data(), target.size()));
+    EXPECT_ANY_THROW((void) zlib::uncompressInto(Blob::view("garbage"), target.data(), target.size()));
+}
+
+UNIT_TEST(Compression, Streams) {
+    std::string data = makeTestData(1000000);
+
+    std::string compressed;
+    StringOutputStream output(&compressed);
+    ZlibOutputStream zlibOutput(&output);
+    for (size_t pos = 0; pos < data.size(); pos += 777)
+        zlibOutput.write(std::string_view(data).substr(pos, 777));
+    zlibOutput.close();
+
+    EXPECT_EQ(zlib::uncompress(Blob::view(compressed), data.size()).string_view(), data);
+
+    BlobInputStream input(Blob::view(compressed));
+    ZlibInputStream zlibInput(&input);
+    std::string head(1000, '\0');
+    zlibInput.readOrFail(head.data(), head.size());
+    EXPECT_EQ(head, data.substr(0, 1000));
+    zlibInput.skipOrFail(500000);
+    EXPECT_EQ(zlibInput.readAll(), data.substr(501000));
+}
+
+UNIT_TEST(Compression, StreamsTruncated) {
+    std::string data = makeTestData(100000);
+    Blob compressed = zlib::compress(Blob::view(data));
+
+    BlobInputStream input(compressed.subBlob(0, compressed.size() / 2));
+    ZlibInputStream zlibInput(&input);
+    EXPECT_ANY_THROW((void) zlibInput.readAll());
+}
+
+UNIT_TEST(Compression, Crc32) {
+    EXPECT_EQ(zlib::crc32(Blob()), 0);
+    EXPECT_EQ(zlib::crc32(Blob::view("123456789")), 0xCBF43926); // Standard CRC-32 check value.
+}
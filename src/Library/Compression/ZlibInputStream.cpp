@@ -0,0 +1,100 @@
+#include "ZlibInputStream.h"
+
+#include <zlib.h>
+
+#include <cassert>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "Utility/Exception.h"
+
+static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+ZlibInputStream::ZlibInputStream() = default;
+
+ZlibInputStream::ZlibInputStream(InputStream *base) {
+    open(base);
+}
+
+ZlibInputStream::~ZlibInputStream() {
+    closeInternal();
+}
+
+void ZlibInputStream::open(InputStream *base) {
+    assert(base);
+
+    closeInternal();
+
+    std::unique_ptr<z_stream_s> stream = std::make_unique<z_stream_s>();
+    if (inflateInit(stream.get()) != Z_OK)
+        throw Exception("Failed to initialize zlib decompression stream for '{}'", base->displayPath());
+
+    _base = base;
+    _stream = std::move(stream);
+    if (!_buffer)
+        _buffer = std::make_unique<char[]>(BUFFER_SIZE);
+    _baseEof = false;
+    _eof = false;
+}
+
+size_t ZlibInputStream::read(void *data, size_t size) {
+    assert(isOpen()); // Reading from a closed stream is UB.
+
+    size_t result = 0;
+    while (result < size && !_eof) {
+        if (_stream->avail_in == 0 && !_baseEof) {
+            size_t bytes = _base->read(_buffer.get(), BUFFER_SIZE);
+            _baseEof = bytes < BUFFER_SIZE;
+            _stream->next_in = reinterpret_cast<Bytef *>(_buffer.get());
+            _stream->avail_in = bytes;
+        }
+
+        size_t chunk = std::min<size_t>(size - result, std::numeric_limits<uInt>::max());
+        _stream->next_out = static_cast<Bytef *>(data) + result;
+        _stream->avail_out = chunk;
+        int status = inflate(_stream.get(), Z_NO_FLUSH);
+        result += chunk - _stream->avail_out;
+
+        if (status == Z_STREAM_END) {
+            _eof = true;
+        } else if (status != Z_OK && status != Z_BUF_ERROR) {
+            throw Exception("Failed to decompress '{}': {}", _base->displayPath(), zError(status));
+        } else if (_stream->avail_in == 0 && _baseEof && _stream->avail_out != 0) {
+            throw Exception("Failed to decompress '{}': unexpected end of compressed data", _base->displayPath());
+        }
+    }
+    return result;
+}
+
+size_t ZlibInputStream::skip(size_t size) {
+    char buffer[4096];
+
+    size_t result = 0;
+    while (result < size) {
+        size_t chunk = std::min(size - result, sizeof(buffer));
+        size_t bytes = read(buffer, chunk);
+        result += bytes;
+        if (bytes < chunk)
+            break;
+    }
+    return result;
+}
+
+void ZlibInputStream::close() {
+    closeInternal();
+}
+
+std::string ZlibInputStream::displayPath() const {
+    return _base ? _base->displayPath() : std::string();
+}
+
+void ZlibInputStream::closeInternal() {
+    if (!isOpen())
+        return;
+
+    inflateEnd(_stream.get());
+    _stream.reset();
+    _base = nullptr;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Utility/Streams/InputStream.h"
+
+struct z_stream_s;
+
+/**
+ * Input stream that decompresses zlib data read from another input stream on the fly. Meant for large entries that
+ * shouldn't be decompressed into memory as a whole.
+ *
+ * Doesn't take ownership of the base stream.
+ */
+class ZlibInputStream : public InputStream {
+ public:
+    ZlibInputStream();
+    explicit ZlibInputStream(InputStream *base);
+    virtual ~ZlibInputStream();
+
+    void open(InputStream *base);
+
+    [[nodiscard]] bool isOpen() const {
+        return _base != nullptr;
+    }
+
+    [[nodiscard]] virtual size_t read(void *data, size_t size) override;
+    [[nodiscard]] virtual size_t skip(size_t size) override;
+    virtual void close() override;
+    [[nodiscard]] virtual std::string displayPath() const override;
+
+ private:
+    void closeInternal();
+
+ private:
+    InputStream *_base = nullptr;
+    std::unique_ptr<z_stream_s> _stream;
+    std::unique_ptr<char[]> _buffer;
+    bool _baseEof = false;
+    bool _eof = false;
+};
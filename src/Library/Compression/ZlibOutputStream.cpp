@@ -0,0 +1,105 @@
+#include "ZlibOutputStream.h"
+
+#include <zlib.h>
+
+#include <cassert>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "Utility/Exception.h"
+#include "Utility/ScopeGuard.h"
+
+static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+ZlibOutputStream::ZlibOutputStream() = default;
+
+ZlibOutputStream::ZlibOutputStream(OutputStream *base) {
+    open(base);
+}
+
+ZlibOutputStream::~ZlibOutputStream() {
+    closeInternal(false);
+}
+
+void ZlibOutputStream::open(OutputStream *base) {
+    assert(base);
+
+    close();
+
+    std::unique_ptr<z_stream_s> stream = std::make_unique<z_stream_s>();
+    if (deflateInit(stream.get(), Z_DEFAULT_COMPRESSION) != Z_OK)
+        throw Exception("Failed to initialize zlib compression stream for '{}'", base->displayPath());
+
+    _base = base;
+    _stream = std::move(stream);
+    if (!_buffer)
+        _buffer = std::make_unique<char[]>(BUFFER_SIZE);
+}
+
+void ZlibOutputStream::write(const void *data, size_t size) {
+    assert(isOpen()); // Writing into a closed stream is UB.
+
+    const char *pos = static_cast<const char *>(data);
+    while (size > 0) {
+        size_t chunk = std::min<size_t>(size, std::numeric_limits<uInt>::max());
+        deflateInternal(pos, chunk, Z_NO_FLUSH);
+        pos += chunk;
+        size -= chunk;
+    }
+}
+
+void ZlibOutputStream::flush() {
+    assert(isOpen()); // Flushing a closed stream is UB.
+
+    deflateInternal(nullptr, 0, Z_SYNC_FLUSH);
+    _base->flush();
+}
+
+void ZlibOutputStream::close() {
+    closeInternal(true);
+}
+
+std::string ZlibOutputStream::displayPath() const {
+    return _base ? _base->displayPath() : std::string();
+}
+
+void ZlibOutputStream::deflateInternal(const void *data, size_t size, int mode) {
+    _stream->next_in = static_cast<Bytef *>(const_cast<void *>(data));
+    _stream->avail_in = size;
+
+    while (true) {
+        _stream->next_out = reinterpret_cast<Bytef *>(_buffer.get());
+        _stream->avail_out = BUFFER_SIZE;
+        int status = deflate(_stream.get(), mode);
+        if (status == Z_STREAM_ERROR)
+            throw Exception("Failed to compress '{}': {}", _base->displayPath(), zError(status));
+
+        size_t bytes = BUFFER_SIZE - _stream->avail_out;
+        if (bytes)
+            _base->write(_buffer.get(), bytes);
+
+        if (mode == Z_FINISH ? status == Z_STREAM_END : _stream->avail_out != 0)
+            break;
+    }
+    assert(_stream->avail_in == 0);
+}
+
+void ZlibOutputStream::closeInternal(bool canThrow) {
+    if (!isOpen())
+        return;
+
+    MM_AT_SCOPE_EXIT({
+        deflateEnd(_stream.get());
+        _stream.reset();
+        _base = nullptr;
+    });
+
+    try {
+        deflateInternal(nullptr, 0, Z_FINISH);
+    } catch (...) {
+        if (canThrow)
+            throw;
+    }
+}
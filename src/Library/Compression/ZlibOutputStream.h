@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Utility/Streams/OutputStream.h"
+
+struct z_stream_s;
+
+/**
+ * Output stream that compresses the data written into it and passes it on to another output stream. The resulting
+ * data can be decompressed with either `zlib::uncompress` or `ZlibInputStream`.
+ *
+ * Doesn't take ownership of the target stream. Closing this stream finishes the compressed data, but doesn't close
+ * the target stream.
+ */
+class ZlibOutputStream : public OutputStream {
+ public:
+    ZlibOutputStream();
+    explicit ZlibOutputStream(OutputStream *base);
+    virtual ~ZlibOutputStream();
+
+    void open(OutputStream *base);
+
+    [[nodiscard]] bool isOpen() const {
+        return _base != nullptr;
+    }
+
+    virtual void write(const void *data, size_t size) override;
+    using OutputStream::write;
+    virtual void flush() override;
+    virtual void close() override;
+    [[nodiscard]] virtual std::string displayPath() const override;
+
+ private:
+    void deflateInternal(const void *data, size_t size, int mode);
+    void closeInternal(bool canThrow);
+
+ private:
+    OutputStream *_base = nullptr;
+    std::unique_ptr<z_stream_s> _stream;
+    std::unique_ptr<char[]> _buffer;
+};
@@ -3,9 +3,9 @@
 #include <cassert>
 #include <utility>
 #include <algorithm>
-#include <unordered_map>
 #include <string>
 #include <vector>
+#include <tuple>
 
 #include "Library/Compression/Compression.h"
 #include "Library/Snapshots/SnapshotSerialization.h"
@@ -102,21 +102,40 @@ void LodReader::open(Blob blob, LodOpenFlags openFlags) {
     rootEntry.dataSize = blob.size() - rootEntry.dataOffset;
 
     BlobInputStream dirStream(blob.subBlob(rootEntry.dataOffset, rootEntry.dataSize));
-    std::unordered_map<std::string, LodRegion> files;
-    for (const LodEntry &entry : parseFileEntries(dirStream, rootEntry, version)) {
-        std::string name = ascii::toLower(entry.name);
-        if (files.contains(name)) {
-            if (openFlags & LOD_ALLOW_DUPLICATES) {
-                continue; // Only the first entry is kept in this case.
-            } else {
-                throw Exception("File '{}' is not a valid LOD: contains duplicate entries for '{}'", blob.displayPath(), name);
-            }
-        }
-
-        LodRegion region;
-        region.offset = rootEntry.dataOffset + entry.dataOffset;
-        region.size = entry.dataSize;
-        files.emplace(std::move(name), region);
+    std::vector<LodEntry> entries = parseFileEntries(dirStream, rootEntry, version);
+
+    std::string names;
+    std::vector<LodIndexEntry> index;
+    index.reserve(entries.size());
+    for (const LodEntry &entry : entries) {
+        LodIndexEntry &indexEntry = index.emplace_back();
+        indexEntry.hash = ascii::noCaseHash(entry.name);
+        indexEntry.nameOffset = names.size();
+        indexEntry.nameSize = entry.name.size();
+        indexEntry.region.offset = rootEntry.dataOffset + entry.dataOffset;
+        indexEntry.region.size = entry.dataSize;
+        names += ascii::toLower(entry.name);
+    }
+
+    // Stable sort so that for duplicate entries the one that comes first in the LOD directory also comes first here.
+    auto indexKey = [&names](const LodIndexEntry &entry) {
+        return std::tuple(entry.hash, std::string_view(names).substr(entry.nameOffset, entry.nameSize));
+    };
+    std::stable_sort(index.begin(), index.end(), [&](const LodIndexEntry &l, const LodIndexEntry &r) {
+        return indexKey(l) < indexKey(r);
+    });
+
+    auto duplicate = std::adjacent_find(index.begin(), index.end(), [&](const LodIndexEntry &l, const LodIndexEntry &r) {
+        return indexKey(l) == indexKey(r);
+    });
+    if (duplicate != index.end()) {
+        if (!(openFlags & LOD_ALLOW_DUPLICATES))
+            throw Exception("File '{}' is not a valid LOD: contains duplicate entries for '{}'", blob.displayPath(), std::get<1>(indexKey(*duplicate)));
+
+        // Only the first entry is kept in this case.
+        index.erase(std::unique(index.begin(), index.end(), [&](const LodIndexEntry &l, const LodIndexEntry &r) {
+            return indexKey(l) == indexKey(r);
+        }), index.end());
     }
 
     // All good, this is a valid LOD, can update `this`.
@@ -124,38 +143,81 @@ void LodReader::open(Blob blob, LodOpenFlags openFlags) {
     _info.version = version;
     _info.description = std::move(header.description);
     _info.rootName = std::move(rootEntry.name);
-    _files = std::move(files);
+    _names = std::move(names);
+    _index = std::move(index);
 }
 
 void LodReader::close() {
     // Double-closing is OK.
     _lod = Blob();
     _info = {};
-    _files = {};
+    _names = {};
+    _index = {};
 }
 
 bool LodReader::exists(std::string_view filename) const {
     assert(isOpen());
 
-    return _files.contains(ascii::toLower(filename));
+    return find(filename) != nullptr;
 }
 
 Blob LodReader::read(std::string_view filename) const {
     assert(isOpen());
 
-    const auto pos = _files.find(ascii::toLower(filename));
-    if (pos == _files.cend())
+    const LodIndexEntry *entry = find(filename);
+    if (!entry)
         throw Exception("Entry '{}' doesn't exist in LOD file '{}'", filename, _lod.displayPath());
 
-    return _lod.subBlob(pos->second.offset, pos->second.size).withDisplayPath(fmt::format("{}/{}", _lod.displayPath(), filename));
+    return read(*entry, filename);
+}
+
+std::vector<Blob> LodReader::readMany(std::span<const std::string_view> filenames) const {
+    assert(isOpen());
+
+    std::vector<const LodIndexEntry *> entries;
+    entries.reserve(filenames.size());
+    for (std::string_view filename : filenames) {
+        const LodIndexEntry *entry = find(filename);
+        if (!entry)
+            throw Exception("Entry '{}' doesn't exist in LOD file '{}'", filename, _lod.displayPath());
+        entries.push_back(entry);
+    }
+
+    std::vector<Blob> result;
+    result.reserve(filenames.size());
+    for (size_t i = 0; i < filenames.size(); i++)
+        result.push_back(read(*entries[i], filenames[i]));
+    return result;
+}
+
+std::optional<LodReader::LodRegion> LodReader::locate(std::string_view filename) const {
+    assert(isOpen());
+
+    const LodIndexEntry *entry = find(filename);
+    if (!entry)
+        return std::nullopt;
+    return entry->region;
+}
+
+const std::string &LodReader::displayPath() const {
+    assert(isOpen());
+
+    return _lod.displayPath();
+}
+
+size_t LodReader::fileSize() const {
+    assert(isOpen());
+
+    return _lod.size();
 }
 
 std::vector<std::string> LodReader::ls() const {
     assert(isOpen());
 
     std::vector<std::string> result;
-    for (const auto &[name, _] : _files)
-        result.push_back(name);
+    result.reserve(_index.size());
+    for (const LodIndexEntry &entry : _index)
+        result.emplace_back(name(entry));
     std::sort(result.begin(), result.end());
     return result;
 }
@@ -166,3 +228,22 @@ std::vector<std::string> LodReader::ls() const {
     return _info;
 }
 
+const LodReader::LodIndexEntry *LodReader::find(std::string_view filename) const {
+    size_t hash = ascii::noCaseHash(filename);
+
+    auto pos = std::lower_bound(_index.begin(), _index.end(), hash, [](const LodIndexEntry &entry, size_t value) {
+        return entry.hash < value;
+    });
+    for (; pos != _index.end() && pos->hash == hash; ++pos)
+        if (ascii::noCaseEquals(name(*pos), filename))
+            return &*pos;
+    return nullptr;
+}
+
+std::string_view LodReader::name(const LodIndexEntry &entry) const {
+    return std::string_view(_names).substr(entry.nameOffset, entry.nameSize);
+}
+
+Blob LodReader::read(const LodIndexEntry &entry, std::string_view filename) const {
+    return _lod.subBlob(entry.region.offset, entry.region.size).withDisplayPath(fmt::format("{}/{}", _lod.displayPath(), filename));
+}
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <span>
 #include <vector>
-#include <unordered_map>
 
 #include "Utility/Memory/Blob.h"
 
@@ -20,6 +23,11 @@ class InputStream;
  */
 class LodReader final {
  public:
+    struct LodRegion {
+        size_t offset = 0;
+        size_t size = 0;
+    };
+
     LodReader();
     LodReader(std::string_view path, LodOpenFlags openFlags = 0);
     LodReader(Blob blob, LodOpenFlags openFlags = 0);
@@ -62,6 +70,33 @@ class LodReader final {
      */
     [[nodiscard]] Blob read(std::string_view filename) const;
 
+    /**
+     * Bulk version of `read`. All entries are resolved before any data is returned, so this function either returns
+     * all of the requested entries, or throws.
+     *
+     * @param filenames                 Names of the LOD file entries.
+     * @return                          Contents of the requested files, in the same order as in `filenames`.
+     * @throws Exception                If any of the files doesn't exist inside the LOD.
+     */
+    [[nodiscard]] std::vector<Blob> readMany(std::span<const std::string_view> filenames) const;
+
+    /**
+     * @param filename                  Name of the LOD file entry.
+     * @return                          Location of the entry inside the LOD file, or `std::nullopt` if the entry
+     *                                  doesn't exist. Unlike `read`, this doesn't touch the entry data.
+     */
+    [[nodiscard]] std::optional<LodRegion> locate(std::string_view filename) const;
+
+    /**
+     * @return                          Display path of the LOD file, as passed to `open`.
+     */
+    [[nodiscard]] const std::string &displayPath() const;
+
+    /**
+     * @return                          Size of the LOD file, in bytes.
+     */
+    [[nodiscard]] size_t fileSize() const;
+
     /**
      * @return                          List of all files in a LOD.
      */
@@ -74,13 +109,20 @@ class LodReader final {
     [[nodiscard]] const LodInfo &info() const;
 
  private:
-    struct LodRegion {
-        size_t offset = 0;
-        size_t size = 0;
+    struct LodIndexEntry {
+        size_t hash = 0; // `ascii::noCaseHash` of the entry name.
+        uint32_t nameOffset = 0; // Offset of the lowercase entry name in `_names`.
+        uint32_t nameSize = 0;
+        LodRegion region;
     };
 
+    [[nodiscard]] const LodIndexEntry *find(std::string_view filename) const;
+    [[nodiscard]] std::string_view name(const LodIndexEntry &entry) const;
+    [[nodiscard]] Blob read(const LodIndexEntry &entry, std::string_view filename) const;
+
  private:
     Blob _lod;
     LodInfo _info;
-    std::unordered_map<std::string, LodRegion> _files;
+    std::string _names; // Lowercase names of all entries, concatenated.
+    std::vector<LodIndexEntry> _index; // Sorted by (hash, name), lookups are allocation-free binary searches.
 };
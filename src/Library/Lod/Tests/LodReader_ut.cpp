@@ -1,9 +1,16 @@
+#include <optional>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <utility>
 
 #include "Testing/Unit/UnitTest.h"
 
 #include "Library/Lod/LodReader.h"
+#include "Library/Lod/LodWriter.h"
+
+#include "Utility/Streams/BlobOutputStream.h"
+#include "Utility/String/Format.h"
 
 const char brokenLod[] =
     "LOD\0"         "Game"          "MMVI"          "\0\0\0\0"      // signature, version
@@ -62,3 +69,56 @@ UNIT_TEST(LodReader, DisplayPath) {
     EXPECT_EQ(reader.read("lolkek").displayPath(), "russian.lod/lolkek");
     EXPECT_EQ(reader.read("LOLKEK").displayPath(), "russian.lod/LOLKEK");
 }
+
+UNIT_TEST(LodReader, Locate) {
+    LodReader reader(Blob::view(brokenLod, sizeof(brokenLod)).withDisplayPath("russian.lod"), LOD_ALLOW_DUPLICATES);
+    EXPECT_EQ(reader.displayPath(), "russian.lod");
+    EXPECT_EQ(reader.fileSize(), sizeof(brokenLod));
+
+    std::optional<LodReader::LodRegion> region = reader.locate("LolKek");
+    ASSERT_TRUE(region);
+    EXPECT_EQ(region->offset, 320); // Directory offset + entry offset.
+    EXPECT_EQ(region->size, 16);
+    EXPECT_FALSE(reader.locate("lolke"));
+}
+
+static Blob manyFilesLod() {
+    LodInfo info;
+    info.version = LOD_VERSION_MM7;
+    info.rootName = "data";
+
+    Blob lod;
+    BlobOutputStream stream(&lod, "some.lod");
+    LodWriter writer(&stream, info);
+    for (int i = 0; i < 1000; i++)
+        writer.write(fmt::format("File{}.Txt", i), Blob::fromString(std::to_string(i)));
+    writer.close();
+    stream.close();
+    return lod;
+}
+
+UNIT_TEST(LodReader, ManyFilesLookup) {
+    LodReader reader(manyFilesLod());
+    EXPECT_EQ(reader.ls().size(), 1000);
+    for (int i = 0; i < 1000; i++) {
+        EXPECT_TRUE(reader.exists(fmt::format("file{}.txt", i)));
+        EXPECT_TRUE(reader.exists(fmt::format("FILE{}.TXT", i)));
+        EXPECT_EQ(reader.read(fmt::format("fILE{}.tXT", i)).string_view(), std::to_string(i));
+    }
+    EXPECT_FALSE(reader.exists("file1000.txt"));
+}
+
+UNIT_TEST(LodReader, ReadMany) {
+    LodReader reader(manyFilesLod());
+
+    std::vector<std::string_view> names = {"file3.txt", "FILE1.TXT", "file3.TXT"};
+    std::vector<Blob> blobs = reader.readMany(names);
+    ASSERT_EQ(blobs.size(), 3);
+    EXPECT_EQ(blobs[0].string_view(), "3");
+    EXPECT_EQ(blobs[1].string_view(), "1");
+    EXPECT_EQ(blobs[2].string_view(), "3");
+    EXPECT_EQ(blobs[1].displayPath(), "some.lod/FILE1.TXT");
+
+    names.push_back("file1000.txt");
+    EXPECT_THROW((void) reader.readMany(names), std::exception);
+}
@@ -212,11 +212,18 @@ LodImage lod::decodeImage(const Blob &blob) {
     LodImageHeader_MM6 header;
     deserialize(stream, &header);
 
+    LodImage result;
     Blob pixels;
     if (format == LOD_FILE_IMAGE) {
         pixels = stream.readBlobOrFail(header.dataSize);
-        if (header.decompressedSize)
+        if (header.decompressedSize == header.width * header.height && header.decompressedSize) {
+            // Common case, decompress straight into the target image.
+            result.image = GrayscaleImage::uninitialized(header.width, header.height);
+            size_t size = zlib::uncompressInto(pixels, result.image.pixels().data(), result.image.pixels().size());
+            pixels = Blob::view(result.image.pixels().data(), size);
+        } else if (header.decompressedSize) {
             pixels = zlib::uncompress(pixels, header.decompressedSize);
+        }
 
         // Note that this check isn't redundant. The checks in magic() only check sizes as written in the header.
         // Actual stream size might be different.
@@ -226,12 +233,11 @@ LodImage lod::decodeImage(const Blob &blob) {
                             header.width * header.height, pixels.size());
     }
 
-    LodImage result;
     deserialize(stream, &result.palette);
     result.zeroIsTransparent = header.flags & 512;
 
     // TODO(captainurist): just store blob in GrayscaleImage, no need to copy here.
-    if (pixels)
+    if (pixels && !result.image)
         result.image = GrayscaleImage::copy(header.width, header.height, static_cast<const uint8_t *>(pixels.data())); // NOLINT: this is not std::copy.
     return result;
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -10,6 +11,8 @@
 
 #include "Io/Key.h" // TODO(captainurist): doesn't belong here
 
+#include "Utility/Exception.h"
+
 #include "PaintEvent.h"
 
 MM_DEFINE_JSON_STRUCT_SERIALIZATION_FUNCTIONS(Pointi, (
@@ -243,6 +246,247 @@ EventTrace EventTrace::fromJsonBlob(const Blob &blob, PlatformWindow *window) {
     return result;
 }
 
+static constexpr std::string_view BINARY_TRACE_MAGIC = "OETB";
+static constexpr int BINARY_TRACE_VERSION = 1;
+
+// Record tags in binary traces. Tags past `BINARY_TAG_EVENT` are events, `tag - BINARY_TAG_EVENT` being the index of
+// the interned event type name.
+static constexpr uint64_t BINARY_TAG_STRING = 0;
+static constexpr uint64_t BINARY_TAG_END = 1;
+static constexpr uint64_t BINARY_TAG_EVENT = 2;
+
+namespace {
+
+/**
+ * Writer side of the binary trace format, see `EventTrace::toBinaryBlob`.
+ */
+class BinaryTraceWriter {
+ public:
+    void writeVarint(uint64_t value) {
+        while (value >= 0x80) {
+            _data.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        _data.push_back(static_cast<char>(value));
+    }
+
+    void writeSigned(int64_t value) {
+        writeVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    void writeString(std::string_view value) {
+        writeVarint(value.size());
+        _data.append(value);
+    }
+
+    /**
+     * Interns the provided string, writing out a definition record if it wasn't seen before. Must be called before
+     * the record that uses the string is started.
+     *
+     * @param value                     String to intern.
+     * @return                          Index of the interned string.
+     */
+    int intern(const std::string &value) {
+        auto [pos, inserted] = _strings.emplace(value, _strings.size());
+        if (inserted) {
+            writeVarint(BINARY_TAG_STRING);
+            writeString(value);
+        }
+        return pos->second;
+    }
+
+    std::string &data() {
+        return _data;
+    }
+
+ private:
+    std::string _data;
+    std::unordered_map<std::string, int> _strings;
+};
+
+/**
+ * Reader side of the binary trace format, works on top of the cursor stored in `EventTraceReader`.
+ */
+class BinaryTraceInput {
+ public:
+    BinaryTraceInput(const char **pos, const char *end, const std::string &displayPath) :
+        _pos(pos), _end(end), _displayPath(displayPath) {}
+
+    uint64_t readVarint() {
+        uint64_t result = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (*_pos == _end)
+                throw Exception("Unexpected end of binary trace '{}'", _displayPath);
+            uint8_t byte = **_pos;
+            ++*_pos;
+            result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return result;
+        }
+        throw Exception("Invalid varint in binary trace '{}'", _displayPath);
+    }
+
+    int64_t readSigned() {
+        uint64_t value = readVarint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    std::string_view readString() {
+        uint64_t size = readVarint();
+        if (size > static_cast<uint64_t>(_end - *_pos))
+            throw Exception("Unexpected end of binary trace '{}'", _displayPath);
+        std::string_view result(*_pos, size);
+        *_pos += size;
+        return result;
+    }
+
+    const std::string &readStringRef(const std::vector<std::string> &strings) {
+        return stringAt(strings, readVarint());
+    }
+
+    const std::string &stringAt(const std::vector<std::string> &strings, uint64_t index) {
+        if (index >= strings.size())
+            throw Exception("Invalid string reference {} in binary trace '{}'", index, _displayPath);
+        return strings[index];
+    }
+
+ private:
+    const char **_pos;
+    const char *_end;
+    const std::string &_displayPath;
+};
+
+} // namespace
+
+static void writeBinary(BinaryTraceWriter *dst, const EventTraceGameState &src) {
+    dst->writeString(src.locationName);
+    dst->writeSigned(src.partyPosition.x);
+    dst->writeSigned(src.partyPosition.y);
+    dst->writeSigned(src.partyPosition.z);
+    dst->writeVarint(src.characters.size());
+    for (const EventTraceCharacterState &character : src.characters) {
+        for (int value : {character.hp, character.mp, character.might, character.intelligence, character.personality,
+                          character.endurance, character.accuracy, character.speed, character.luck})
+            dst->writeSigned(value);
+        for (const std::vector<std::string> *items : {&character.equipment, &character.backpack}) {
+            dst->writeVarint(items->size());
+            for (const std::string &item : *items)
+                dst->writeString(item);
+        }
+    }
+}
+
+static void readBinary(BinaryTraceInput *src, EventTraceGameState *dst) {
+    dst->locationName = src->readString();
+    dst->partyPosition.x = src->readSigned();
+    dst->partyPosition.y = src->readSigned();
+    dst->partyPosition.z = src->readSigned();
+    dst->characters.resize(src->readVarint());
+    for (EventTraceCharacterState &character : dst->characters) {
+        for (int *value : {&character.hp, &character.mp, &character.might, &character.intelligence,
+                           &character.personality, &character.endurance, &character.accuracy, &character.speed,
+                           &character.luck})
+            *value = src->readSigned();
+        for (std::vector<std::string> *items : {&character.equipment, &character.backpack}) {
+            items->resize(src->readVarint());
+            for (std::string &item : *items)
+                item = src->readString();
+        }
+    }
+}
+
+Blob EventTrace::toBinaryBlob(const EventTrace &trace) {
+    BinaryTraceWriter dst;
+    dst.data().append(BINARY_TRACE_MAGIC);
+    dst.writeVarint(BINARY_TRACE_VERSION);
+
+    const EventTraceHeader &header = trace.header;
+    dst.writeSigned(header.saveFileSize);
+    dst.writeVarint(header.config.entries().size());
+    for (const ConfigPatchEntry &entry : header.config.entries()) {
+        dst.writeString(entry.section);
+        dst.writeString(entry.key);
+        dst.writeString(entry.value);
+    }
+    writeBinary(&dst, header.startState);
+    writeBinary(&dst, header.endState);
+    dst.writeSigned(header.afterLoadRandomState);
+
+    int64_t lastTickCount = 0;
+    Pointi lastMousePos;
+    for (const std::unique_ptr<PlatformEvent> &event : trace.events) {
+        int type = dst.intern(toString(event->type));
+
+        dispatchByEventType(event->type, [&]<class T>(T *) {
+            const T *e = static_cast<const T *>(event.get());
+
+            // Strings have to be interned before the event record is started.
+            if constexpr (std::is_same_v<T, PlatformKeyEvent>) {
+                int key = dst.intern(toString(e->key));
+                int mods = dst.intern(toString(e->mods));
+                dst.writeVarint(BINARY_TAG_EVENT + type);
+                dst.writeVarint(key);
+                dst.writeVarint(mods);
+                dst.writeVarint(e->isAutoRepeat);
+            } else if constexpr (std::is_same_v<T, PlatformMouseEvent>) {
+                int button = dst.intern(toString(e->button));
+                int buttons = dst.intern(toString(e->buttons));
+                dst.writeVarint(BINARY_TAG_EVENT + type);
+                dst.writeVarint(button);
+                dst.writeVarint(buttons);
+                dst.writeSigned(e->pos.x - lastMousePos.x);
+                dst.writeSigned(e->pos.y - lastMousePos.y);
+                dst.writeVarint(e->isDoubleClick);
+                lastMousePos = e->pos;
+            } else if constexpr (std::is_same_v<T, PlatformWheelEvent>) {
+                dst.writeVarint(BINARY_TAG_EVENT + type);
+                dst.writeSigned(e->angleDelta.x);
+                dst.writeSigned(e->angleDelta.y);
+            } else if constexpr (std::is_same_v<T, PlatformMoveEvent>) {
+                dst.writeVarint(BINARY_TAG_EVENT + type);
+                dst.writeSigned(e->pos.x);
+                dst.writeSigned(e->pos.y);
+            } else if constexpr (std::is_same_v<T, PlatformResizeEvent>) {
+                dst.writeVarint(BINARY_TAG_EVENT + type);
+                dst.writeSigned(e->size.w);
+                dst.writeSigned(e->size.h);
+            } else if constexpr (std::is_same_v<T, PaintEvent>) {
+                dst.writeVarint(BINARY_TAG_EVENT + type);
+                dst.writeSigned(e->tickCount - lastTickCount);
+                dst.writeSigned(e->randomState);
+                lastTickCount = e->tickCount;
+            } else {
+                static_assert(std::is_same_v<T, PlatformWindowEvent>);
+                dst.writeVarint(BINARY_TAG_EVENT + type);
+            }
+        });
+    }
+    dst.writeVarint(BINARY_TAG_END); // So that truncated traces can be detected.
+
+    return Blob::fromString(std::move(dst.data()));
+}
+
+EventTrace EventTrace::fromBinaryBlob(const Blob &blob, PlatformWindow *window) {
+    if (!isBinaryBlob(blob))
+        throw Exception("'{}' is not a binary trace", blob.displayPath());
+
+    EventTraceReader reader(blob, window);
+
+    EventTrace result;
+    result.header = reader.header();
+    while (std::unique_ptr<PlatformEvent> event = reader.readEvent())
+        result.events.push_back(std::move(event));
+    return result;
+}
+
+bool EventTrace::isBinaryBlob(const Blob &blob) {
+    return blob.string_view().starts_with(BINARY_TRACE_MAGIC);
+}
+
+EventTrace EventTrace::fromBlob(const Blob &blob, PlatformWindow *window) {
+    return isBinaryBlob(blob) ? fromBinaryBlob(blob, window) : fromJsonBlob(blob, window);
+}
+
 bool EventTrace::isTraceable(const PlatformEvent *event) {
     bool result = false;
     dispatchByEventType(event->type, [&](auto) { result = true; }); // Callback not invoked => not supported.
@@ -260,3 +504,98 @@ std::unique_ptr<PlatformEvent> EventTrace::cloneEvent(const PlatformEvent *event
 
     return result;
 }
+
+EventTraceReader::EventTraceReader(const Blob &blob, PlatformWindow *window) : _blob(Blob::share(blob)), _window(window) {
+    if (!EventTrace::isBinaryBlob(_blob)) {
+        EventTrace trace = EventTrace::fromJsonBlob(_blob, window);
+        _header = std::move(trace.header);
+        _events = std::move(trace.events);
+        return;
+    }
+
+    _pos = static_cast<const char *>(_blob.data()) + BINARY_TRACE_MAGIC.size();
+    _end = static_cast<const char *>(_blob.data()) + _blob.size();
+    BinaryTraceInput src(&_pos, _end, _blob.displayPath());
+
+    uint64_t version = src.readVarint();
+    if (version != BINARY_TRACE_VERSION)
+        throw Exception("Unsupported binary trace version {} in '{}', expected {}", version, _blob.displayPath(),
+                        BINARY_TRACE_VERSION);
+
+    _header.saveFileSize = src.readSigned();
+    std::vector<ConfigPatchEntry> entries(src.readVarint());
+    for (ConfigPatchEntry &entry : entries) {
+        entry.section = src.readString();
+        entry.key = src.readString();
+        entry.value = src.readString();
+    }
+    _header.config = ConfigPatch::fromEntries(std::move(entries));
+    readBinary(&src, &_header.startState);
+    readBinary(&src, &_header.endState);
+    _header.afterLoadRandomState = src.readSigned();
+}
+
+EventTraceReader::~EventTraceReader() = default;
+
+std::unique_ptr<PlatformEvent> EventTraceReader::readEvent() {
+    if (!_pos)
+        return _nextEvent < _events.size() ? std::move(_events[_nextEvent++]) : nullptr;
+    if (_finished)
+        return nullptr;
+
+    BinaryTraceInput src(&_pos, _end, _blob.displayPath());
+    while (true) {
+        uint64_t tag = src.readVarint();
+        if (tag == BINARY_TAG_END) {
+            _finished = true;
+            return nullptr;
+        }
+
+        if (tag == BINARY_TAG_STRING) {
+            _strings.emplace_back(src.readString());
+            continue;
+        }
+
+        PlatformEventType type = fromString<PlatformEventType>(src.stringAt(_strings, tag - BINARY_TAG_EVENT));
+        std::unique_ptr<PlatformEvent> result;
+        dispatchByEventType(type, [&]<class T>(T *) {
+            std::unique_ptr<T> e = std::make_unique<T>();
+            e->type = type;
+
+            if constexpr (std::is_same_v<T, PlatformKeyEvent>) {
+                e->key = fromString<PlatformKey>(src.readStringRef(_strings));
+                e->mods = fromString<PlatformModifiers>(src.readStringRef(_strings));
+                e->isAutoRepeat = src.readVarint();
+            } else if constexpr (std::is_same_v<T, PlatformMouseEvent>) {
+                e->button = fromString<PlatformMouseButton>(src.readStringRef(_strings));
+                e->buttons = fromString<PlatformMouseButtons>(src.readStringRef(_strings));
+                e->pos.x = _lastMousePos.x + src.readSigned();
+                e->pos.y = _lastMousePos.y + src.readSigned();
+                e->isDoubleClick = src.readVarint();
+                _lastMousePos = e->pos;
+            } else if constexpr (std::is_same_v<T, PlatformWheelEvent>) {
+                e->angleDelta.x = src.readSigned();
+                e->angleDelta.y = src.readSigned();
+            } else if constexpr (std::is_same_v<T, PlatformMoveEvent>) {
+                e->pos.x = src.readSigned();
+                e->pos.y = src.readSigned();
+            } else if constexpr (std::is_same_v<T, PlatformResizeEvent>) {
+                e->size.w = src.readSigned();
+                e->size.h = src.readSigned();
+            } else if constexpr (std::is_same_v<T, PaintEvent>) {
+                e->tickCount = _lastTickCount + src.readSigned();
+                e->randomState = src.readSigned();
+                _lastTickCount = e->tickCount;
+            }
+
+            if constexpr (std::is_base_of_v<PlatformWindowEvent, T>)
+                e->window = _window;
+
+            result = std::move(e);
+        });
+
+        if (!result)
+            throw Exception("Unsupported event type '{}' in binary trace '{}'", toString(type), _blob.displayPath());
+        return result;
+    }
+}
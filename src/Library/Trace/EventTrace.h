@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <string_view>
 #include <memory>
@@ -7,6 +8,7 @@
 
 #include "Library/Platform/Interface/PlatformEvents.h"
 #include "Library/Config/ConfigPatch.h"
+#include "Library/Geometry/Point.h"
 #include "Library/Geometry/Vec.h"
 
 #include "Utility/Memory/Blob.h"
@@ -56,9 +58,87 @@ struct EventTrace {
     static Blob toJsonBlob(const EventTrace &trace);
     static EventTrace fromJsonBlob(const Blob &blob, PlatformWindow *window);
 
+    /**
+     * Serializes the provided trace into a compact binary format.
+     *
+     * Binary traces start with a magic & a format version, followed by the header and then by a flat sequence of
+     * records. All integers are varint-encoded, signed ones are zigzag-encoded first. Event types and enum values
+     * (keys, mouse buttons, modifiers) are stored as interned strings - the first occurrence of a string is written
+     * out as a separate definition record, and all subsequent records refer to it by index. Tick counts in paint
+     * events and mouse positions are delta-coded.
+     *
+     * Unlike JSON traces, binary traces can be read incrementally, see `EventTraceReader`.
+     *
+     * @param trace                     Trace to serialize.
+     * @return                          Binary trace.
+     */
+    static Blob toBinaryBlob(const EventTrace &trace);
+    static EventTrace fromBinaryBlob(const Blob &blob, PlatformWindow *window);
+
+    /**
+     * @param blob                      Trace data.
+     * @return                          Whether the provided blob contains a binary trace, as produced by
+     *                                  `toBinaryBlob`.
+     */
+    static bool isBinaryBlob(const Blob &blob);
+
+    /**
+     * Deserializes a trace in any of the supported formats.
+     *
+     * @param blob                      Trace data, either JSON or binary.
+     * @param window                    Window to use for the deserialized window events.
+     * @return                          Deserialized trace.
+     */
+    static EventTrace fromBlob(const Blob &blob, PlatformWindow *window);
+
     static bool isTraceable(const PlatformEvent *event);
     static std::unique_ptr<PlatformEvent> cloneEvent(const PlatformEvent *event);
 
     EventTraceHeader header;
     std::vector<std::unique_ptr<PlatformEvent>> events;
 };
+
+/**
+ * Streaming trace reader.
+ *
+ * The header is parsed right away in the constructor, while events of binary traces are decoded one by one as they
+ * are requested, so that playback can start without parsing the whole trace first. JSON traces are parsed in full in
+ * the constructor.
+ */
+class EventTraceReader {
+ public:
+    /**
+     * @param blob                      Trace data, either JSON or binary. Reader keeps a shared copy of the blob.
+     * @param window                    Window to use for the deserialized window events.
+     * @throws Exception                If the trace couldn't be parsed.
+     */
+    EventTraceReader(const Blob &blob, PlatformWindow *window);
+    ~EventTraceReader();
+
+    [[nodiscard]] const EventTraceHeader &header() const {
+        return _header;
+    }
+
+    /**
+     * @return                          Next event in the trace, or `nullptr` if there are no more events.
+     * @throws Exception                If the trace data is corrupted.
+     */
+    [[nodiscard]] std::unique_ptr<PlatformEvent> readEvent();
+
+ private:
+    Blob _blob;
+    PlatformWindow *_window = nullptr;
+    EventTraceHeader _header;
+
+    // Binary traces.
+    const char *_pos = nullptr;
+    const char *_end = nullptr;
+    std::vector<std::string> _strings;
+    int64_t _lastTickCount = 0;
+    Pointi _lastMousePos;
+    bool _finished = false;
+
+    // JSON traces.
+    std::vector<std::unique_ptr<PlatformEvent>> _events;
+    size_t _nextEvent = 0;
+};
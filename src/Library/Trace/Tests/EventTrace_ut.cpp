@@ -0,0 +1,102 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Trace/EventTrace.h"
+#include "Library/Trace/PaintEvent.h"
+
+template<class T>
+static T &addEvent(EventTrace *trace, PlatformEventType type) {
+    std::unique_ptr<T> event = std::make_unique<T>();
+    event->type = type;
+    T &result = *event;
+    trace->events.push_back(std::move(event));
+    return result;
+}
+
+static EventTrace makeTestTrace() {
+    EventTrace result;
+    result.header.saveFileSize = 123456;
+    result.header.config = ConfigPatch::fromEntries({{"debug", "trace_frame_time_ms", "50"}});
+    result.header.startState.locationName = "out01.odm";
+    result.header.startState.partyPosition = Vec3i(-12000, 5000, 96);
+    result.header.startState.characters.resize(2);
+    result.header.startState.characters[0].hp = -5;
+    result.header.startState.characters[0].equipment = {"Longsword", "Leather Armor"};
+    result.header.startState.characters[1].backpack = {"Potion Bottle"};
+    result.header.endState.locationName = "d01.blv";
+    result.header.afterLoadRandomState = -7;
+
+    for (int i = 0; i < 3; i++) {
+        PaintEvent &paint = addEvent<PaintEvent>(&result, EVENT_PAINT);
+        paint.tickCount = 1000 + i * 16;
+        paint.randomState = i * 1000000007;
+    }
+
+    PlatformKeyEvent &key = addEvent<PlatformKeyEvent>(&result, EVENT_KEY_PRESS);
+    key.key = PlatformKey::KEY_A;
+    key.mods = MOD_SHIFT | MOD_CTRL;
+    addEvent<PlatformKeyEvent>(&result, EVENT_KEY_RELEASE).key = PlatformKey::KEY_A;
+
+    PlatformMouseEvent &press = addEvent<PlatformMouseEvent>(&result, EVENT_MOUSE_BUTTON_PRESS);
+    press.button = BUTTON_LEFT;
+    press.buttons = BUTTON_LEFT;
+    press.pos = Pointi(320, 240);
+    press.isDoubleClick = true;
+    addEvent<PlatformMouseEvent>(&result, EVENT_MOUSE_MOVE).pos = Pointi(10, 470);
+
+    addEvent<PlatformWheelEvent>(&result, EVENT_MOUSE_WHEEL).angleDelta = Pointi(0, -120);
+    addEvent<PlatformMoveEvent>(&result, EVENT_WINDOW_MOVE).pos = Pointi(-100, 100);
+    addEvent<PlatformResizeEvent>(&result, EVENT_WINDOW_RESIZE).size = Sizei(640, 480);
+    addEvent<PlatformWindowEvent>(&result, EVENT_WINDOW_ACTIVATE);
+    return result;
+}
+
+UNIT_TEST(EventTrace, BinaryRoundTrip) {
+    EventTrace trace = makeTestTrace();
+    Blob json = EventTrace::toJsonBlob(trace);
+    Blob binary = EventTrace::toBinaryBlob(trace);
+
+    EXPECT_TRUE(EventTrace::isBinaryBlob(binary));
+    EXPECT_FALSE(EventTrace::isBinaryBlob(json));
+    EXPECT_LT(binary.size(), json.size());
+
+    EventTrace loaded = EventTrace::fromBlob(binary, nullptr);
+    EXPECT_EQ(EventTrace::toJsonBlob(loaded).string_view(), json.string_view());
+    EXPECT_EQ(EventTrace::toBinaryBlob(loaded).string_view(), binary.string_view());
+    EXPECT_EQ(EventTrace::toJsonBlob(EventTrace::fromBlob(json, nullptr)).string_view(), json.string_view());
+}
+
+UNIT_TEST(EventTrace, Reader) {
+    EventTrace trace = makeTestTrace();
+
+    for (const Blob &blob : {EventTrace::toJsonBlob(trace), EventTrace::toBinaryBlob(trace)}) {
+        EventTraceReader reader(blob, nullptr);
+        EXPECT_EQ(reader.header().saveFileSize, trace.header.saveFileSize);
+        EXPECT_EQ(reader.header().startState.partyPosition, trace.header.startState.partyPosition);
+
+        for (const std::unique_ptr<PlatformEvent> &expected : trace.events) {
+            std::unique_ptr<PlatformEvent> event = reader.readEvent();
+            ASSERT_NE(event, nullptr);
+            EXPECT_EQ(event->type, expected->type);
+        }
+        EXPECT_EQ(reader.readEvent(), nullptr);
+        EXPECT_EQ(reader.readEvent(), nullptr);
+    }
+}
+
+UNIT_TEST(EventTrace, BinaryErrors) {
+    std::string binary = std::string(EventTrace::toBinaryBlob(makeTestTrace()).string_view());
+
+    // Truncated trace.
+    EXPECT_ANY_THROW((void) EventTrace::fromBinaryBlob(Blob::fromString(binary.substr(0, binary.size() - 1)), nullptr));
+
+    // Unknown version.
+    std::string future = binary;
+    future[4] = 100;
+    EXPECT_ANY_THROW((void) EventTrace::fromBinaryBlob(Blob::fromString(future), nullptr));
+
+    EXPECT_ANY_THROW((void) EventTrace::fromBinaryBlob(Blob::fromString("{}"), nullptr));
+}
@@ -0,0 +1,98 @@
+#include <string_view>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Library/Tsv/TsvReader.h"
+
+#include "Utility/Exception.h"
+
+UNIT_TEST(TsvReader, Lines) {
+    TsvReader tsv("header\r\n1\ta\t\r\n\r\nmulti\nline\r\r\nlast");
+
+    tsv.skipLines(1);
+    EXPECT_EQ(tsv.lineNumber(), 1);
+    EXPECT_EQ(tsv.line(), "header");
+
+    tsv.readLine();
+    EXPECT_EQ(tsv.fieldCount(), 3);
+    EXPECT_EQ(tsv.field(0), "1");
+    EXPECT_EQ(tsv.field(1), "a");
+    EXPECT_EQ(tsv.field(2), "");
+
+    tsv.readLine();
+    EXPECT_EQ(tsv.line(), "");
+    EXPECT_EQ(tsv.fieldCount(), 1);
+
+    tsv.readLine();
+    EXPECT_EQ(tsv.line(), "multi\nline");
+
+    tsv.readLine();
+    EXPECT_EQ(tsv.line(), "last");
+    EXPECT_EQ(tsv.lineNumber(), 5);
+
+    EXPECT_FALSE(tsv.tryReadLine());
+    EXPECT_THROW(tsv.readLine(), Exception);
+}
+
+UNIT_TEST(TsvReader, TrailingSeparator) {
+    TsvReader tsv("a\r\nb\r\n");
+    EXPECT_TRUE(tsv.tryReadLine());
+    EXPECT_TRUE(tsv.tryReadLine());
+    EXPECT_TRUE(tsv.tryReadLine());
+    EXPECT_EQ(tsv.line(), "");
+    EXPECT_FALSE(tsv.tryReadLine());
+}
+
+UNIT_TEST(TsvReader, EmbeddedZero) {
+    TsvReader tsv(std::string_view("a\r\nb\0c\r\nd", 9));
+    EXPECT_TRUE(tsv.tryReadLine());
+    EXPECT_TRUE(tsv.tryReadLine());
+    EXPECT_EQ(tsv.line(), "b");
+    EXPECT_FALSE(tsv.tryReadLine());
+}
+
+UNIT_TEST(TsvReader, LeadingFieldCount) {
+    TsvReader tsv("1\t2\t\t4");
+    tsv.readLine();
+    EXPECT_EQ(tsv.leadingFieldCount(10), 2);
+    EXPECT_EQ(tsv.leadingFieldCount(1), 1);
+    EXPECT_EQ(tsv.fieldCount(), 4);
+}
+
+UNIT_TEST(TsvReader, Errors) {
+    TsvReader tsv("header\r\n1\t2", "table.txt");
+    tsv.skipLines(2);
+    EXPECT_EQ(tsv.intField(1), 2);
+
+    try {
+        (void) tsv.field(3);
+        FAIL();
+    } catch (const Exception &e) {
+        EXPECT_EQ(std::string_view(e.what()), "Error parsing 'table.txt' at line 2, column 4: expected at least 4 fields, got 2");
+    }
+}
+
+UNIT_TEST(TsvReader, ToInt) {
+    EXPECT_EQ(TsvReader::toInt("42"), 42);
+    EXPECT_EQ(TsvReader::toInt("  -42"), -42);
+    EXPECT_EQ(TsvReader::toInt("+42"), 42);
+    EXPECT_EQ(TsvReader::toInt("3d6"), 3);
+    EXPECT_EQ(TsvReader::toInt("\"10\""), 0);
+    EXPECT_EQ(TsvReader::toInt(""), 0);
+    EXPECT_EQ(TsvReader::toInt("-"), 0);
+    EXPECT_EQ(TsvReader::toInt("abc"), 0);
+    EXPECT_EQ(TsvReader::toInt("2147483647"), 2147483647);
+    EXPECT_EQ(TsvReader::toInt("-2147483648"), -2147483648LL);
+
+    // Should stop at the end of the view, not at the end of the underlying string.
+    EXPECT_EQ(TsvReader::toInt(std::string_view("123").substr(0, 2)), 12);
+}
+
+UNIT_TEST(TsvReader, ToFloat) {
+    EXPECT_EQ(TsvReader::toFloat("1.5"), 1.5f);
+    EXPECT_EQ(TsvReader::toFloat(" +1.5x"), 1.5f);
+    EXPECT_EQ(TsvReader::toFloat("-2"), -2.0f);
+    EXPECT_EQ(TsvReader::toFloat(".5"), 0.5f);
+    EXPECT_EQ(TsvReader::toFloat(""), 0.0f);
+    EXPECT_EQ(TsvReader::toFloat("x"), 0.0f);
+}
@@ -0,0 +1,106 @@
+#include "TsvReader.h"
+
+#include <fast_float/fast_float.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "Utility/Memory/Blob.h"
+#include "Utility/String/Ascii.h"
+#include "Utility/String/Split.h"
+#include "Utility/Exception.h"
+
+TsvReader::TsvReader(const Blob &blob) : TsvReader(blob.string_view(), blob.displayPath()) {}
+
+TsvReader::TsvReader(std::string_view text, std::string_view displayPath) : _text(text), _displayPath(displayPath) {
+    _text = _text.substr(0, _text.find('\0'));
+}
+
+bool TsvReader::tryReadLine() {
+    if (_atEnd) {
+        _line = {};
+        _fields.clear();
+        return false;
+    }
+
+    size_t end = _text.find('\r', _pos);
+    if (end == std::string_view::npos) {
+        _line = _text.substr(_pos);
+        _pos = _text.size();
+        _atEnd = true;
+    } else {
+        _line = _text.substr(_pos, end - _pos);
+        _pos = end;
+        while (_pos < _text.size() && _text[_pos] == '\r')
+            _pos++;
+        if (_pos < _text.size() && _text[_pos] == '\n')
+            _pos++;
+    }
+
+    _lineNumber++;
+    split(_line, '\t', &_fields);
+    return true;
+}
+
+void TsvReader::readLine() {
+    if (!tryReadLine())
+        throw Exception("Error parsing '{}': unexpected end of file after line {}", _displayPath, _lineNumber);
+}
+
+void TsvReader::skipLines(int count) {
+    for (int i = 0; i < count; i++)
+        readLine();
+}
+
+size_t TsvReader::leadingFieldCount(size_t limit) const {
+    limit = std::min(limit, _fields.size());
+    for (size_t i = 0; i < limit; i++)
+        if (_fields[i].empty())
+            return i;
+    return limit;
+}
+
+int TsvReader::toInt(std::string_view text) {
+    const char *pos = text.data();
+    const char *end = text.data() + text.size();
+    while (pos < end && ascii::isSpace(*pos))
+        pos++;
+
+    bool negative = false;
+    if (pos < end && (*pos == '+' || *pos == '-'))
+        negative = *pos++ == '-';
+
+    uint64_t value = 0;
+    std::from_chars_result result = std::from_chars(pos, end, value);
+    if (result.ec == std::errc::result_out_of_range)
+        value = std::numeric_limits<uint64_t>::max();
+
+    // Wraps around on overflow, no reason to do better here.
+    return static_cast<int>(negative ? 0 - value : value);
+}
+
+float TsvReader::toFloat(std::string_view text) {
+    const char *pos = text.data();
+    const char *end = text.data() + text.size();
+    while (pos < end && ascii::isSpace(*pos))
+        pos++;
+    if (pos < end && *pos == '+' && (pos + 1 == end || pos[1] != '-'))
+        pos++;
+
+    double value = 0.0;
+    fast_float::from_chars_result result = fast_float::from_chars(pos, end, value);
+    if (result.ec != std::errc() && result.ec != std::errc::result_out_of_range)
+        return 0.0f;
+    return static_cast<float>(value);
+}
+
+void TsvReader::throwMissingField(size_t column) const {
+    throwErrorInternal(column, fmt::format("expected at least {} fields, got {}", column + 1, _fields.size()));
+}
+
+void TsvReader::throwErrorInternal(size_t column, std::string_view message) const {
+    throw Exception("Error parsing '{}' at line {}, column {}: {}", _displayPath, _lineNumber, column + 1, message);
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Utility/String/Format.h"
+
+class Blob;
+
+/**
+ * Zero-copy cursor over tab-separated text tables, like the ones in `events.lod`.
+ *
+ * Lines are separated with one or more `\r`, optionally followed by `\n`. This is how vanilla parsers were splitting
+ * lines (with `strtok`), and this is important because some of the strings in the vanilla tables contain bare `\n`
+ * characters, which are preserved as is. Note that the text is always split into at least one line, and that a
+ * trailing line separator produces an empty last line - exactly the same as what `split` does. The text is also cut at
+ * the first `\0` character, if any.
+ *
+ * Fields in each line are separated with `\t`, empty fields are kept.
+ *
+ * All returned views point into the source data, which must outlive the reader. The reader itself doesn't allocate
+ * after the first few lines, doesn't modify the source data, and doesn't share any state with other readers, so it's
+ * safe to parse several tables concurrently.
+ *
+ * Example usage:
+ * ```
+ * TsvReader tsv(blob);
+ * tsv.skipLines(1); // Skip header.
+ * while (tsv.tryReadLine())
+ *     table.push_back(Entry{tsv.intField(0), std::string(tsv.field(1))});
+ * ```
+ */
+class TsvReader {
+ public:
+    /**
+     * @param blob                      Text table to parse. Its display path is used in error messages.
+     */
+    explicit TsvReader(const Blob &blob);
+
+    /**
+     * @param text                      Text table to parse.
+     * @param displayPath               Name of the table to use in error messages.
+     */
+    explicit TsvReader(std::string_view text, std::string_view displayPath = {});
+
+    /**
+     * Advances to the next line.
+     *
+     * @return                          Whether there was a line to read. If `false` is returned, then the reader is
+     *                                  positioned at the end of the text and the current line is empty.
+     */
+    [[nodiscard]] bool tryReadLine();
+
+    /**
+     * Same as `tryReadLine`, but for tables with a fixed number of lines.
+     *
+     * @throws Exception                If there are no lines left.
+     */
+    void readLine();
+
+    /**
+     * Calls `readLine` the provided number of times. Meant for skipping headers.
+     *
+     * @param count                     Number of lines to skip.
+     * @throws Exception                If there are not enough lines left.
+     */
+    void skipLines(int count);
+
+    /**
+     * @return                          Current line, without the line separator.
+     */
+    [[nodiscard]] std::string_view line() const {
+        return _line;
+    }
+
+    /**
+     * @return                          1-based number of the current line, or zero if no line was read yet.
+     */
+    [[nodiscard]] int lineNumber() const {
+        return _lineNumber;
+    }
+
+    [[nodiscard]] size_t fieldCount() const {
+        return _fields.size();
+    }
+
+    /**
+     * Vanilla parsers were processing fields until the first empty one, and some tables rely on this.
+     *
+     * @param limit                     Maximal number of fields to check.
+     * @return                          Number of leading non-empty fields in the current line, but not more than
+     *                                  `limit`.
+     */
+    [[nodiscard]] size_t leadingFieldCount(size_t limit) const;
+
+    /**
+     * @param column                    0-based field index.
+     * @return                          Field at the provided index in the current line.
+     * @throws Exception                If there is no such field in the current line.
+     */
+    [[nodiscard]] std::string_view field(size_t column) const {
+        if (column >= _fields.size())
+            throwMissingField(column);
+        return _fields[column];
+    }
+
+    /**
+     * @param column                    0-based field index.
+     * @return                          Field at the provided index parsed with `toInt`.
+     * @throws Exception                If there is no such field in the current line.
+     */
+    [[nodiscard]] int intField(size_t column) const {
+        return toInt(field(column));
+    }
+
+    /**
+     * @param column                    0-based field index.
+     * @return                          Field at the provided index parsed with `toFloat`.
+     * @throws Exception                If there is no such field in the current line.
+     */
+    [[nodiscard]] float floatField(size_t column) const {
+        return toFloat(field(column));
+    }
+
+    /**
+     * Throws an exception that points to the provided field in the current line.
+     *
+     * @param column                    0-based field index.
+     * @param fmt                       Format string for the error message.
+     * @param args                      Format arguments.
+     */
+    template<class... Args>
+    [[noreturn]] void throwError(size_t column, fmt::format_string<Args...> fmt, Args &&... args) const {
+        throwErrorInternal(column, fmt::format(fmt, std::forward<Args>(args)...));
+    }
+
+    /**
+     * Parses an integer the way `atoi` does: leading whitespace is skipped, sign is optional, parsing stops at the
+     * first non-digit character, and zero is returned if there are no digits. Vanilla parsers were relying on all of
+     * this, e.g. for fields like `3d6+2`.
+     *
+     * @param text                      Text to parse.
+     * @return                          Parsed integer.
+     */
+    [[nodiscard]] static int toInt(std::string_view text);
+
+    /**
+     * Parses a floating point number the way `atof` does, see `toInt`.
+     *
+     * @param text                      Text to parse.
+     * @return                          Parsed number.
+     */
+    [[nodiscard]] static float toFloat(std::string_view text);
+
+ private:
+    [[noreturn]] void throwMissingField(size_t column) const;
+    [[noreturn]] void throwErrorInternal(size_t column, std::string_view message) const;
+
+ private:
+    std::string_view _text;
+    std::string_view _displayPath;
+    size_t _pos = 0;
+    bool _atEnd = false;
+    int _lineNumber = 0;
+    std::string_view _line;
+    std::vector<std::string_view> _fields;
+};
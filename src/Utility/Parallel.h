@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Calls `callable(i)` for every `i` in `[0, count)`, distributing the calls between the calling thread and a set of
+ * worker threads. Returns once all the calls have finished.
+ *
+ * The order in which the calls are made is unspecified, so `callable` should only write into per-index state.
+ *
+ * @param count                         Number of indices to process.
+ * @param callable                      Callable to invoke, must be safe to invoke concurrently.
+ * @param maxThreads                    Maximal number of threads to use, including the calling thread. Zero means
+ *                                      the number of hardware threads.
+ * @throws                              If any of the calls throws, the first exception is rethrown in the calling
+ *                                      thread after all workers are done. Indices that were not yet processed at
+ *                                      that point are skipped.
+ */
+template<class Callable>
+void parallelFor(size_t count, Callable &&callable, size_t maxThreads = 0) {
+    if (maxThreads == 0)
+        maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    size_t threadCount = std::min(count, maxThreads);
+
+    if (threadCount <= 1) {
+        for (size_t i = 0; i < count; i++)
+            callable(i);
+        return;
+    }
+
+    std::atomic<size_t> next = 0;
+    std::mutex exceptionMutex;
+    std::exception_ptr exception;
+
+    auto worker = [&] {
+        while (true) {
+            size_t i = next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= count)
+                return;
+
+            try {
+                callable(i);
+            } catch (...) {
+                std::lock_guard lock(exceptionMutex);
+                if (!exception)
+                    exception = std::current_exception();
+                next = count; // Stop the other workers.
+                return;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (std::thread &thread : threads)
+        thread.join();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
@@ -53,6 +53,20 @@ bool noCaseLess(std::string_view a, std::string_view b) {
     return a.size() < b.size();
 }
 
+size_t noCaseHash(std::string_view s) {
+    // FNV-1a, see http://www.isthe.com/chongo/tech/comp/fnv/index.html.
+    static constexpr bool is64Bit = sizeof(size_t) == 8;
+    static_assert(is64Bit || sizeof(size_t) == 4);
+
+    size_t result = is64Bit ? static_cast<size_t>(0xcbf29ce484222325ull) : static_cast<size_t>(0x811c9dc5u);
+    size_t prime = is64Bit ? static_cast<size_t>(0x100000001b3ull) : static_cast<size_t>(0x01000193u);
+    for (char c : s) {
+        result ^= static_cast<unsigned char>(toLower(c));
+        result *= prime;
+    }
+    return result;
+}
+
 std::string toPrintable(std::string_view s, char placeholder) {
     std::string result(s.size(), placeholder);
     for (size_t i = 0; i < s.size(); i++)
@@ -32,6 +32,13 @@ bool noCaseStartsWith(std::string_view s, std::string_view prefix);
 bool noCaseEquals(std::string_view a, std::string_view b);
 bool noCaseLess(std::string_view a, std::string_view b);
 
+/**
+ * @param s                             String to hash.
+ * @return                              Case-insensitive hash of the provided string, equal to the hash of
+ *                                      `toLower(s)`. Doesn't allocate.
+ */
+size_t noCaseHash(std::string_view s);
+
 struct NoCaseLess {
     using is_transparent = void; // This is a transparent comparator.
     bool operator()(std::string_view a, std::string_view b) const {
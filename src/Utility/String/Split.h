@@ -126,9 +126,6 @@ template<>
 inline constexpr bool std::ranges::enable_borrowed_range<detail::SplitView> = true;
 #endif
 
-// TODO(captainurist): drop!
-std::vector<char*> tokenize(char *input, const char separator);
-
 /**
  * Splits the provided string `s` using separator `sep`, returning a range of `std::string_view` chunks.
  *
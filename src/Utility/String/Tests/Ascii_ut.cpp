@@ -43,6 +43,14 @@ UNIT_TEST(Ascii, noCaseLess) {
     EXPECT_TRUE(ascii::noCaseLess("@", "`"));
 }
 
+UNIT_TEST(Ascii, noCaseHash) {
+    EXPECT_EQ(ascii::noCaseHash("ABC"), ascii::noCaseHash("abc"));
+    EXPECT_EQ(ascii::noCaseHash("Hello_World.TXT"), ascii::noCaseHash("hello_world.txt"));
+    EXPECT_NE(ascii::noCaseHash("abc"), ascii::noCaseHash("abd"));
+    EXPECT_NE(ascii::noCaseHash("@"), ascii::noCaseHash("`")); // \x40 vs \x60
+    EXPECT_NE(ascii::noCaseHash(""), ascii::noCaseHash(std::string_view("\0", 1)));
+}
+
 UNIT_TEST(Ascii, toPrintable) {
     EXPECT_EQ(ascii::toPrintable("123\xFF", '.'), "123.");
 }
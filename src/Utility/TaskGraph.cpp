@@ -0,0 +1,132 @@
+#include "TaskGraph.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+TaskGraph::TaskId TaskGraph::add(std::string name, std::function<void()> task,
+                                 std::initializer_list<TaskId> dependencies) {
+    return addInternal(std::move(name), std::move(task), dependencies, false);
+}
+
+TaskGraph::TaskId TaskGraph::addMainThread(std::string name, std::function<void()> task,
+                                           std::initializer_list<TaskId> dependencies) {
+    return addInternal(std::move(name), std::move(task), dependencies, true);
+}
+
+TaskGraph::TaskId TaskGraph::addInternal(std::string name, std::function<void()> task,
+                                         std::initializer_list<TaskId> dependencies, bool mainThread) {
+    TaskId id = _tasks.size();
+
+    Task &result = _tasks.emplace_back();
+    result.callable = std::move(task);
+    result.mainThread = mainThread;
+    for (TaskId dependency : dependencies) {
+        assert(dependency >= 0 && dependency < id);
+        _tasks[dependency].dependents.push_back(id);
+        result.dependencyCount++;
+    }
+
+    TaskTiming &timing = _timings.emplace_back();
+    timing.name = std::move(name);
+    return id;
+}
+
+void TaskGraph::run(size_t maxThreads) {
+    if (maxThreads == 0)
+        maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    size_t workerTaskCount = std::ranges::count(_tasks, false, &Task::mainThread);
+    size_t workerCount = std::min(maxThreads - 1, workerTaskCount);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<TaskId> workerQueue;
+    std::deque<TaskId> mainQueue;
+    std::vector<int> remainingDependencies;
+    size_t finishedCount = 0;
+    size_t runningCount = 0;
+    std::exception_ptr exception;
+
+    auto enqueue = [&](TaskId id) {
+        (_tasks[id].mainThread ? mainQueue : workerQueue).push_back(id);
+    };
+
+    for (TaskId id = 0; id < _tasks.size(); id++) {
+        remainingDependencies.push_back(_tasks[id].dependencyCount);
+        if (_tasks[id].dependencyCount == 0)
+            enqueue(id);
+    }
+
+    Clock::time_point startTime = Clock::now();
+
+    auto isDone = [&] {
+        return finishedCount == _tasks.size() || (exception && runningCount == 0);
+    };
+
+    // Runs tasks until there are none left. Main thread can pick up any task, main thread tasks are preferred.
+    auto loop = [&](bool isMainThread) {
+        std::unique_lock lock(mutex);
+        while (true) {
+            condition.wait(lock, [&] {
+                return isDone() || (!exception && (!workerQueue.empty() || (isMainThread && !mainQueue.empty())));
+            });
+            if (isDone())
+                return;
+
+            std::deque<TaskId> &queue = isMainThread && !mainQueue.empty() ? mainQueue : workerQueue;
+            TaskId id = queue.front();
+            queue.pop_front();
+            runningCount++;
+            lock.unlock();
+
+            Clock::time_point taskStartTime = Clock::now();
+            std::exception_ptr taskException;
+            try {
+                _tasks[id].callable();
+            } catch (...) {
+                taskException = std::current_exception();
+            }
+            Clock::time_point taskEndTime = Clock::now();
+
+            lock.lock();
+            runningCount--;
+            finishedCount++;
+
+            TaskTiming &timing = _timings[id];
+            timing.start = taskStartTime - startTime;
+            timing.duration = taskEndTime - taskStartTime;
+            timing.mainThread = isMainThread;
+
+            if (taskException) {
+                if (!exception)
+                    exception = taskException;
+            } else {
+                for (TaskId dependent : _tasks[id].dependents)
+                    if (--remainingDependencies[dependent] == 0)
+                        enqueue(dependent);
+            }
+
+            condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; i++)
+        threads.emplace_back(loop, false);
+    loop(true);
+    for (std::thread &thread : threads)
+        thread.join();
+
+    _totalTime = Clock::now() - startTime;
+
+    if (exception)
+        std::rethrow_exception(exception);
+    assert(finishedCount == _tasks.size());
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * Small dependency-aware task runner, meant for one-shot jobs like engine startup.
+ *
+ * Tasks are added together with the ids of the tasks they depend on, and then `run` executes all of them, running
+ * independent tasks concurrently on a set of worker threads. Tasks that touch state that's only safe to access from
+ * the main thread (file systems, renderer, audio) can be pinned to the calling thread with `addMainThread`.
+ *
+ * Every task is timed, see `timings`.
+ */
+class TaskGraph {
+ public:
+    using TaskId = int;
+    using Clock = std::chrono::steady_clock;
+
+    struct TaskTiming {
+        std::string name;
+        Clock::duration start = {}; // Relative to the start of `run`.
+        Clock::duration duration = {};
+        bool mainThread = false; // Whether the task was executed on the thread that called `run`.
+    };
+
+    /**
+     * Adds a task that can be run on any thread.
+     *
+     * @param name                      Task name, for the timing report.
+     * @param task                      Task to run.
+     * @param dependencies              Ids of the tasks that must finish before this one is started. Can only refer to
+     *                                  the tasks that were added before, so the graph is always acyclic.
+     * @return                          Id of the newly added task.
+     */
+    TaskId add(std::string name, std::function<void()> task, std::initializer_list<TaskId> dependencies = {});
+
+    /**
+     * Same as `add`, but the task is always run on the thread that calls `run`.
+     */
+    TaskId addMainThread(std::string name, std::function<void()> task, std::initializer_list<TaskId> dependencies = {});
+
+    /**
+     * Runs all added tasks & waits for them to finish. The calling thread takes part in running the tasks.
+     *
+     * @param maxThreads                Maximal number of threads to use, including the calling thread. Zero means
+     *                                  the number of hardware threads.
+     * @throws                          If any of the tasks throws, the first exception is rethrown once all the tasks
+     *                                  that were already running have finished. Tasks that weren't started at that
+     *                                  point are skipped.
+     */
+    void run(size_t maxThreads = 0);
+
+    /**
+     * @return                          Timings for all tasks, in the order the tasks were added. Only valid after a
+     *                                  successful call to `run`.
+     */
+    [[nodiscard]] std::span<const TaskTiming> timings() const {
+        return _timings;
+    }
+
+    /**
+     * @return                          Wall time of the last call to `run`.
+     */
+    [[nodiscard]] Clock::duration totalTime() const {
+        return _totalTime;
+    }
+
+ private:
+    struct Task {
+        std::function<void()> callable;
+        std::vector<TaskId> dependents;
+        int dependencyCount = 0;
+        bool mainThread = false;
+    };
+
+    TaskId addInternal(std::string name, std::function<void()> task, std::initializer_list<TaskId> dependencies,
+                       bool mainThread);
+
+ private:
+    std::vector<Task> _tasks;
+    std::vector<TaskTiming> _timings;
+    Clock::duration _totalTime = {};
+};
@@ -0,0 +1,25 @@
+#include <stdexcept>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/Parallel.h"
+
+UNIT_TEST(Parallel, ParallelFor) {
+    for (size_t threads : {0, 1, 2, 8}) {
+        std::vector<int> values(1000, 0);
+        parallelFor(values.size(), [&](size_t i) { values[i] = static_cast<int>(i) * 2; }, threads);
+        for (size_t i = 0; i < values.size(); i++)
+            EXPECT_EQ(values[i], static_cast<int>(i) * 2);
+    }
+
+    // Empty range is OK.
+    parallelFor(0, [](size_t) { FAIL(); });
+}
+
+UNIT_TEST(Parallel, ParallelForException) {
+    EXPECT_THROW(parallelFor(100, [](size_t i) {
+        if (i == 42)
+            throw std::runtime_error("42");
+    }, 4), std::runtime_error);
+}
@@ -0,0 +1,68 @@
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "Testing/Unit/UnitTest.h"
+
+#include "Utility/TaskGraph.h"
+
+UNIT_TEST(TaskGraph, Dependencies) {
+    for (size_t threads : {0, 1, 2, 8}) {
+        std::mutex mutex;
+        std::vector<int> order;
+        auto record = [&](int value) {
+            return [&, value] {
+                std::lock_guard lock(mutex);
+                order.push_back(value);
+            };
+        };
+
+        TaskGraph graph;
+        TaskGraph::TaskId a = graph.add("a", record(0));
+        TaskGraph::TaskId b = graph.add("b", record(1));
+        TaskGraph::TaskId c = graph.add("c", record(2), {a, b});
+        graph.add("d", record(3), {c});
+        graph.run(threads);
+
+        ASSERT_EQ(order.size(), 4);
+        EXPECT_EQ(order[2], 2);
+        EXPECT_EQ(order[3], 3);
+
+        ASSERT_EQ(graph.timings().size(), 4);
+        EXPECT_EQ(graph.timings()[2].name, "c");
+        EXPECT_GE(graph.timings()[2].start, graph.timings()[0].start + graph.timings()[0].duration);
+        EXPECT_GE(graph.timings()[2].start, graph.timings()[1].start + graph.timings()[1].duration);
+    }
+}
+
+UNIT_TEST(TaskGraph, MainThread) {
+    std::thread::id mainThreadId = std::this_thread::get_id();
+    std::atomic<int> mainThreadTasks = 0;
+
+    TaskGraph graph;
+    for (int i = 0; i < 16; i++) {
+        TaskGraph::TaskId id = graph.add("worker", [] {});
+        graph.addMainThread("main", [&] {
+            if (std::this_thread::get_id() == mainThreadId)
+                mainThreadTasks++;
+        }, {id});
+    }
+    graph.run(4);
+
+    EXPECT_EQ(mainThreadTasks, 16);
+    for (const TaskGraph::TaskTiming &timing : graph.timings())
+        if (timing.name == "main")
+            EXPECT_TRUE(timing.mainThread);
+}
+
+UNIT_TEST(TaskGraph, Exception) {
+    bool dependentCalled = false;
+
+    TaskGraph graph;
+    TaskGraph::TaskId id = graph.add("throw", [] { throw std::runtime_error("42"); });
+    graph.add("dependent", [&] { dependentCalled = true; }, {id});
+    EXPECT_THROW(graph.run(4), std::runtime_error);
+    EXPECT_FALSE(dependentCalled);
+}
@@ -0,0 +1,669 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <map>
+#include <ranges>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Testing/Game/GameTest.h"
+
+#include "Engine/Evt/EvtProgram.h"
+#include "Engine/Graphics/Image.h"
+#include "Engine/Graphics/Indoor.h"
+#include "Engine/Graphics/LineOfSightCache.h"
+#include "Engine/Graphics/Outdoor.h"
+#include "Engine/Graphics/OutdoorBuildingBatches.h"
+#include "Engine/Objects/Actor.h"
+#include "Engine/Objects/CharacterEnumFunctions.h"
+#include "Engine/Objects/CharacterStatsCache.h"
+#include "Engine/Objects/Monsters.h"
+#include "Engine/Objects/ObjectGrid.h"
+#include "Engine/Spells/Spells.h"
+#include "Engine/Tables/AutonoteTable.h"
+#include "Engine/Tables/AwardTable.h"
+#include "Engine/Tables/FactionTable.h"
+#include "Engine/Tables/HistoryTable.h"
+#include "Engine/Tables/HouseTable.h"
+#include "Engine/Tables/ItemTable.h"
+#include "Engine/Tables/MerchantTable.h"
+#include "Engine/Tables/MessageScrollTable.h"
+#include "Engine/Tables/NPCTable.h"
+#include "Engine/Tables/QuestTable.h"
+#include "Engine/Tables/TransitionTable.h"
+#include "Engine/AssetsManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameResourceManager.h"
+#include "Engine/Localization.h"
+#include "Engine/MapEnumFunctions.h"
+#include "Engine/MapInfo.h"
+#include "Engine/Party.h"
+
+#include "GUI/UI/UIPopup.h"
+#include "GUI/GUIFont.h"
+#include "GUI/GUIWindow.h"
+
+#include "Library/FileSystem/Interface/FileSystem.h"
+#include "Library/Logger/Logger.h"
+#include "Library/Trace/EventTrace.h"
+
+#include "Utility/ScopeGuard.h"
+
+// Benchmarks for the engine-level data structures & caches. Timings are printed to the log. Thorough correctness checks
+// live in the regular tests next to the code, benchmarks only check that the timed code paths produce the same results,
+// outside of the timed regions. These are disabled by default and are run with the Run_GameBenchmarks target.
+
+template<class Callable>
+static double measureMs(Callable &&callable) {
+    auto start = std::chrono::steady_clock::now();
+    callable();
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::vector<Vec3f> outdoorSamplePoints() {
+    std::vector<Vec3f> result;
+    for (int y = -32768; y < 32768; y += 256)
+        for (int x = -32768; x < 32768; x += 256)
+            result.push_back(Vec3f(x + 17, y + 23, 0)); // Offset so that we don't always land on cell boundaries.
+    for (const Actor &actor : pActors)
+        result.push_back(actor.pos);
+    return result;
+}
+
+GAME_TEST(DISABLED_Benchmarks, OutdoorFaceGrid) {
+    game.startNewGame();
+    game.teleportTo(MAP_HARMONDALE, Vec3f(-18000, 12500, 480), 0);
+
+    std::vector<Vec3f> points = outdoorSamplePoints();
+
+    // Point queries, filtered grid results are the same as with a brute force scan.
+    std::vector<Pid> bruteForce, grid;
+    double bruteForceMs = measureMs([&] {
+        bruteForce.clear();
+        for (const Vec3f &pos : points)
+            for (const BSPModel &model : pOutdoor->pBModels)
+                if (model.pBoundingBox.containsXY(pos.x, pos.y))
+                    for (const ODMFace &face : model.pFaces)
+                        if (face.pBoundingBox.containsXY(pos.x, pos.y))
+                            bruteForce.push_back(Pid::odmFace(model.index, face.index));
+    });
+    double gridMs = measureMs([&] {
+        grid.clear();
+        for (const Vec3f &pos : points) {
+            for (OutdoorFaceGrid::FaceRef ref : pOutdoor->faceGrid.facesAt(pos.x, pos.y)) {
+                const BSPModel &model = pOutdoor->pBModels[ref.modelId];
+                const ODMFace &face = model.pFaces[ref.faceId];
+                if (model.pBoundingBox.containsXY(pos.x, pos.y) && face.pBoundingBox.containsXY(pos.x, pos.y))
+                    grid.push_back(Pid::odmFace(model.index, face.index));
+            }
+        }
+    });
+    logger->info("OutdoorFaceGrid point queries: {} points, {} hits, brute force {:.2f}ms, grid {:.2f}ms.",
+                 points.size(), grid.size(), bruteForceMs, gridMs);
+    EXPECT_EQ(grid, bruteForce);
+
+    // Same for box queries, using boxes of roughly actor size.
+    bruteForceMs = measureMs([&] {
+        bruteForce.clear();
+        for (const Vec3f &pos : points) {
+            BBoxf box = BBoxf::cubic(pos, 128);
+            for (const BSPModel &model : pOutdoor->pBModels)
+                if (box.intersects(model.pBoundingBox))
+                    for (const ODMFace &face : model.pFaces)
+                        if (box.intersects(face.pBoundingBox))
+                            bruteForce.push_back(Pid::odmFace(model.index, face.index));
+        }
+    });
+    gridMs = measureMs([&] {
+        grid.clear();
+        for (const Vec3f &pos : points) {
+            BBoxf box = BBoxf::cubic(pos, 128);
+            for (OutdoorFaceGrid::FaceRef ref : pOutdoor->faceGrid.facesIn(box)) {
+                const BSPModel &model = pOutdoor->pBModels[ref.modelId];
+                const ODMFace &face = model.pFaces[ref.faceId];
+                if (box.intersects(model.pBoundingBox) && box.intersects(face.pBoundingBox))
+                    grid.push_back(Pid::odmFace(model.index, face.index));
+            }
+        }
+    });
+    logger->info("OutdoorFaceGrid box queries: {} boxes, {} hits, brute force {:.2f}ms, grid {:.2f}ms.",
+                 points.size(), grid.size(), bruteForceMs, gridMs);
+    EXPECT_EQ(grid, bruteForce);
+
+    // And the end-to-end numbers.
+    double floorMs = measureMs([&] {
+        bool onWater;
+        int faceId;
+        for (const Vec3f &pos : points)
+            ODM_GetFloorLevel(pos, &onWater, &faceId);
+    });
+    double tickMs = measureMs([&] { game.tick(300); });
+    logger->info("ODM_GetFloorLevel: {} calls in {:.2f}ms. 300 game frames in {:.2f}ms.", points.size(), floorMs, tickMs);
+}
+
+GAME_TEST(DISABLED_Benchmarks, OutdoorCollisionMesh) {
+    game.startNewGame();
+    game.teleportTo(MAP_HARMONDALE, Vec3f(-18000, 12500, 480), 0);
+
+    // Check points on a 5x5x5 lattice inside each face's bounding box.
+    std::vector<std::pair<Pid, Vec3f>> queries;
+    for (const BSPModel &model : pOutdoor->pBModels) {
+        for (const ODMFace &face : model.pFaces) {
+            const BBoxf &box = face.pBoundingBox;
+            for (int i = 0; i < 125; i++) {
+                Vec3f pos(box.x1 + (box.x2 - box.x1) * (i % 5) / 4, box.y1 + (box.y2 - box.y1) * (i / 5 % 5) / 4,
+                          box.z1 + (box.z2 - box.z1) * (i / 25) / 4);
+                queries.emplace_back(Pid::odmFace(model.index, face.index), pos);
+            }
+        }
+    }
+
+    std::vector<bool> legacy, mesh;
+    double legacyMs = measureMs([&] {
+        for (const auto &[pid, pos] : queries)
+            legacy.push_back(pOutdoor->face(pid).Contains(pos, pOutdoor->model(pid).index));
+    });
+    double meshMs = measureMs([&] {
+        for (const auto &[pid, pos] : queries)
+            mesh.push_back(pOutdoor->collisionMesh.contains(pOutdoor->collisionMesh.faceIndex(pid.id() >> 6, pid.id() & 0x3F), pos));
+    });
+    logger->info("OutdoorCollisionMesh containment checks: {} queries, ODMFace::Contains {:.2f}ms, OutdoorCollisionMesh::contains {:.2f}ms.",
+                 queries.size(), legacyMs, meshMs);
+    EXPECT_EQ(mesh, legacy);
+
+    double tickMs = measureMs([&] { game.tick(300); });
+    logger->info("300 game frames in {:.2f}ms.", tickMs);
+}
+
+GAME_TEST(DISABLED_Benchmarks, ActorTargetSelection) {
+    game.startNewGame();
+    game.teleportTo(MAP_HARMONDALE, Vec3f(-18000, 12500, 480), 0);
+
+    std::vector<Vec3f> positions;
+    for (const Actor &actor : pActors)
+        positions.push_back(actor.pos);
+    ObjectGrid grid;
+    grid.build(positions);
+
+    std::vector<Pid> bruteForce(pActors.size()), gridded(pActors.size());
+    double bruteForceMs = measureMs([&] {
+        for (int i = 0; i < pActors.size(); i++)
+            Actor::_SelectTarget(i, &bruteForce[i], true);
+    });
+    double gridMs = measureMs([&] {
+        for (int i = 0; i < pActors.size(); i++)
+            Actor::_SelectTarget(i, &gridded[i], true, &grid);
+    });
+    logger->info("Actor::_SelectTarget: {} actors, brute force {:.2f}ms, grid {:.2f}ms.", pActors.size(), bruteForceMs, gridMs);
+    EXPECT_EQ(gridded, bruteForce);
+}
+
+GAME_TEST(DISABLED_Benchmarks, LineOfSightCache) {
+    game.startNewGame();
+    game.teleportTo(MAP_CASTLE_HARMONDALE, Vec3f(-5100, 2100, 0), 0);
+
+    std::vector<std::pair<Pid, Pid>> queries;
+    for (int i = 0; i < pActors.size(); i++) {
+        queries.emplace_back(Pid(OBJECT_Actor, i), Pid(OBJECT_Character, 0));
+        for (int j = 0; j < pActors.size(); j++)
+            if (i != j)
+                queries.emplace_back(Pid(OBJECT_Actor, i), Pid(OBJECT_Actor, j));
+    }
+
+    std::vector<bool> uncached, cached;
+    double uncachedMs = measureMs([&] {
+        for (const auto &[from, to] : queries) {
+            lineOfSightCache.invalidate();
+            uncached.push_back(Detect_Between_Objects(from, to));
+        }
+    });
+    lineOfSightCache.invalidate();
+    lineOfSightCache.resetStats();
+    for (const auto &[from, to] : queries)
+        Detect_Between_Objects(from, to); // Warm up.
+    double cachedMs = measureMs([&] {
+        for (const auto &[from, to] : queries)
+            cached.push_back(Detect_Between_Objects(from, to));
+    });
+    logger->info("Detect_Between_Objects: {} queries, uncached {:.2f}ms, cached {:.2f}ms, {} hits / {} misses.",
+                 queries.size(), uncachedMs, cachedMs, lineOfSightCache.hits(), lineOfSightCache.misses());
+    EXPECT_EQ(cached, uncached);
+
+    // Stats for normal gameplay.
+    lineOfSightCache.resetStats();
+    double tickMs = measureMs([&] { game.tick(300); });
+    logger->info("300 game frames in {:.2f}ms, line of sight cache: {} hits / {} misses, saved {:.2f}ms.", tickMs,
+                 lineOfSightCache.hits(), lineOfSightCache.misses(),
+                 std::chrono::duration<double, std::milli>(lineOfSightCache.savedTime()).count());
+}
+
+GAME_TEST(DISABLED_Benchmarks, IndoorSectorLookup) {
+    game.startNewGame();
+
+    size_t sectors = 0, points = 0;
+    double gridMs = 0, bruteForceMs = 0;
+    for (MapId map : pMapStats->pInfos.indices()) {
+        if (!isMapIndoor(map))
+            continue;
+
+        game.teleportTo(map, Vec3f(0, 0, 0), 0);
+
+        std::vector<Vec3f> mapPoints;
+        for (const BLVSector &sector : pIndoor->pSectors | std::views::drop(1))
+            for (float y = sector.pBounding.y1; y <= sector.pBounding.y2; y += 64)
+                for (float x = sector.pBounding.x1; x <= sector.pBounding.x2; x += 64)
+                    mapPoints.push_back(Vec3f(x + 7, y + 11, sector.pBounding.z1 + 40));
+
+        // Grid with a single cell degenerates into a brute force scan over all sectors.
+        std::vector<BBoxf> bounds;
+        for (const BLVSector &sector : pIndoor->pSectors)
+            bounds.push_back(sector.pBounding);
+        ObjectGrid bruteForceGrid(65536);
+        bruteForceGrid.build(bounds);
+
+        std::vector<int> gridSectors, bruteForceSectors;
+        auto lookupAll = [&](std::vector<int> *sectors) {
+            for (const Vec3f &pos : mapPoints)
+                sectors->push_back(pIndoor->GetSector(pos));
+        };
+
+        double mapGridMs = measureMs([&] { lookupAll(&gridSectors); });
+        std::swap(pIndoor->sectorGrid, bruteForceGrid);
+        double mapBruteForceMs = measureMs([&] { lookupAll(&bruteForceSectors); });
+        std::swap(pIndoor->sectorGrid, bruteForceGrid);
+        logger->info("IndoorLocation::GetSector in {}: {} sectors, {} points, brute force {:.2f}ms, grid {:.2f}ms.",
+                     pMapStats->pInfos[map].fileName, pIndoor->pSectors.size(), mapPoints.size(), mapBruteForceMs,
+                     mapGridMs);
+        EXPECT_EQ(gridSectors, bruteForceSectors) << pMapStats->pInfos[map].fileName;
+
+        sectors += pIndoor->pSectors.size();
+        points += mapPoints.size();
+        gridMs += mapGridMs;
+        bruteForceMs += mapBruteForceMs;
+    }
+    logger->info("IndoorLocation::GetSector in all indoor maps: {} sectors, {} points, brute force {:.2f}ms, "
+                 "grid {:.2f}ms.", sectors, points, bruteForceMs, gridMs);
+}
+
+GAME_TEST(DISABLED_Benchmarks, EvtInterpreterDispatch) {
+    std::vector<EvtProgram> programs;
+    programs.push_back(EvtProgram::load(engine->_gameResourceManager->getEventsFile("global.evt")));
+    for (const MapInfo &info : pMapStats->pInfos)
+        if (!info.fileName.empty())
+            programs.push_back(EvtProgram::load(engine->_gameResourceManager->getEventsFile(
+                fmt::format("{}.evt", info.fileName.substr(0, info.fileName.rfind('.'))))));
+
+    std::vector<std::pair<const EvtProgram *, int>> events;
+    for (const EvtProgram &program : programs)
+        for (int eventId = 0; eventId <= UINT16_MAX; eventId++)
+            if (program.hasEvent(eventId))
+                events.emplace_back(&program, eventId);
+
+    // Walk through every instruction of every event, the way the interpreter does. The old interpreter copied the
+    // whole event on each invocation and looked up every step with a linear search.
+    int copiedSteps = 0;
+    double copyMs = measureMs([&] {
+        for (const auto &[program, eventId] : events) {
+            std::vector<EvtInstruction> function = program->function(eventId).instructions();
+            for (const EvtInstruction &ir : function)
+                if (ir.step >= 0 && std::ranges::find(function, ir.step, &EvtInstruction::step) != function.end())
+                    copiedSteps++;
+        }
+    });
+
+    int viewSteps = 0;
+    double viewMs = measureMs([&] {
+        for (const auto &[program, eventId] : events) {
+            const EvtFunction &function = program->function(eventId);
+            for (const EvtInstruction &ir : function)
+                if (function.instruction(ir.step))
+                    viewSteps++;
+        }
+    });
+
+    logger->info("EvtInterpreter dispatch: {} programs, {} events, {} / {} steps, copy & linear search {:.2f}ms, view "
+                 "{:.2f}ms.", programs.size(), events.size(), copiedSteps, viewSteps, copyMs, viewMs);
+    EXPECT_EQ(viewSteps, copiedSteps);
+}
+
+GAME_TEST(DISABLED_Benchmarks, OutdoorBuildingBatches) {
+    game.startNewGame();
+    game.teleportTo(MAP_HARMONDALE, Vec3f(-18000, 12500, 480), 0);
+
+    using Vertex = OutdoorBuildingBatches::Vertex;
+    std::vector<BSPModel> &models = pOutdoor->pBModels;
+
+    // Same unit & layer assignment scheme as in the renderer - one unit per texture size.
+    std::map<std::pair<int, int>, int> units;
+    std::map<int, int> layers;
+    std::map<GraphicsImage *, OutdoorBuildingBatches::TextureLayer> textureLayers;
+    auto resolver = [&](GraphicsImage *texture) {
+        auto [pos, inserted] = textureLayers.emplace(texture, OutdoorBuildingBatches::TextureLayer());
+        if (inserted) {
+            std::pair<int, int> size(texture->width(), texture->height());
+            int unit = units.emplace(size, units.size() % OutdoorBuildingBatches::MAX_TEXTURE_UNITS).first->second;
+            pos->second = OutdoorBuildingBatches::TextureLayer(unit, layers[unit]++);
+        }
+        return pos->second;
+    };
+
+    OutdoorBuildingBatches batches;
+    double buildMs = measureMs([&] { batches.build(models, resolver, false); });
+
+    std::vector<int> modelIds;
+    for (const BSPModel &model : models)
+        modelIds.push_back(model.index);
+
+    // Brute force is what the renderer used to do on every frame - generate the vertices for all visible faces.
+    auto streamAll = [&] {
+        std::array<std::vector<Vertex>, OutdoorBuildingBatches::MAX_TEXTURE_UNITS> result;
+        for (BSPModel &model : models) {
+            for (ODMFace &face : model.pFaces) {
+                GraphicsImage *texture = face.GetTexture();
+                if (face.Invisible() || !texture)
+                    continue;
+
+                OutdoorBuildingBatches::TextureLayer layer = resolver(texture);
+                for (int z = 0; z < face.uNumVertices - 2; z++) {
+                    for (int i : {0, z + 1, z + 2}) {
+                        const Vec3f &pos = model.pVertices[face.pVertexIDs[i]];
+                        const Vec3f &normal = face.facePlane.normal;
+                        result[layer.unit].push_back(Vertex(pos.x, pos.y, pos.z,
+                                                            face.pTextureUIDs[i] + face.sTextureDeltaU,
+                                                            face.pTextureVIDs[i] + face.sTextureDeltaV,
+                                                            layer.unit, layer.layer, normal.x, normal.y, normal.z,
+                                                            OutdoorBuildingBatches::attribFlags(face, false)));
+                    }
+                }
+            }
+        }
+        return result;
+    };
+
+    constexpr int frames = 100;
+    std::array<std::vector<Vertex>, OutdoorBuildingBatches::MAX_TEXTURE_UNITS> bruteForce;
+    double bruteForceMs = measureMs([&] {
+        for (int i = 0; i < frames; i++)
+            bruteForce = streamAll();
+    });
+    double batchesMs = measureMs([&] {
+        for (int i = 0; i < frames; i++)
+            batches.prepareFrame(models, modelIds, false);
+    });
+
+    int drawRanges = 0;
+    for (int unit = 0; unit < OutdoorBuildingBatches::MAX_TEXTURE_UNITS; unit++)
+        drawRanges += batches.drawRanges(unit).size();
+    logger->info("OutdoorBuildingBatches: {} models, {} vertices, {} draw ranges, build {:.2f}ms, {} frames of "
+                 "streaming {:.2f}ms, {} frames of batches {:.2f}ms.",
+                 models.size(), batches.vertices().size(), drawRanges, buildMs, frames, bruteForceMs, frames, batchesMs);
+
+    // Batches draw the same vertices as the streaming code, minus the degenerate triangles.
+    Vertex degenerate = {};
+    for (int unit = 0; unit < OutdoorBuildingBatches::MAX_TEXTURE_UNITS; unit++) {
+        std::vector<Vertex> drawn;
+        for (OutdoorBuildingBatches::DrawRange range : batches.drawRanges(unit))
+            for (const Vertex &vertex : batches.vertices().subspan(range.first, range.count))
+                if (std::memcmp(&vertex, &degenerate, sizeof(Vertex)) != 0)
+                    drawn.push_back(vertex);
+        ASSERT_EQ(drawn.size(), bruteForce[unit].size());
+        EXPECT_EQ(std::memcmp(drawn.data(), bruteForce[unit].data(), drawn.size() * sizeof(Vertex)), 0);
+    }
+}
+
+GAME_TEST(DISABLED_Benchmarks, BinaryTraces) {
+    FileSystem *tfs = test.testData();
+
+    std::vector<Blob> jsonTraces;
+    for (const DirectoryEntry &entry : tfs->ls(""))
+        if (entry.type == FILE_REGULAR && entry.name.ends_with(".json"))
+            if (tfs->exists(entry.name.substr(0, entry.name.size() - 5) + ".mm7"))
+                jsonTraces.push_back(tfs->read(entry.name));
+    ASSERT_FALSE(jsonTraces.empty());
+
+    std::vector<Blob> binaryTraces;
+    size_t jsonSize = 0, binarySize = 0;
+    for (const Blob &json : jsonTraces) {
+        binaryTraces.push_back(EventTrace::toBinaryBlob(EventTrace::fromJsonBlob(json, nullptr)));
+        jsonSize += json.size();
+        binarySize += binaryTraces.back().size();
+    }
+
+    size_t jsonEvents = 0, binaryEvents = 0;
+    double jsonMs = measureMs([&] {
+        for (const Blob &json : jsonTraces)
+            jsonEvents += EventTrace::fromJsonBlob(json, nullptr).events.size();
+    });
+    double binaryMs = measureMs([&] {
+        for (const Blob &binary : binaryTraces)
+            binaryEvents += EventTrace::fromBinaryBlob(binary, nullptr).events.size();
+    });
+
+    // Time until the first event is available for playback, this is what the streaming reader is for.
+    size_t firstEvents = 0;
+    double firstEventMs = measureMs([&] {
+        for (const Blob &binary : binaryTraces) {
+            EventTraceReader reader(binary, nullptr);
+            firstEvents += reader.readEvent() != nullptr;
+        }
+    });
+
+    logger->info("BinaryTraces: {} traces, {} / {} events, JSON {} bytes / {:.2f}ms, binary {} bytes / {:.2f}ms, "
+                 "binary time to first event for {} traces {:.2f}ms.", jsonTraces.size(), jsonEvents, binaryEvents,
+                 jsonSize, jsonMs, binarySize, binaryMs, firstEvents, firstEventMs);
+    EXPECT_EQ(binaryEvents, jsonEvents);
+    EXPECT_EQ(firstEvents, binaryTraces.size());
+}
+
+GAME_TEST(DISABLED_Benchmarks, TextTables) {
+    GameResourceManager *resources = engine->_gameResourceManager.get();
+
+    std::vector<std::pair<std::string_view, Blob>> blobs;
+    size_t tableSize = 0;
+    for (std::string_view name : {"monsters.txt", "placemon.txt", "spells.txt", "hostile.txt", "history.txt",
+                                  "2dEvents.txt", "quests.txt", "autonote.txt", "awards.txt", "trans.txt",
+                                  "merchant.txt", "scroll.txt", "MapStats.txt"}) {
+        blobs.emplace_back(name, resources->getEventsFile(name));
+        tableSize += blobs.back().second.size();
+    }
+    auto blob = [&](std::string_view name) -> const Blob & {
+        return std::ranges::find(blobs, name, &std::pair<std::string_view, Blob>::first)->second;
+    };
+
+    // Some of the tables are parsed straight into globals, so these are restored once we're done. Tables that are
+    // parsed into objects are parsed into locals.
+    auto savedHouses = houseTable;
+    auto savedQuests = pQuestTable;
+    auto savedAutonotes = pAutonoteTxt;
+    auto savedAwards = pAwards;
+    auto savedTransitions = pTransitionStrings;
+    auto savedBuyPhrases = pMerchantsBuyPhrases;
+    auto savedSellPhrases = pMerchantsSellPhrases;
+    auto savedRepairPhrases = pMerchantsRepairPhrases;
+    auto savedIdentifyPhrases = pMerchantsIdentifyPhrases;
+    auto savedMessageScrolls = pMessageScrolls;
+    auto savedNpcTopics = pNPCTopics;
+    MM_AT_SCOPE_EXIT(
+        houseTable = std::move(savedHouses);
+        pQuestTable = std::move(savedQuests);
+        pAutonoteTxt = std::move(savedAutonotes);
+        pAwards = std::move(savedAwards);
+        pTransitionStrings = std::move(savedTransitions);
+        pMerchantsBuyPhrases = std::move(savedBuyPhrases);
+        pMerchantsSellPhrases = std::move(savedSellPhrases);
+        pMerchantsRepairPhrases = std::move(savedRepairPhrases);
+        pMerchantsIdentifyPhrases = std::move(savedIdentifyPhrases);
+        pMessageScrolls = std::move(savedMessageScrolls);
+        pNPCTopics = std::move(savedNpcTopics)
+    );
+
+    constexpr int iterations = 10;
+    auto monsterStats = std::make_unique<MonsterStats>();
+    auto mapStats = std::make_unique<MapStats>();
+    auto spellStats = std::make_unique<SpellStats>();
+    auto factionTable = std::make_unique<FactionTable>();
+    auto historyTable = std::make_unique<HistoryTable>();
+    double parseMs = measureMs([&] {
+        for (int i = 0; i < iterations; i++) {
+            monsterStats->Initialize(blob("monsters.txt"));
+            monsterStats->InitializePlacements(blob("placemon.txt"));
+            mapStats->Initialize(blob("MapStats.txt"));
+            spellStats->Initialize(blob("spells.txt"));
+            factionTable->Initialize(blob("hostile.txt"));
+            historyTable->Initialize(blob("history.txt"));
+            initializeHouses(blob("2dEvents.txt"));
+            initializeQuests(blob("quests.txt"));
+            initializeAutonotes(blob("autonote.txt"));
+            initializeAwards(blob("awards.txt"));
+            initializeTransitions(blob("trans.txt"));
+            initializeMerchants(blob("merchant.txt"));
+            initializeMessageScrolls(blob("scroll.txt"));
+        }
+    });
+
+    // Tables that read their own files from the LOD, so these timings include LOD reads.
+    auto itemTable = std::make_unique<ItemTable>();
+    auto npcStats = std::make_unique<NPCStats>();
+    auto localization = std::make_unique<Localization>();
+    double loadMs = measureMs([&] {
+        for (int i = 0; i < iterations; i++) {
+            itemTable->Initialize(resources);
+            npcStats->Initialize(resources);
+            localization->Initialize();
+        }
+    });
+
+    logger->info("TextTables: {} iterations, {} bytes of standalone tables parsed in {:.2f}ms, items, NPCs & "
+                 "localization loaded in {:.2f}ms.", iterations, tableSize, parseMs, loadMs);
+}
+
+GAME_TEST(DISABLED_Benchmarks, TextLayoutCache) {
+    game.startNewGame();
+    if (pParty->activeCharacterIndex() != 1) {
+        game.pressGuiButton("Game_Character1");
+        game.tick(1);
+    }
+    game.pressGuiButton("Game_Character1"); // Opens up the character screen.
+    game.tick(1);
+    ASSERT_EQ(current_screen_type, SCREEN_CHARACTERS);
+    GUIWindow *characterScreen = pGUIWindow_CurrentMenu;
+
+    std::vector<Item *> items;
+    for (Character &character : pParty->pCharacters)
+        for (InventoryEntry entry : character.inventory.equipment())
+            items.push_back(entry.get());
+    ASSERT_FALSE(items.empty());
+
+    // Character screen tabs & the popups that can be shown on top of them, this is the text-heaviest UI in the game.
+    auto drawFrame = [&] {
+        for (WindowType tab : {WINDOW_CharacterWindow_Stats, WINDOW_CharacterWindow_Skills, WINDOW_CharacterWindow_Awards}) {
+            current_character_screen_window = tab;
+            characterScreen->Update();
+        }
+        current_character_screen_window = WINDOW_CharacterWindow_Stats;
+
+        GUIWindow popupWindow;
+        popupWindow.uFrameWidth = 400;
+        popupWindow.uFrameHeight = 200;
+        popupWindow.uFrameX = 38;
+        popupWindow.uFrameY = 60;
+        for (int i = 0; i < pParty->pCharacters.size(); i++)
+            GameUI_CharacterQuickRecord_Draw(&popupWindow, i);
+        for (Item *item : items)
+            GameUI_DrawItemInfo(item);
+    };
+
+    std::vector<GUIFont *> fonts = {
+        assets->pFontBookOnlyShadow.get(), assets->pFontBookLloyds.get(), assets->pFontArrus.get(),
+        assets->pFontLucida.get(), assets->pFontBookTitle.get(), assets->pFontBookCalendar.get(),
+        assets->pFontCreate.get(), assets->pFontCChar.get(), assets->pFontComic.get(), assets->pFontSmallnum.get()
+    };
+    auto resetStats = [&] {
+        for (GUIFont *font : fonts)
+            font->resetLayoutCacheStats();
+    };
+    auto hits = [&] {
+        size_t result = 0;
+        for (GUIFont *font : fonts)
+            result += font->layoutCacheHits();
+        return result;
+    };
+    auto misses = [&] {
+        size_t result = 0;
+        for (GUIFont *font : fonts)
+            result += font->layoutCacheMisses();
+        return result;
+    };
+
+    // Uncached numbers are for a cache that's dropped on every frame, this is roughly what the old code was doing.
+    constexpr int frames = 100;
+    double uncachedMs = measureMs([&] {
+        for (int i = 0; i < frames; i++) {
+            for (GUIFont *font : fonts)
+                font->invalidateLayoutCache();
+            drawFrame();
+        }
+    });
+
+    drawFrame(); // Warm up.
+    resetStats();
+    double cachedMs = measureMs([&] {
+        for (int i = 0; i < frames; i++)
+            drawFrame();
+    });
+
+    logger->info("TextLayoutCache: {} frames of character screen & popups, uncached {:.2f}ms, cached {:.2f}ms, "
+                 "{} hits / {} misses.", frames, uncachedMs, cachedMs, hits(), misses());
+}
+
+GAME_TEST(DISABLED_Benchmarks, CharacterStatsCache) {
+    game.startNewGame();
+
+    // Give everyone some buffs so that the stat getters have something to chew through.
+    Time expireTime = pParty->GetPlayingTime() + Duration::fromHours(1);
+    for (Character &character : pParty->pCharacters) {
+        character.pCharacterBuffs[CHARACTER_BUFF_BLESS].Apply(expireTime, MASTERY_MASTER, 5, 0, 0);
+        character.pCharacterBuffs[CHARACTER_BUFF_HEROISM].Apply(expireTime, MASTERY_MASTER, 5, 0, 0);
+        character.pCharacterBuffs[CHARACTER_BUFF_RESIST_FIRE].Apply(expireTime, MASTERY_MASTER, 5, 0, 0);
+    }
+
+    // Roughly what the stats tab & quick records are querying.
+    auto queryStats = [&] {
+        int64_t sum = 0;
+        for (const Character &character : pParty->pCharacters) {
+            for (Attribute attr : allStatAttributes())
+                sum += character.GetActualStat(attr);
+            for (Attribute attr : {ATTRIBUTE_RESIST_FIRE, ATTRIBUTE_RESIST_AIR, ATTRIBUTE_RESIST_WATER,
+                                   ATTRIBUTE_RESIST_EARTH, ATTRIBUTE_RESIST_MIND, ATTRIBUTE_RESIST_BODY})
+                sum += character.GetActualResistance(attr);
+            sum += character.GetActualAC() + character.GetActualAttack(false) + character.GetActualAttack(true);
+        }
+        return sum;
+    };
+
+    // Sums are checked so that the compiler can't throw the queries away.
+    characterStatsCache.resetStats();
+    constexpr int frames = 1000;
+    constexpr int queriesPerFrame = 10;
+    int64_t uncachedSum = 0, cachedSum = 0;
+    double uncachedMs = measureMs([&] {
+        for (int i = 0; i < frames * queriesPerFrame; i++)
+            uncachedSum += queryStats();
+    });
+    double cachedMs = measureMs([&] {
+        for (int i = 0; i < frames; i++) {
+            CharacterStatsCache::Scope statsScope;
+            for (int j = 0; j < queriesPerFrame; j++)
+                cachedSum += queryStats();
+        }
+    });
+
+    logger->info("CharacterStatsCache: {} frames x {} stat sweeps, uncached {:.2f}ms, cached {:.2f}ms, "
+                 "{} hits / {} misses.", frames, queriesPerFrame, uncachedMs, cachedMs, characterStatsCache.hits(),
+                 characterStatsCache.misses());
+    EXPECT_EQ(cachedSum, uncachedSum);
+}
@@ -27,6 +27,9 @@ GameTestOptions GameTestOptions::parse(int argc, char **argv) {
     app->add_option(
         "--speed", result.speed,
         "Playback speed, default is infinite, use '1.0' for realtime playback.")->option_text("SPEED");
+    app->add_option(
+        "--table-cache-path", result.tableCachePath,
+        "Path to data table cache dir. Enables the table cache, so that subsequent runs don't parse text tables.")->option_text("PATH")->group(otherOptions);
     app->add_flag(
         "--tracing-rng", result.tracingRng,
         "Use random number generators that print stack trace on each call.")->group(otherOptions);
@@ -728,8 +728,7 @@ GAME_TEST(Prs, Pr1440) {
 
 GAME_TEST(Issues, Issue1447a) {
     // Fire bolt doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle &par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return engine->particle_engine->particles().size(); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447A.mm7", "issue_1447A.json");
     EXPECT_EQ(turnBasedTape.back(), true);
@@ -738,8 +737,7 @@ GAME_TEST(Issues, Issue1447a) {
 
 GAME_TEST(Issues, Issue1447b) {
     // Fireball doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle& par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return engine->particle_engine->particles().size(); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447B.mm7", "issue_1447B.json");
     EXPECT_EQ(turnBasedTape.back(), true);
@@ -748,8 +746,7 @@ GAME_TEST(Issues, Issue1447b) {
 
 GAME_TEST(Issues, Issue1447c) {
     // Acid blast doesn't emit particles in turn based mode
-    auto particlesTape = tapes.custom([] { return std::ranges::count_if(engine->particle_engine.get()->pParticles,
-                                        [](const Particle& par) { return par.type != ParticleType_Invalid; }); });
+    auto particlesTape = tapes.custom([] { return engine->particle_engine->particles().size(); });
     auto turnBasedTape = tapes.custom([] { return pParty->bTurnBasedModeOn; });
     test.playTraceFromTestData("issue_1447C.mm7", "issue_1447C.json");
     EXPECT_EQ(turnBasedTape.back(), true);
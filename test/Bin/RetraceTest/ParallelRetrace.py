@@ -46,7 +46,9 @@ def main():
     # Expand the glob pattern to a list of files
     traces = args.traces
     if args.ls:
-        traces += glob.glob(args.ls + "/*.json")
+        # Traces can be either JSON or binary, pick up everything that has a save file next to it.
+        traces += [path for path in glob.glob(args.ls + "/*")
+                   if os.path.isfile(path) and not path.endswith(".mm7") and os.path.isfile(os.path.splitext(path)[0] + ".mm7")]
     traces.sort() # We want determinism
 
     if not traces:
@@ -28,6 +28,14 @@ class TestController {
     void prepareForNextTest();
     void prepareForNextTest(int frameTimeMs, RandomEngineType rngType);
 
+    /**
+     * @return                          File system with the test data, the same one `loadGameFromTestData` &
+     *                                  `playTraceFromTestData` read from.
+     */
+    [[nodiscard]] FileSystem *testData() const {
+        return _tfs;
+    }
+
     bool isTaping() const;
     void startTaping();
     void stopTaping();